@@ -1,10 +1,17 @@
 #pragma once
+#include "../../common/include/dsCheck.hpp"
+#include "../../common/include/growthPolicy.hpp"
+#include "../../common/include/hugePageMemory.hpp"
+#include "../../trace/include/traceHooks.hpp"
+#include <new>
 #include <stdexcept>
 
 /**
  * @brief 动态数组模板类
  * 
  * 提供基本的数组操作，包括插入、删除、查找、扩容等。
+ * 默认满时插入抛出异常；设置扩容策略后插入会按策略自动扩容。
+ * 不小于 DS_HUGE_PAGE_THRESHOLD 字节的缓冲区按 2 MB 对齐分配并请求透明大页（见 hugePageMemory.hpp）。
  * 
  * @tparam T 元素类型
  */
@@ -14,13 +21,35 @@ private:
     T* data;         ///< 指向数组数据的指针
     int capacity;    ///< 数组容量
     int length;      ///< 当前元素个数
+    GrowthPolicy policy;  ///< 满时的扩容策略
+
+    /**
+     * @brief 分配 n 个槽位并逐个默认构造
+     * @param n 槽位数
+     * @return 槽位指针
+     */
+    static T* allocateSlots(int n);
+
+    /**
+     * @brief 析构 n 个槽位并释放
+     * @param slots 槽位指针
+     * @param n 槽位数
+     */
+    static void releaseSlots(T* slots, int n);
+
+    /**
+     * @brief 换到容量为 newCapacity 的新缓冲区，复制前 length 个元素
+     * @param newCapacity 新容量，不小于 length
+     */
+    void reallocate(int newCapacity);
 
 public:
     /**
      * @brief 构造函数，初始化指定容量的数组
      * @param capacity 数组容量
+     * @param policy 满时的扩容策略，默认不自动扩容
      */
-    explicit Array(int capacity);
+    explicit Array(int capacity, GrowthPolicy policy = GrowthPolicy::none());
 
     /**
      * @brief 拷贝构造函数
@@ -72,12 +101,78 @@ public:
      */
     void remove(int index);
 
+    /**
+     * @brief 不抛异常的读取
+     * @param index 元素索引
+     * @param out 成功时写入元素值
+     * @return 索引有效返回true，越界返回false（out不变）
+     */
+    bool try_get(int index, T& out) const;
+
+    /**
+     * @brief 不抛异常的修改
+     * @param index 元素索引
+     * @param value 新值
+     * @return 索引有效返回true，越界返回false
+     */
+    bool try_set(int index, const T& value);
+
+    /**
+     * @brief 不检查边界的读取，调用者保证 0 <= index < size()
+     * @param index 元素索引
+     * @return 元素的常量引用
+     */
+    const T& unchecked_get(int index) const { return data[index]; }
+    T& unchecked_get(int index) { return data[index]; }
+
+    /**
+     * @brief 不检查边界的修改，调用者保证 0 <= index < size()
+     * @param index 元素索引
+     * @param value 新值
+     */
+    void unchecked_set(int index, const T& value) { data[index] = value; }
+
+    /**
+     * @brief 不检查边界的删除，调用者保证 0 <= index < size()
+     * @param index 删除位置
+     */
+    void unchecked_remove(int index);
+
     /**
      * @brief 扩展数组容量
      * @param enlarge 扩容的大小
      */
     void extend(int enlarge);
 
+    /**
+     * @brief 预留容量，容量不足 n 时恰好扩到 n
+     * @param n 所需容量
+     */
+    void reserve(int n);
+
+    /**
+     * @brief 把容量收缩到当前元素个数，释放多余内存
+     */
+    void shrink_to_fit();
+
+    /**
+     * @brief 设置满时的扩容策略
+     * @param newPolicy 扩容策略
+     */
+    void setGrowthPolicy(const GrowthPolicy& newPolicy) { policy = newPolicy; }
+
+    /**
+     * @brief 当前扩容策略
+     * @return 扩容策略
+     */
+    const GrowthPolicy& growthPolicy() const { return policy; }
+
+    /**
+     * @brief 获取数组容量
+     * @return 容量
+     */
+    int getCapacity() const { return capacity; }
+
     /**
      * @brief 查找元素，返回其索引
      * @param value 查找的元素
@@ -106,15 +201,54 @@ public:
 
 // ================== 实现部分 ==================
 
+// 分配槽位：大缓冲区走大页路径，再逐个默认构造，构造失败时回滚
+template<typename T>
+T* Array<T>::allocateSlots(int n) {
+    if (n < 0) throw std::bad_array_new_length();
+    std::size_t bytes = static_cast<std::size_t>(n) * sizeof(T);
+    T* slots = static_cast<T*>(HugePageMemory::allocate(bytes));
+    int built = 0;
+    try {
+        for (; built < n; ++built) {
+            ::new (static_cast<void*>(slots + built)) T;
+        }
+    } catch (...) {
+        for (int i = 0; i < built; ++i) slots[i].~T();
+        HugePageMemory::deallocate(slots, bytes);
+        throw;
+    }
+    return slots;
+}
+
+// 析构并释放槽位
+template<typename T>
+void Array<T>::releaseSlots(T* slots, int n) {
+    if (slots == nullptr) return;
+    for (int i = 0; i < n; ++i) slots[i].~T();
+    HugePageMemory::deallocate(slots, static_cast<std::size_t>(n) * sizeof(T));
+}
+
+// 换到新缓冲区
+template<typename T>
+void Array<T>::reallocate(int newCapacity) {
+    T* newData = allocateSlots(newCapacity);
+    for (int i = 0; i < length; ++i) {
+        newData[i] = data[i];
+    }
+    releaseSlots(data, capacity);
+    data = newData;
+    capacity = newCapacity;
+}
+
 // 构造函数，分配指定容量的内存
 template<typename T>
-Array<T>::Array(int capacity)
-    : data(new T[capacity]), capacity(capacity), length(0) {}
+Array<T>::Array(int capacity, GrowthPolicy policy)
+    : data(allocateSlots(capacity)), capacity(capacity), length(0), policy(policy) {}
 
 // 拷贝构造函数，深拷贝数据
 template<typename T>
 Array<T>::Array(const Array& other)
-    : data(new T[other.capacity]), capacity(other.capacity), length(other.length) {
+    : data(allocateSlots(other.capacity)), capacity(other.capacity), length(other.length), policy(other.policy) {
     for (int i = 0; i < length; ++i) {
         data[i] = other.data[i];
     }
@@ -124,13 +258,15 @@ Array<T>::Array(const Array& other)
 template<typename T>
 Array<T>& Array<T>::operator=(const Array& other) {
     if (this != &other) {
-        delete[] data;
+        T* newData = allocateSlots(other.capacity);
+        for (int i = 0; i < other.length; ++i) {
+            newData[i] = other.data[i];
+        }
+        releaseSlots(data, capacity);
+        data = newData;
         capacity = other.capacity;
         length = other.length;
-        data = new T[capacity];
-        for (int i = 0; i < length; ++i) {
-            data[i] = other.data[i];
-        }
+        policy = other.policy;
     }
     return *this;
 }
@@ -138,36 +274,35 @@ Array<T>& Array<T>::operator=(const Array& other) {
 // 析构函数，释放内存
 template<typename T>
 Array<T>::~Array() {
-    delete[] data;
+    releaseSlots(data, capacity);
 }
 
 // 获取指定索引的元素
 template<typename T>
 T Array<T>::get(int index) const {
-    if (index < 0 || index >= length) {
-        throw std::out_of_range("Index out of range");
-    }
+    DS_CHECK(index >= 0 && index < length, std::out_of_range, "Index out of range");
     return data[index];
 }
 
 // 设置指定索引的元素
 template<typename T>
 void Array<T>::set(int index, const T& value) {
-    if (index < 0 || index >= length) {
-        throw std::out_of_range("Index out of range");
-    }
+    DS_CHECK(index >= 0 && index < length, std::out_of_range, "Index out of range");
     data[index] = value;
 }
 
-// 在指定位置插入元素
+// 在指定位置插入元素，满时按扩容策略扩容（策略为 NONE 时报告已满）
 template<typename T>
 void Array<T>::insert(int index, const T& value) {
-    if (isFull()) {
-        throw std::overflow_error("Array is full");
-    }
-    if (index < 0 || index > length) {
-        throw std::out_of_range("Index out of range");
+    DS_TRACE_SCOPE("Array::insert");
+    if (isFull() && policy.grows() && index >= 0 && index <= length) {
+        T copy = value;   // value 可能引用旧缓冲区中的元素
+        reallocate(policy.next(capacity, length + 1));
+        insert(index, copy);
+        return;
     }
+    DS_CHECK(!isFull(), std::overflow_error, "Array is full");
+    DS_CHECK(index >= 0 && index <= length, std::out_of_range, "Index out of range");
     for (int i = length; i > index; --i) {
         data[i] = data[i - 1];
     }
@@ -178,26 +313,54 @@ void Array<T>::insert(int index, const T& value) {
 // 删除指定位置的元素
 template<typename T>
 void Array<T>::remove(int index) {
-    if (index < 0 || index >= length) {
-        throw std::out_of_range("Index out of range");
-    }
+    DS_TRACE_SCOPE("Array::remove");
+    DS_CHECK(index >= 0 && index < length, std::out_of_range, "Index out of range");
+    unchecked_remove(index);
+}
+
+// 不检查边界的删除：后续元素前移一位
+template<typename T>
+void Array<T>::unchecked_remove(int index) {
     for (int i = index; i < length - 1; ++i) {
         data[i] = data[i + 1];
     }
     --length;
 }
 
+// 不抛异常的读取
+template<typename T>
+bool Array<T>::try_get(int index, T& out) const {
+    if (index < 0 || index >= length) return false;
+    out = data[index];
+    return true;
+}
+
+// 不抛异常的修改
+template<typename T>
+bool Array<T>::try_set(int index, const T& value) {
+    if (index < 0 || index >= length) return false;
+    data[index] = value;
+    return true;
+}
+
 // 扩展数组容量
 template<typename T>
 void Array<T>::extend(int enlarge) {
+    DS_TRACE_SCOPE("Array::extend");
     if (enlarge <= 0) return;
-    T* newData = new T[capacity + enlarge];
-    for (int i = 0; i < length; ++i) {
-        newData[i] = data[i];
-    }
-    delete[] data;
-    data = newData;
-    capacity += enlarge;
+    reallocate(capacity + enlarge);
+}
+
+// 预留容量
+template<typename T>
+void Array<T>::reserve(int n) {
+    if (n > capacity) reallocate(n);
+}
+
+// 收缩容量到元素个数
+template<typename T>
+void Array<T>::shrink_to_fit() {
+    if (capacity > length) reallocate(length);
 }
 
 // 查找元素，返回其索引
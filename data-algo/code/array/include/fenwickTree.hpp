@@ -0,0 +1,193 @@
+#pragma once
+#include "array.hpp"
+#include "../../common/include/dsCheck.hpp"
+#include "../../vector/code/vector.hpp"
+#include <stdexcept>
+
+/**
+ * @brief 树状数组（Fenwick 树）：单点修改、前缀和查询
+ *
+ * tree[i]（下标从1开始）保存以 i 结尾、长度为 lowbit(i) 的一段元素之和。单点修改沿 i += lowbit(i)
+ * 向上更新，前缀和沿 i -= lowbit(i) 向下累加，都是 O(log n)；区间和由两个前缀和相减得到。
+ * 整个结构只有一个长度 n+1 的数组，没有指针，比线段树省一半内存。
+ *
+ * 只适用于可逆的运算（加法）；最小值、最大值等不可逆的聚合请使用 SegmentTree。
+ *
+ * @tparam T 元素类型（需支持 +、-、+=，且 T() 为零元）
+ */
+template<typename T>
+class FenwickTree {
+private:
+    Vector<T> tree;   ///< tree[0] 不用
+    int n;            ///< 元素个数
+    int topBit;       ///< 不超过 n 的最高二次幂，供 lowerBound 二分下降
+
+    void resetSize(int count);
+
+public:
+    /**
+     * @brief 构造函数，n 个元素全为零
+     * @param n 元素个数
+     * @throws std::length_error 如果 n 为负
+     */
+    explicit FenwickTree(int n = 0);
+
+    /**
+     * @brief 用已有数据 O(n) 构建，替换全部内容
+     * @param values 元素数组
+     * @param count 元素个数
+     */
+    void build(const T* values, int count);
+    void build(const Array<T>& values);
+    void build(const Vector<T>& values);
+
+    /**
+     * @brief 单点加
+     * @param index 元素下标
+     * @param delta 增量
+     * @throws std::out_of_range 如果下标越界
+     */
+    void add(int index, const T& delta);
+
+    /**
+     * @brief 单点赋值，先求出原值再加上差值
+     * @param index 元素下标
+     * @param value 新值
+     * @throws std::out_of_range 如果下标越界
+     */
+    void set(int index, const T& value);
+
+    /**
+     * @brief 读取单个元素，O(log n)
+     * @param index 元素下标
+     * @return 元素值
+     * @throws std::out_of_range 如果下标越界
+     */
+    T get(int index) const;
+
+    /**
+     * @brief 前缀和：下标 [0, count) 的元素之和
+     * @param count 前缀长度
+     * @return 前缀和
+     * @throws std::out_of_range 如果 count 不在 [0, n] 内
+     */
+    T prefixSum(int count) const;
+
+    /**
+     * @brief 区间和：下标 [lo, hi) 的元素之和
+     * @param lo 区间起点
+     * @param hi 区间终点（不含）
+     * @return 区间和
+     * @throws std::out_of_range 如果不满足 0 <= lo <= hi <= n
+     */
+    T rangeSum(int lo, int hi) const;
+
+    /**
+     * @brief 前缀和首次达到 target 的前缀长度（元素须非负），O(log n)
+     * @param target 目标值
+     * @return 最小的 k 使 prefixSum(k) >= target；全部元素之和仍小于 target 时返回 n + 1
+     */
+    int lowerBound(const T& target) const;
+
+    /**
+     * @brief 获取元素个数
+     * @return 元素个数
+     */
+    int size() const { return n; }
+};
+
+// ================== 实现部分 ==================
+
+// 构造函数
+template<typename T>
+FenwickTree<T>::FenwickTree(int n) : tree(n < 0 ? 0 : n + 1), n(0), topBit(0) {
+    if (n < 0) throw std::length_error("Negative size");
+    resetSize(n);
+}
+
+// 记录元素个数并计算最高二次幂
+template<typename T>
+void FenwickTree<T>::resetSize(int count) {
+    n = count;
+    topBit = 1;
+    while (topBit * 2 <= n && topBit * 2 > 0) topBit *= 2;
+}
+
+// O(n) 构建：先把元素放到各自位置，再把每个节点的和一次性加到其父节点 i + lowbit(i)
+template<typename T>
+void FenwickTree<T>::build(const T* values, int count) {
+    if (count < 0) throw std::length_error("Negative size");
+    Vector<T> fresh(count + 1);
+    for (int i = 1; i <= count; ++i) fresh[i] = values[i - 1];
+    for (int i = 1; i <= count; ++i) {
+        int parent = i + (i & -i);
+        if (parent <= count) fresh[parent] += fresh[i];
+    }
+    tree.swap(fresh);
+    resetSize(count);
+}
+
+// 从 Array 构建
+template<typename T>
+void FenwickTree<T>::build(const Array<T>& values) {
+    int count = values.size();
+    build(count > 0 ? &values.unchecked_get(0) : nullptr, count);
+}
+
+// 从 Vector 构建
+template<typename T>
+void FenwickTree<T>::build(const Vector<T>& values) {
+    build(values.data(), values.size());
+}
+
+// 单点加：沿 i += lowbit(i) 更新所有覆盖该元素的节点
+template<typename T>
+void FenwickTree<T>::add(int index, const T& delta) {
+    DS_CHECK(index >= 0 && index < n, std::out_of_range, "Index out of range");
+    for (int i = index + 1; i <= n; i += i & -i) tree[i] += delta;
+}
+
+// 单点赋值
+template<typename T>
+void FenwickTree<T>::set(int index, const T& value) {
+    add(index, value - get(index));
+}
+
+// 读取单个元素：相邻两个前缀和之差
+template<typename T>
+T FenwickTree<T>::get(int index) const {
+    DS_CHECK(index >= 0 && index < n, std::out_of_range, "Index out of range");
+    return prefixSum(index + 1) - prefixSum(index);
+}
+
+// 前缀和：沿 i -= lowbit(i) 累加
+template<typename T>
+T FenwickTree<T>::prefixSum(int count) const {
+    DS_CHECK(count >= 0 && count <= n, std::out_of_range, "Index out of range");
+    T sum = T();
+    for (int i = count; i > 0; i -= i & -i) sum += tree[i];
+    return sum;
+}
+
+// 区间和
+template<typename T>
+T FenwickTree<T>::rangeSum(int lo, int hi) const {
+    DS_CHECK(lo >= 0 && lo <= hi && hi <= n, std::out_of_range, "Range out of bounds");
+    return prefixSum(hi) - prefixSum(lo);
+}
+
+// 二分下降：从最高二次幂开始，能跳过（前缀和仍小于 target）就跳过
+template<typename T>
+int FenwickTree<T>::lowerBound(const T& target) const {
+    if (!(T() < target)) return 0;
+    int pos = 0;
+    T sum = T();
+    for (int step = topBit; step > 0; step >>= 1) {
+        int next = pos + step;
+        if (next <= n && sum + tree[next] < target) {
+            pos = next;
+            sum += tree[next];
+        }
+    }
+    return pos + 1;
+}
@@ -0,0 +1,210 @@
+#pragma once
+#include "array.hpp"
+#include "../../linklist/include/bloomFilter.hpp"
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+
+/**
+ * @brief 带布隆过滤器的顺序表模板类
+ *
+ * 在 Array 之外维护一个分块布隆过滤器：insert/set 写入的值加入过滤器，
+ * search/contains 先查过滤器，“一定不存在”时 O(1) 返回，只有可能存在时才线性扫描。
+ *
+ * remove 删除的值和 set 覆盖掉的旧值仍留在过滤器中，计入“过期”计数；
+ * 过期数超过 当前长度×重建比例 时，或过滤器加入数超过其预期容量时，按当前内容重建。
+ *
+ * @tparam T 元素类型（需可比较相等、可哈希）
+ * @tparam Hash 哈希函数，默认为 std::hash<T>
+ */
+template<typename T, typename Hash = std::hash<T>>
+class FilteredArray {
+public:
+    static const int MIN_FILTER_ITEMS = 64;   ///< 过滤器的最小预期容量
+
+private:
+    Array<T> items;                  ///< 底层顺序表
+    BloomFilter<T, Hash> filter;     ///< 成员过滤器
+    double targetRate;               ///< 目标误判率
+    double rebuildRatio;             ///< 过期数 / 长度 超过该比例时重建
+    int stale;                       ///< 自上次重建以来删除或覆盖的值的个数
+    std::size_t rebuildTimes;        ///< 累计重建次数
+
+    /**
+     * @brief 过期过多或过滤器超出容量时重建
+     */
+    void maybeRebuild();
+
+public:
+    /**
+     * @brief 构造函数，过滤器按数组容量分配
+     * @param capacity 数组容量
+     * @param falsePositiveRate 目标误判率，范围 (0, 1)
+     * @param rebuildRatio 重建比例，过期数超过 长度×该比例 时重建，必须大于0
+     * @throws std::invalid_argument 如果参数不合法
+     */
+    explicit FilteredArray(int capacity, double falsePositiveRate = 0.01, double rebuildRatio = 0.25);
+
+    /**
+     * @brief 获取指定位置的元素
+     * @param index 元素索引
+     * @return 元素值
+     * @throws std::out_of_range 如果索引越界
+     */
+    T get(int index) const { return items.get(index); }
+
+    /**
+     * @brief 修改指定位置的元素，新值加入过滤器，旧值计入过期
+     * @param index 元素索引
+     * @param value 新值
+     * @throws std::out_of_range 如果索引越界
+     */
+    void set(int index, const T& value);
+
+    /**
+     * @brief 在指定位置插入元素，并加入过滤器
+     * @param index 插入位置
+     * @param value 插入的元素
+     * @throws std::out_of_range 如果索引越界
+     * @throws std::overflow_error 如果数组已满
+     */
+    void insert(int index, const T& value);
+
+    /**
+     * @brief 删除指定位置的元素，过期数加一，必要时重建过滤器
+     * @param index 删除位置
+     * @throws std::out_of_range 如果索引越界
+     */
+    void remove(int index);
+
+    /**
+     * @brief 扩展数组容量（过滤器在加入数超出容量时自动扩大）
+     * @param enlarge 扩容的大小
+     */
+    void extend(int enlarge) { items.extend(enlarge); }
+
+    /**
+     * @brief 查找元素，过滤器判定不存在时 O(1) 返回
+     * @param value 查找的元素
+     * @return 元素索引，未找到返回-1
+     */
+    int search(const T& value) const;
+
+    /**
+     * @brief 判断元素是否存在
+     * @param value 元素
+     * @return 存在返回true，否则返回false
+     */
+    bool contains(const T& value) const { return search(value) >= 0; }
+
+    /**
+     * @brief 按当前元素重建过滤器，清除所有过期位
+     */
+    void rebuild();
+
+    /**
+     * @brief 获取当前元素个数
+     * @return 元素个数
+     */
+    int size() const { return items.size(); }
+
+    /**
+     * @brief 判断数组是否为空
+     * @return 为空返回true，否则返回false
+     */
+    bool isEmpty() const { return items.isEmpty(); }
+
+    /**
+     * @brief 判断数组是否已满
+     * @return 已满返回true，否则返回false
+     */
+    bool isFull() const { return items.isFull(); }
+
+    /**
+     * @brief 自上次重建以来删除或覆盖的值的个数
+     * @return 过期数
+     */
+    int staleCount() const { return stale; }
+
+    /**
+     * @brief 累计重建次数
+     * @return 次数
+     */
+    std::size_t rebuilds() const { return rebuildTimes; }
+
+    /**
+     * @brief 只读访问过滤器（查看大小、填充率等）
+     * @return 过滤器的常量引用
+     */
+    const BloomFilter<T, Hash>& bloom() const { return filter; }
+};
+
+// ================== 实现部分 ==================
+
+template<typename T, typename Hash> const int FilteredArray<T, Hash>::MIN_FILTER_ITEMS;
+
+// 构造函数
+template<typename T, typename Hash>
+FilteredArray<T, Hash>::FilteredArray(int capacity, double falsePositiveRate, double rebuildRatio)
+    : items(capacity),
+      filter(capacity > MIN_FILTER_ITEMS ? capacity : MIN_FILTER_ITEMS, falsePositiveRate),
+      targetRate(falsePositiveRate), rebuildRatio(rebuildRatio), stale(0), rebuildTimes(0) {
+    if (!(rebuildRatio > 0.0)) {
+        throw std::invalid_argument("Rebuild ratio must be positive");
+    }
+}
+
+// 修改元素：值未变时不动过滤器
+template<typename T, typename Hash>
+void FilteredArray<T, Hash>::set(int index, const T& value) {
+    T old = items.get(index);
+    items.set(index, value);
+    if (old == value) return;
+    filter.add(value);
+    ++stale;
+    maybeRebuild();
+}
+
+// 插入：先插入顺序表（可能抛出异常），再加入过滤器
+template<typename T, typename Hash>
+void FilteredArray<T, Hash>::insert(int index, const T& value) {
+    items.insert(index, value);
+    filter.add(value);
+    maybeRebuild();
+}
+
+// 删除：过滤器无法删除，只记过期数
+template<typename T, typename Hash>
+void FilteredArray<T, Hash>::remove(int index) {
+    items.remove(index);
+    ++stale;
+    maybeRebuild();
+}
+
+// 查找：先查过滤器，可能存在时再扫描
+template<typename T, typename Hash>
+int FilteredArray<T, Hash>::search(const T& value) const {
+    if (!filter.mayContain(value)) return -1;
+    return items.search(value);
+}
+
+// 按当前长度的两倍分配过滤器并重新加入全部元素
+template<typename T, typename Hash>
+void FilteredArray<T, Hash>::rebuild() {
+    int n = items.size();
+    filter.reset(n * 2 > MIN_FILTER_ITEMS ? n * 2 : MIN_FILTER_ITEMS, targetRate);
+    for (int i = 0; i < n; ++i) {
+        filter.add(items.get(i));
+    }
+    stale = 0;
+    ++rebuildTimes;
+}
+
+// 过期数超过比例（长度过小时按最小容量计），或过滤器加入数超出预期容量时重建
+template<typename T, typename Hash>
+void FilteredArray<T, Hash>::maybeRebuild() {
+    int base = items.size() > MIN_FILTER_ITEMS ? items.size() : MIN_FILTER_ITEMS;
+    if (stale > rebuildRatio * base || filter.count() > filter.capacity()) {
+        rebuild();
+    }
+}
@@ -0,0 +1,349 @@
+#pragma once
+#include <algorithm>
+#include <stdexcept>
+
+/**
+ * @brief 间隙缓冲数组模板类
+ *
+ * 在连续内存中保留一段空闲的“间隙”，元素分布在间隙两侧。插入/删除时先把间隙移动到
+ * 编辑位置，再在间隙边界上写入或回收一个槽位。连续在同一位置附近编辑时间隙几乎不动，
+ * 插入/删除均摊 O(1)；下标访问只多一次比较，仍为 O(1)。间隙用尽时容量翻倍。
+ *
+ * 内存布局：[0, gapStart) 与 [gapEnd, capacity) 存放元素，[gapStart, gapEnd) 为间隙。
+ *
+ * @tparam T 元素类型，需可默认构造与赋值
+ */
+template<typename T>
+class GapArray {
+private:
+    T* data;         ///< 指向数组数据的指针
+    int capacity;    ///< 数组容量（元素个数 + 间隙长度）
+    int gapStart;    ///< 间隙起点，也是间隙前的元素个数
+    int gapEnd;      ///< 间隙终点（不含）
+
+    int physical(int index) const { return index < gapStart ? index : index + (gapEnd - gapStart); }
+    void grow(int minGap);
+
+public:
+    /**
+     * @brief 构造函数，初始化指定容量的空数组
+     * @param capacity 初始容量，至少为1
+     */
+    explicit GapArray(int capacity = 16);
+
+    /**
+     * @brief 拷贝构造函数
+     * @param other 被拷贝的数组
+     */
+    GapArray(const GapArray& other);
+
+    /**
+     * @brief 赋值操作符重载
+     * @param other 被赋值的数组
+     * @return 当前对象的引用
+     */
+    GapArray& operator=(const GapArray& other);
+
+    /**
+     * @brief 析构函数，释放内存
+     */
+    ~GapArray();
+
+    /**
+     * @brief 获取指定索引的元素，O(1)
+     * @param index 元素索引
+     * @return 索引处的元素
+     * @throws std::out_of_range 如果索引越界
+     */
+    T get(int index) const;
+
+    /**
+     * @brief 设置指定索引的元素值，O(1)
+     * @param index 元素索引
+     * @param value 新值
+     * @throws std::out_of_range 如果索引越界
+     */
+    void set(int index, const T& value);
+
+    /**
+     * @brief 在指定位置插入元素，距上次编辑位置 d 时为 O(d)，间隙用尽时自动扩容
+     * @param index 插入位置
+     * @param value 插入的元素
+     * @throws std::out_of_range 如果索引越界
+     */
+    void insert(int index, const T& value);
+
+    /**
+     * @brief 在指定位置连续插入 count 个元素
+     * @param index 插入位置
+     * @param values 待插入元素的首地址
+     * @param count 元素个数
+     * @throws std::out_of_range 如果索引越界
+     */
+    void insert(int index, const T* values, int count);
+
+    /**
+     * @brief 删除指定位置的元素，距上次编辑位置 d 时为 O(d)
+     * @param index 删除位置
+     * @throws std::out_of_range 如果索引越界
+     */
+    void remove(int index);
+
+    /**
+     * @brief 删除 [index, index + count) 内的元素
+     * @param index 起始位置
+     * @param count 删除个数
+     * @throws std::out_of_range 如果区间越界
+     */
+    void remove(int index, int count);
+
+    /**
+     * @brief 在末尾追加元素
+     * @param value 追加的元素
+     */
+    void push_back(const T& value) { insert(size(), value); }
+
+    /**
+     * @brief 把间隙移动到指定位置（例如光标处），之后在该位置附近编辑不再搬移元素
+     * @param index 目标位置，范围 [0, size()]
+     * @throws std::out_of_range 如果索引越界
+     */
+    void moveGap(int index);
+
+    /**
+     * @brief 扩展数组容量（加宽间隙）
+     * @param enlarge 扩容的大小
+     */
+    void extend(int enlarge);
+
+    /**
+     * @brief 查找元素，返回其索引
+     * @param value 查找的元素
+     * @return 元素索引，未找到返回-1
+     */
+    int search(const T& value) const;
+
+    /**
+     * @brief 按顺序访问全部元素，间隙两侧各是一段连续内存
+     * @param visit 回调 visit(value)
+     */
+    template<typename F>
+    void forEach(F visit) const;
+
+    /**
+     * @brief 清空数组，保留容量
+     */
+    void clear() { gapStart = 0; gapEnd = capacity; }
+
+    /**
+     * @brief 获取当前元素个数
+     * @return 元素个数
+     */
+    int size() const { return capacity - (gapEnd - gapStart); }
+
+    /**
+     * @brief 判断数组是否为空
+     * @return 为空返回true，否则返回false
+     */
+    bool isEmpty() const { return size() == 0; }
+
+    /**
+     * @brief 判断间隙是否已用尽（再插入将触发扩容）
+     * @return 已满返回true，否则返回false
+     */
+    bool isFull() const { return gapStart == gapEnd; }
+
+    /**
+     * @brief 获取容量
+     * @return 容量
+     */
+    int getCapacity() const { return capacity; }
+
+    /**
+     * @brief 获取间隙当前所在的位置
+     * @return 间隙前的元素个数
+     */
+    int gapPosition() const { return gapStart; }
+
+    /**
+     * @brief 交换两个数组
+     * @param other 另一个数组
+     */
+    void swap(GapArray& other);
+};
+
+// ================== 实现部分 ==================
+
+// 构造函数，整块容量都是间隙
+template<typename T>
+GapArray<T>::GapArray(int capacity)
+    : data(nullptr), capacity(capacity < 1 ? 1 : capacity), gapStart(0), gapEnd(0) {
+    data = new T[this->capacity];
+    gapEnd = this->capacity;
+}
+
+// 拷贝构造函数，连同间隙位置一起深拷贝
+template<typename T>
+GapArray<T>::GapArray(const GapArray& other)
+    : data(new T[other.capacity]), capacity(other.capacity), gapStart(other.gapStart), gapEnd(other.gapEnd) {
+    std::copy(other.data, other.data + gapStart, data);
+    std::copy(other.data + gapEnd, other.data + capacity, data + gapEnd);
+}
+
+// 赋值操作符重载，拷贝并交换
+template<typename T>
+GapArray<T>& GapArray<T>::operator=(const GapArray& other) {
+    if (this != &other) {
+        GapArray copy(other);
+        swap(copy);
+    }
+    return *this;
+}
+
+// 析构函数，释放内存
+template<typename T>
+GapArray<T>::~GapArray() {
+    delete[] data;
+}
+
+// 扩容：新容量至少翻倍，且间隙不小于 minGap；间隙保持在原位置
+template<typename T>
+void GapArray<T>::grow(int minGap) {
+    int count = size();
+    int newCapacity = capacity * 2;
+    if (newCapacity - count < minGap) newCapacity = count + minGap;
+    T* newData = new T[newCapacity];
+    int tail = capacity - gapEnd;
+    std::move(data, data + gapStart, newData);
+    std::move(data + gapEnd, data + capacity, newData + newCapacity - tail);
+    delete[] data;
+    data = newData;
+    gapEnd = newCapacity - tail;
+    capacity = newCapacity;
+}
+
+// 获取指定索引的元素
+template<typename T>
+T GapArray<T>::get(int index) const {
+    if (index < 0 || index >= size()) {
+        throw std::out_of_range("Index out of range");
+    }
+    return data[physical(index)];
+}
+
+// 设置指定索引的元素
+template<typename T>
+void GapArray<T>::set(int index, const T& value) {
+    if (index < 0 || index >= size()) {
+        throw std::out_of_range("Index out of range");
+    }
+    data[physical(index)] = value;
+}
+
+// 移动间隙：只搬移间隙与目标位置之间的元素
+template<typename T>
+void GapArray<T>::moveGap(int index) {
+    if (index < 0 || index > size()) {
+        throw std::out_of_range("Index out of range");
+    }
+    if (index < gapStart) {
+        // [index, gapStart) 整体右移到间隙末端
+        int k = gapStart - index;
+        std::move_backward(data + index, data + gapStart, data + gapEnd);
+        gapStart -= k;
+        gapEnd -= k;
+    } else if (index > gapStart) {
+        // 间隙之后的 index - gapStart 个元素左移到间隙起点
+        int k = index - gapStart;
+        std::move(data + gapEnd, data + gapEnd + k, data + gapStart);
+        gapStart += k;
+        gapEnd += k;
+    }
+}
+
+// 在指定位置插入元素
+template<typename T>
+void GapArray<T>::insert(int index, const T& value) {
+    if (index < 0 || index > size()) {
+        throw std::out_of_range("Index out of range");
+    }
+    if (gapStart == gapEnd) grow(1);
+    moveGap(index);
+    data[gapStart++] = value;
+}
+
+// 在指定位置连续插入多个元素
+template<typename T>
+void GapArray<T>::insert(int index, const T* values, int count) {
+    if (index < 0 || index > size() || count < 0) {
+        throw std::out_of_range("Index out of range");
+    }
+    if (count == 0) return;
+    if (gapEnd - gapStart < count) grow(count);
+    moveGap(index);
+    std::copy(values, values + count, data + gapStart);
+    gapStart += count;
+}
+
+// 删除指定位置的元素
+template<typename T>
+void GapArray<T>::remove(int index) {
+    if (index < 0 || index >= size()) {
+        throw std::out_of_range("Index out of range");
+    }
+    moveGap(index);
+    ++gapEnd;
+}
+
+// 删除一段连续元素：间隙移到起点后直接加宽
+template<typename T>
+void GapArray<T>::remove(int index, int count) {
+    if (index < 0 || count < 0 || index + count > size()) {
+        throw std::out_of_range("Index out of range");
+    }
+    moveGap(index);
+    gapEnd += count;
+}
+
+// 扩展数组容量
+template<typename T>
+void GapArray<T>::extend(int enlarge) {
+    if (enlarge <= 0) return;
+    T* newData = new T[capacity + enlarge];
+    int tail = capacity - gapEnd;
+    std::move(data, data + gapStart, newData);
+    std::move(data + gapEnd, data + capacity, newData + capacity + enlarge - tail);
+    delete[] data;
+    data = newData;
+    capacity += enlarge;
+    gapEnd = capacity - tail;
+}
+
+// 查找元素，返回其索引
+template<typename T>
+int GapArray<T>::search(const T& value) const {
+    for (int i = 0; i < gapStart; ++i) {
+        if (data[i] == value) return i;
+    }
+    for (int i = gapEnd; i < capacity; ++i) {
+        if (data[i] == value) return i - (gapEnd - gapStart);
+    }
+    return -1;
+}
+
+// 按顺序访问：先间隙前一段，再间隙后一段
+template<typename T>
+template<typename F>
+void GapArray<T>::forEach(F visit) const {
+    for (int i = 0; i < gapStart; ++i) visit(data[i]);
+    for (int i = gapEnd; i < capacity; ++i) visit(data[i]);
+}
+
+// 交换两个数组
+template<typename T>
+void GapArray<T>::swap(GapArray& other) {
+    std::swap(data, other.data);
+    std::swap(capacity, other.capacity);
+    std::swap(gapStart, other.gapStart);
+    std::swap(gapEnd, other.gapEnd);
+}
@@ -0,0 +1,370 @@
+#pragma once
+#include "gapArray.hpp"
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+/**
+ * @brief 分块绳索数组模板类
+ *
+ * 把序列切成若干叶子块，每块是一个容量固定的 GapArray（约4KB），块的元素个数由
+ * 树状数组（Fenwick 树）维护前缀和。按下标定位只需在树状数组上二分下降，O(log m)，
+ * m 为块数；编辑只搬移所在块内的元素，块内再由间隙缓冲吸收局部编辑。
+ *
+ * - 块满时对半分裂，相邻两块合计不超过半块时合并，分裂/合并后重建树状数组 O(m)
+ * - 缓存最近一次编辑所在的块及其起始下标，光标附近的连续编辑不必重新定位；
+ *   只有非 const 的编辑会更新缓存，const 读取只读缓存，并发的 const 访问互不干扰
+ * - 适合元素数远超单个 GapArray 合适规模、编辑位置又分散在多处的超长序列
+ *
+ * @tparam T 元素类型，需可默认构造与赋值
+ */
+template<typename T>
+class RopeArray {
+public:
+    /// 每个叶子块的容量：约4KB，至少64个元素
+    static const int LEAF_CAPACITY = 4096 / sizeof(T) < 64 ? 64 : static_cast<int>(4096 / sizeof(T));
+
+private:
+    std::vector<GapArray<T>*> leaves;   ///< 叶子块，始终至少有一块
+    std::vector<int> tree;              ///< 树状数组，tree[i] 覆盖若干块的元素个数（下标从1开始）
+    int topBit;                         ///< 不超过块数的最高二次幂，供二分下降使用
+    int length;                         ///< 元素总数
+    int hintLeaf;                       ///< 最近编辑的块，-1 表示无效
+    int hintStart;                      ///< 最近编辑的块的起始下标
+
+    void rebuild();
+    void add(int leaf, int delta);
+    int locate(int index, int& offset, bool forInsert) const;
+    int locateForEdit(int index, int& offset, bool forInsert);
+    void split(int leaf);
+    void mergeAround(int leaf);
+
+public:
+    /**
+     * @brief 构造函数，初始化空序列
+     */
+    RopeArray();
+
+    /**
+     * @brief 拷贝构造函数
+     * @param other 被拷贝的序列
+     */
+    RopeArray(const RopeArray& other);
+
+    /**
+     * @brief 赋值操作符重载
+     * @param other 被赋值的序列
+     * @return 当前对象的引用
+     */
+    RopeArray& operator=(const RopeArray& other);
+
+    /**
+     * @brief 析构函数，释放所有叶子块
+     */
+    ~RopeArray();
+
+    /**
+     * @brief 获取指定索引的元素，O(log m)
+     * @param index 元素索引
+     * @return 索引处的元素
+     * @throws std::out_of_range 如果索引越界
+     */
+    T get(int index) const;
+
+    /**
+     * @brief 设置指定索引的元素值，O(log m)
+     * @param index 元素索引
+     * @param value 新值
+     * @throws std::out_of_range 如果索引越界
+     */
+    void set(int index, const T& value);
+
+    /**
+     * @brief 在指定位置插入元素，O(log m + 块内搬移)，块满时分裂
+     * @param index 插入位置
+     * @param value 插入的元素
+     * @throws std::out_of_range 如果索引越界
+     */
+    void insert(int index, const T& value);
+
+    /**
+     * @brief 删除指定位置的元素，O(log m + 块内搬移)，块过空时与相邻块合并
+     * @param index 删除位置
+     * @throws std::out_of_range 如果索引越界
+     */
+    void remove(int index);
+
+    /**
+     * @brief 在末尾追加元素
+     * @param value 追加的元素
+     */
+    void push_back(const T& value) { insert(length, value); }
+
+    /**
+     * @brief 查找元素，返回其索引
+     * @param value 查找的元素
+     * @return 元素索引，未找到返回-1
+     */
+    int search(const T& value) const;
+
+    /**
+     * @brief 按顺序访问全部元素
+     * @param visit 回调 visit(value)
+     */
+    template<typename F>
+    void forEach(F visit) const;
+
+    /**
+     * @brief 清空序列，只保留一个空块
+     */
+    void clear();
+
+    /**
+     * @brief 获取当前元素个数
+     * @return 元素个数
+     */
+    int size() const { return length; }
+
+    /**
+     * @brief 判断序列是否为空
+     * @return 为空返回true，否则返回false
+     */
+    bool isEmpty() const { return length == 0; }
+
+    /**
+     * @brief 获取叶子块个数
+     * @return 块数
+     */
+    int leafCount() const { return static_cast<int>(leaves.size()); }
+
+    /**
+     * @brief 交换两个序列
+     * @param other 另一个序列
+     */
+    void swap(RopeArray& other);
+};
+
+// ================== 实现部分 ==================
+
+// 构造函数，创建一个空块
+template<typename T>
+RopeArray<T>::RopeArray() : topBit(1), length(0), hintLeaf(-1), hintStart(0) {
+    leaves.push_back(new GapArray<T>(LEAF_CAPACITY));
+    rebuild();
+}
+
+// 拷贝构造函数，逐块深拷贝
+template<typename T>
+RopeArray<T>::RopeArray(const RopeArray& other)
+    : tree(other.tree), topBit(other.topBit), length(other.length), hintLeaf(-1), hintStart(0) {
+    try {
+        for (size_t i = 0; i < other.leaves.size(); ++i)
+            leaves.push_back(new GapArray<T>(*other.leaves[i]));
+    } catch (...) {
+        for (size_t i = 0; i < leaves.size(); ++i) delete leaves[i];
+        throw;
+    }
+}
+
+// 赋值操作符重载，拷贝并交换
+template<typename T>
+RopeArray<T>& RopeArray<T>::operator=(const RopeArray& other) {
+    if (this != &other) {
+        RopeArray copy(other);
+        swap(copy);
+    }
+    return *this;
+}
+
+// 析构函数，释放所有叶子块
+template<typename T>
+RopeArray<T>::~RopeArray() {
+    for (size_t i = 0; i < leaves.size(); ++i) delete leaves[i];
+}
+
+// 按当前各块大小重建树状数组，O(m)
+template<typename T>
+void RopeArray<T>::rebuild() {
+    int m = static_cast<int>(leaves.size());
+    tree.assign(m + 1, 0);
+    for (int i = 1; i <= m; ++i) {
+        tree[i] += leaves[i - 1]->size();
+        int parent = i + (i & -i);
+        if (parent <= m) tree[parent] += tree[i];
+    }
+    topBit = 1;
+    while (topBit * 2 <= m) topBit *= 2;
+    hintLeaf = -1;
+}
+
+// 第 leaf 块的元素个数变化 delta
+template<typename T>
+void RopeArray<T>::add(int leaf, int delta) {
+    int m = static_cast<int>(leaves.size());
+    for (int i = leaf + 1; i <= m; i += i & -i) tree[i] += delta;
+}
+
+// 定位下标所在的块与块内偏移。插入时允许落在块尾，使末尾追加与光标处插入留在当前块
+template<typename T>
+int RopeArray<T>::locate(int index, int& offset, bool forInsert) const {
+    if (hintLeaf >= 0) {
+        int end = hintStart + leaves[hintLeaf]->size();
+        if (index >= hintStart && (index < end || (forInsert && index == end))) {
+            offset = index - hintStart;
+            return hintLeaf;
+        }
+    }
+    // 在树状数组上二分下降：找到前缀和不超过 index 的最多块数
+    int m = static_cast<int>(leaves.size());
+    int pos = 0, rest = index;
+    for (int step = topBit; step > 0; step >>= 1) {
+        if (pos + step <= m && tree[pos + step] <= rest) {
+            pos += step;
+            rest -= tree[pos];
+        }
+    }
+    if (pos == m) {
+        // index == length：落在最后一块的末尾
+        pos = m - 1;
+        rest = leaves[pos]->size();
+    }
+    offset = rest;
+    return pos;
+}
+
+// 编辑前定位，并把所在块记为缓存，供光标附近的后续编辑直接命中
+template<typename T>
+int RopeArray<T>::locateForEdit(int index, int& offset, bool forInsert) {
+    int leaf = locate(index, offset, forInsert);
+    hintLeaf = leaf;
+    hintStart = index - offset;
+    return leaf;
+}
+
+// 满块对半分裂，后半段移入新块
+template<typename T>
+void RopeArray<T>::split(int leaf) {
+    GapArray<T>* left = leaves[leaf];
+    std::unique_ptr<GapArray<T> > right(new GapArray<T>(LEAF_CAPACITY));
+    int half = left->size() / 2;
+    for (int i = half; i < left->size(); ++i) right->push_back(left->get(i));
+    leaves.insert(leaves.begin() + leaf + 1, right.get());
+    right.release();
+    left->remove(half, left->size() - half);
+    rebuild();
+}
+
+// 空块直接删除；块过空时与相邻块合并，合计不超过半块才合并，避免反复分裂合并
+template<typename T>
+void RopeArray<T>::mergeAround(int leaf) {
+    int m = static_cast<int>(leaves.size());
+    if (m == 1) return;
+    if (leaves[leaf]->size() == 0) {
+        delete leaves[leaf];
+        leaves.erase(leaves.begin() + leaf);
+        rebuild();
+        return;
+    }
+    if (leaves[leaf]->size() >= LEAF_CAPACITY / 4) return;
+    int first = leaf + 1 < m ? leaf : leaf - 1;
+    GapArray<T>* a = leaves[first];
+    GapArray<T>* b = leaves[first + 1];
+    if (a->size() + b->size() > LEAF_CAPACITY / 2) return;
+    b->forEach([a](const T& value) { a->push_back(value); });
+    delete b;
+    leaves.erase(leaves.begin() + first + 1);
+    rebuild();
+}
+
+// 获取指定索引的元素
+template<typename T>
+T RopeArray<T>::get(int index) const {
+    if (index < 0 || index >= length) {
+        throw std::out_of_range("Index out of range");
+    }
+    int offset;
+    int leaf = locate(index, offset, false);
+    return leaves[leaf]->get(offset);
+}
+
+// 设置指定索引的元素
+template<typename T>
+void RopeArray<T>::set(int index, const T& value) {
+    if (index < 0 || index >= length) {
+        throw std::out_of_range("Index out of range");
+    }
+    int offset;
+    int leaf = locateForEdit(index, offset, false);
+    leaves[leaf]->set(offset, value);
+}
+
+// 在指定位置插入元素
+template<typename T>
+void RopeArray<T>::insert(int index, const T& value) {
+    if (index < 0 || index > length) {
+        throw std::out_of_range("Index out of range");
+    }
+    int offset;
+    int leaf = locateForEdit(index, offset, true);
+    if (leaves[leaf]->size() == LEAF_CAPACITY) {
+        split(leaf);
+        leaf = locateForEdit(index, offset, true);
+    }
+    leaves[leaf]->insert(offset, value);
+    add(leaf, 1);
+    ++length;
+}
+
+// 删除指定位置的元素
+template<typename T>
+void RopeArray<T>::remove(int index) {
+    if (index < 0 || index >= length) {
+        throw std::out_of_range("Index out of range");
+    }
+    int offset;
+    int leaf = locateForEdit(index, offset, false);
+    leaves[leaf]->remove(offset);
+    add(leaf, -1);
+    --length;
+    mergeAround(leaf);
+}
+
+// 查找元素，返回其索引
+template<typename T>
+int RopeArray<T>::search(const T& value) const {
+    int start = 0;
+    for (size_t i = 0; i < leaves.size(); ++i) {
+        int pos = leaves[i]->search(value);
+        if (pos >= 0) return start + pos;
+        start += leaves[i]->size();
+    }
+    return -1;
+}
+
+// 按顺序访问全部元素
+template<typename T>
+template<typename F>
+void RopeArray<T>::forEach(F visit) const {
+    for (size_t i = 0; i < leaves.size(); ++i) leaves[i]->forEach(visit);
+}
+
+// 清空序列，只保留一个空块
+template<typename T>
+void RopeArray<T>::clear() {
+    for (size_t i = 1; i < leaves.size(); ++i) delete leaves[i];
+    leaves.resize(1);
+    leaves[0]->clear();
+    length = 0;
+    rebuild();
+}
+
+// 交换两个序列
+template<typename T>
+void RopeArray<T>::swap(RopeArray& other) {
+    leaves.swap(other.leaves);
+    tree.swap(other.tree);
+    std::swap(topBit, other.topBit);
+    std::swap(length, other.length);
+    std::swap(hintLeaf, other.hintLeaf);
+    std::swap(hintStart, other.hintStart);
+}
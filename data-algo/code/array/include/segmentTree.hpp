@@ -0,0 +1,424 @@
+#pragma once
+#include "array.hpp"
+#include "../../common/include/dsCheck.hpp"
+#include "../../vector/code/vector.hpp"
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+/**
+ * @brief 取较小值，单位元为 T 的最大值
+ */
+template<typename T>
+struct MinOp {
+    T operator()(const T& a, const T& b) const { return b < a ? b : a; }
+    static T identity() { return std::numeric_limits<T>::max(); }
+};
+
+/**
+ * @brief 取较大值，单位元为 T 的最小值
+ */
+template<typename T>
+struct MaxOp {
+    T operator()(const T& a, const T& b) const { return a < b ? b : a; }
+    static T identity() { return std::numeric_limits<T>::lowest(); }
+};
+
+/**
+ * @brief 自底向上的非递归线段树：单点修改、区间聚合
+ *
+ * 2n 个节点放在一个数组中：叶子 tree[n + i] 为第 i 个元素，内部节点 tree[i] = op(tree[2i], tree[2i+1])。
+ * 查询从两端叶子同时向上走，左右两侧的部分结果分别累积，最后按顺序合并，因此 op 只需满足结合律，
+ * 不要求交换律，n 也不必是二的幂。没有递归和指针，节点只占 2n 个 T。
+ *
+ * @tparam T 元素类型
+ * @tparam Op 满足结合律的二元运算，identity 为其单位元
+ */
+template<typename T, typename Op = std::plus<T>>
+class SegmentTree {
+private:
+    Vector<T> tree;   ///< tree[1..n) 为内部节点，tree[n..2n) 为叶子
+    int n;            ///< 元素个数
+    T unit;           ///< 单位元
+    Op op;            ///< 聚合运算
+
+public:
+    /**
+     * @brief 构造函数，n 个元素全为单位元
+     * @param n 元素个数
+     * @param identity 运算的单位元（加法为 0，最小值为 T 的最大值）
+     * @param op 聚合运算
+     * @throws std::length_error 如果 n 为负
+     */
+    explicit SegmentTree(int n = 0, const T& identity = T(), const Op& op = Op());
+
+    /**
+     * @brief 用已有数据 O(n) 构建，替换全部内容
+     * @param values 元素数组
+     * @param count 元素个数
+     */
+    void build(const T* values, int count);
+    void build(const Array<T>& values);
+    void build(const Vector<T>& values);
+
+    /**
+     * @brief 单点赋值，O(log n)
+     * @param index 元素下标
+     * @param value 新值
+     * @throws std::out_of_range 如果下标越界
+     */
+    void set(int index, const T& value);
+
+    /**
+     * @brief 读取单个元素，O(1)
+     * @param index 元素下标
+     * @return 元素值
+     * @throws std::out_of_range 如果下标越界
+     */
+    const T& get(int index) const;
+
+    /**
+     * @brief 区间聚合：op(a[lo], a[lo+1], ..., a[hi-1])，O(log n)
+     * @param lo 区间起点
+     * @param hi 区间终点（不含）
+     * @return 聚合结果，空区间返回单位元
+     * @throws std::out_of_range 如果不满足 0 <= lo <= hi <= n
+     */
+    T query(int lo, int hi) const;
+
+    /**
+     * @brief 获取元素个数
+     * @return 元素个数
+     */
+    int size() const { return n; }
+};
+
+/**
+ * @brief 区间加、区间求和的懒标记策略
+ */
+template<typename T>
+struct RangeAddSum {
+    typedef T Tag;
+    static Tag none() { return T(); }
+    static T apply(const Tag& tag, const T& sum, int length) { return sum + tag * static_cast<T>(length); }
+    static Tag compose(const Tag& newer, const Tag& older) { return newer + older; }
+};
+
+/**
+ * @brief 区间加、区间最小值/最大值的懒标记策略
+ */
+template<typename T>
+struct RangeAddMinMax {
+    typedef T Tag;
+    static Tag none() { return T(); }
+    static T apply(const Tag& tag, const T& extremum, int) { return extremum + tag; }
+    static Tag compose(const Tag& newer, const Tag& older) { return newer + older; }
+};
+
+/**
+ * @brief 区间赋值、区间求和的懒标记策略
+ */
+template<typename T>
+struct RangeAssignSum {
+    typedef std::pair<bool, T> Tag;   ///< first 为 false 表示没有待下传的赋值
+    static Tag none() { return Tag(false, T()); }
+    static T apply(const Tag& tag, const T& sum, int length) {
+        return tag.first ? tag.second * static_cast<T>(length) : sum;
+    }
+    static Tag compose(const Tag& newer, const Tag& older) { return newer.first ? newer : older; }
+};
+
+/**
+ * @brief 区间赋值、区间最小值/最大值的懒标记策略
+ */
+template<typename T>
+struct RangeAssignMinMax {
+    typedef std::pair<bool, T> Tag;   ///< first 为 false 表示没有待下传的赋值
+    static Tag none() { return Tag(false, T()); }
+    static T apply(const Tag& tag, const T& extremum, int) { return tag.first ? tag.second : extremum; }
+    static Tag compose(const Tag& newer, const Tag& older) { return newer.first ? newer : older; }
+};
+
+/**
+ * @brief 带懒标记的非递归线段树：区间修改、区间聚合
+ *
+ * 叶子数补齐到二的幂 width，节点 tree[1..2width) 放在一个数组中，内部节点另有一个懒标记数组 lazy[1..width)。
+ * 区间修改把标记打在覆盖区间的 O(log n) 个节点上，查询或修改经过某个节点前先把它的标记下传给两个孩子。
+ * 与 SegmentTree 一样从两端叶子向上处理，没有递归。
+ *
+ * 修改策略 Update 定义标记类型 Tag 与三个静态函数：
+ * - none()：空标记
+ * - apply(tag, value, length)：把标记作用到覆盖 length 个元素的节点聚合值上
+ * - compose(newer, older)：先后两个标记合成一个
+ *
+ * @tparam T 元素类型
+ * @tparam Op 满足结合律的二元运算
+ * @tparam Update 修改策略，如 RangeAddSum、RangeAddMinMax、RangeAssignSum、RangeAssignMinMax
+ */
+template<typename T, typename Op = std::plus<T>, typename Update = RangeAddSum<T>>
+class LazySegmentTree {
+public:
+    typedef typename Update::Tag Tag;
+
+private:
+    Vector<T> tree;     ///< tree[width + i] 为第 i 个元素
+    Vector<Tag> lazy;   ///< 内部节点待下传给孩子的标记
+    int n;              ///< 元素个数
+    int width;          ///< 叶子数（不小于 n 的二的幂）
+    int levels;         ///< log2(width)
+    T unit;             ///< 单位元
+    Op op;              ///< 聚合运算
+
+    void pull(int k) { tree[k] = op(tree[2 * k], tree[2 * k + 1]); }
+    void applyNode(int k, const Tag& tag, int length);
+    void push(int k, int length);
+    void pushPath(int lo, int hi);
+    void resize(int count);
+
+public:
+    /**
+     * @brief 构造函数，n 个元素全为单位元
+     * @param n 元素个数
+     * @param identity 运算的单位元
+     * @param op 聚合运算
+     * @throws std::length_error 如果 n 为负
+     */
+    explicit LazySegmentTree(int n = 0, const T& identity = T(), const Op& op = Op());
+
+    /**
+     * @brief 用已有数据 O(n) 构建，替换全部内容
+     * @param values 元素数组
+     * @param count 元素个数
+     */
+    void build(const T* values, int count);
+    void build(const Array<T>& values);
+    void build(const Vector<T>& values);
+
+    /**
+     * @brief 单点赋值，O(log n)
+     * @param index 元素下标
+     * @param value 新值
+     * @throws std::out_of_range 如果下标越界
+     */
+    void set(int index, const T& value);
+
+    /**
+     * @brief 读取单个元素，O(log n)（先下传路径上的标记）
+     * @param index 元素下标
+     * @return 元素值
+     * @throws std::out_of_range 如果下标越界
+     */
+    T get(int index);
+
+    /**
+     * @brief 区间修改：把标记作用到下标 [lo, hi) 的每个元素，O(log n)
+     * @param lo 区间起点
+     * @param hi 区间终点（不含）
+     * @param tag 修改标记，如 RangeAddSum 的增量
+     * @throws std::out_of_range 如果不满足 0 <= lo <= hi <= n
+     */
+    void update(int lo, int hi, const Tag& tag);
+
+    /**
+     * @brief 区间聚合，O(log n)（先下传两端路径上的标记，因此不是 const）
+     * @param lo 区间起点
+     * @param hi 区间终点（不含）
+     * @return 聚合结果，空区间返回单位元
+     * @throws std::out_of_range 如果不满足 0 <= lo <= hi <= n
+     */
+    T query(int lo, int hi);
+
+    /**
+     * @brief 获取元素个数
+     * @return 元素个数
+     */
+    int size() const { return n; }
+};
+
+// ================== 实现部分 ==================
+
+// 构造函数
+template<typename T, typename Op>
+SegmentTree<T, Op>::SegmentTree(int n, const T& identity, const Op& op)
+    : tree(n < 0 ? 0 : 2 * n, identity), n(n < 0 ? 0 : n), unit(identity), op(op) {
+    if (n < 0) throw std::length_error("Negative size");
+}
+
+// O(n) 构建：先填叶子，再自底向上计算内部节点
+template<typename T, typename Op>
+void SegmentTree<T, Op>::build(const T* values, int count) {
+    if (count < 0) throw std::length_error("Negative size");
+    Vector<T> fresh(2 * count, unit);
+    for (int i = 0; i < count; ++i) fresh[count + i] = values[i];
+    for (int i = count - 1; i > 0; --i) fresh[i] = op(fresh[2 * i], fresh[2 * i + 1]);
+    tree.swap(fresh);
+    n = count;
+}
+
+// 从 Array 构建
+template<typename T, typename Op>
+void SegmentTree<T, Op>::build(const Array<T>& values) {
+    int count = values.size();
+    build(count > 0 ? &values.unchecked_get(0) : nullptr, count);
+}
+
+// 从 Vector 构建
+template<typename T, typename Op>
+void SegmentTree<T, Op>::build(const Vector<T>& values) {
+    build(values.data(), values.size());
+}
+
+// 单点赋值：修改叶子后沿父节点向上重算
+template<typename T, typename Op>
+void SegmentTree<T, Op>::set(int index, const T& value) {
+    DS_CHECK(index >= 0 && index < n, std::out_of_range, "Index out of range");
+    int k = index + n;
+    tree[k] = value;
+    for (k >>= 1; k > 0; k >>= 1) tree[k] = op(tree[2 * k], tree[2 * k + 1]);
+}
+
+// 读取单个元素
+template<typename T, typename Op>
+const T& SegmentTree<T, Op>::get(int index) const {
+    DS_CHECK(index >= 0 && index < n, std::out_of_range, "Index out of range");
+    return tree[index + n];
+}
+
+// 区间聚合：左端右移、右端左移，左侧结果在右边追加，右侧结果在左边追加，保持元素顺序
+template<typename T, typename Op>
+T SegmentTree<T, Op>::query(int lo, int hi) const {
+    DS_CHECK(lo >= 0 && lo <= hi && hi <= n, std::out_of_range, "Range out of bounds");
+    T left = unit, right = unit;
+    for (lo += n, hi += n; lo < hi; lo >>= 1, hi >>= 1) {
+        if (lo & 1) left = op(left, tree[lo++]);
+        if (hi & 1) right = op(tree[--hi], right);
+    }
+    return op(left, right);
+}
+
+// 构造函数
+template<typename T, typename Op, typename Update>
+LazySegmentTree<T, Op, Update>::LazySegmentTree(int n, const T& identity, const Op& op)
+    : n(0), width(1), levels(0), unit(identity), op(op) {
+    if (n < 0) throw std::length_error("Negative size");
+    resize(n);
+}
+
+// 按元素个数重新分配：叶子数补齐到二的幂，全部节点置为单位元、标记置空
+template<typename T, typename Op, typename Update>
+void LazySegmentTree<T, Op, Update>::resize(int count) {
+    int leaves = 1, depth = 0;
+    while (leaves < count) {
+        leaves *= 2;
+        ++depth;
+    }
+    Vector<T> freshTree(2 * leaves, unit);
+    Vector<Tag> freshLazy(leaves, Update::none());
+    tree.swap(freshTree);
+    lazy.swap(freshLazy);
+    n = count;
+    width = leaves;
+    levels = depth;
+}
+
+// 把标记作用到节点 k（覆盖 length 个元素）；内部节点还要记下标记，留待下传
+template<typename T, typename Op, typename Update>
+void LazySegmentTree<T, Op, Update>::applyNode(int k, const Tag& tag, int length) {
+    tree[k] = Update::apply(tag, tree[k], length);
+    if (k < width) lazy[k] = Update::compose(tag, lazy[k]);
+}
+
+// 下传节点 k（覆盖 length 个元素）的标记
+template<typename T, typename Op, typename Update>
+void LazySegmentTree<T, Op, Update>::push(int k, int length) {
+    applyNode(2 * k, lazy[k], length / 2);
+    applyNode(2 * k + 1, lazy[k], length / 2);
+    lazy[k] = Update::none();
+}
+
+// 自顶向下下传叶子区间 [lo, hi)（已加 width）两端路径上的标记；
+// 端点恰好是某层节点的左边界时，该层节点完全在区间内或外，不必下传
+template<typename T, typename Op, typename Update>
+void LazySegmentTree<T, Op, Update>::pushPath(int lo, int hi) {
+    for (int i = levels; i >= 1; --i) {
+        if (((lo >> i) << i) != lo) push(lo >> i, 1 << i);
+        if (((hi >> i) << i) != hi) push((hi - 1) >> i, 1 << i);
+    }
+}
+
+// O(n) 构建
+template<typename T, typename Op, typename Update>
+void LazySegmentTree<T, Op, Update>::build(const T* values, int count) {
+    if (count < 0) throw std::length_error("Negative size");
+    resize(count);
+    for (int i = 0; i < count; ++i) tree[width + i] = values[i];
+    for (int k = width - 1; k > 0; --k) pull(k);
+}
+
+// 从 Array 构建
+template<typename T, typename Op, typename Update>
+void LazySegmentTree<T, Op, Update>::build(const Array<T>& values) {
+    int count = values.size();
+    build(count > 0 ? &values.unchecked_get(0) : nullptr, count);
+}
+
+// 从 Vector 构建
+template<typename T, typename Op, typename Update>
+void LazySegmentTree<T, Op, Update>::build(const Vector<T>& values) {
+    build(values.data(), values.size());
+}
+
+// 单点赋值：先下传根到叶子路径上的标记，再修改叶子并向上重算
+template<typename T, typename Op, typename Update>
+void LazySegmentTree<T, Op, Update>::set(int index, const T& value) {
+    DS_CHECK(index >= 0 && index < n, std::out_of_range, "Index out of range");
+    int k = index + width;
+    for (int i = levels; i >= 1; --i) push(k >> i, 1 << i);
+    tree[k] = value;
+    for (int i = 1; i <= levels; ++i) pull(k >> i);
+}
+
+// 读取单个元素
+template<typename T, typename Op, typename Update>
+T LazySegmentTree<T, Op, Update>::get(int index) {
+    DS_CHECK(index >= 0 && index < n, std::out_of_range, "Index out of range");
+    int k = index + width;
+    for (int i = levels; i >= 1; --i) push(k >> i, 1 << i);
+    return tree[k];
+}
+
+// 区间修改：下传两端路径，给覆盖区间的节点打标记，再沿两端路径向上重算
+template<typename T, typename Op, typename Update>
+void LazySegmentTree<T, Op, Update>::update(int lo, int hi, const Tag& tag) {
+    DS_CHECK(lo >= 0 && lo <= hi && hi <= n, std::out_of_range, "Range out of bounds");
+    if (lo == hi) return;
+    lo += width;
+    hi += width;
+    pushPath(lo, hi);
+    for (int l = lo, r = hi, length = 1; l < r; l >>= 1, r >>= 1, length <<= 1) {
+        if (l & 1) applyNode(l++, tag, length);
+        if (r & 1) applyNode(--r, tag, length);
+    }
+    for (int i = 1; i <= levels; ++i) {
+        if (((lo >> i) << i) != lo) pull(lo >> i);
+        if (((hi >> i) << i) != hi) pull((hi - 1) >> i);
+    }
+}
+
+// 区间聚合：下传两端路径后与 SegmentTree 相同
+template<typename T, typename Op, typename Update>
+T LazySegmentTree<T, Op, Update>::query(int lo, int hi) {
+    DS_CHECK(lo >= 0 && lo <= hi && hi <= n, std::out_of_range, "Range out of bounds");
+    if (lo == hi) return unit;
+    lo += width;
+    hi += width;
+    pushPath(lo, hi);
+    T left = unit, right = unit;
+    for (; lo < hi; lo >>= 1, hi >>= 1) {
+        if (lo & 1) left = op(left, tree[lo++]);
+        if (hi & 1) right = op(tree[--hi], right);
+    }
+    return op(left, right);
+}
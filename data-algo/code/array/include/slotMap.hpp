@@ -0,0 +1,315 @@
+#pragma once
+#include "array.hpp"
+#include "../../common/include/dsCheck.hpp"
+#include <utility>
+
+/**
+ * @brief 带代数句柄的对象池（slot map）
+ *
+ * 对象紧密存放在一个 Array<T> 中（稠密数组），遍历活动对象就是顺序扫描连续内存。
+ * 外部不持有稠密下标，而是持有句柄 {槽位, 代数}：
+ * - 槽位数组记录每个槽位当前对象在稠密数组中的下标和代数，空闲槽位串成空闲链表
+ * - 插入从空闲链表取槽位，追加到稠密数组末尾，O(1)（均摊）
+ * - 删除把稠密数组的最后一个对象移到被删位置并更新它的槽位，再把槽位放回空闲链表，O(1)
+ * - 槽位每次被占用或释放时代数加一：代数为奇数表示占用。句柄的代数与槽位不符即为过期句柄，
+ *   查找返回空，不会访问到复用该槽位的新对象
+ * - 代数即将回绕的槽位不再复用，过期句柄永远不会重新生效
+ *
+ * 删除会改变稠密数组中对象的顺序，稠密下标只在两次修改之间有效；句柄在对象删除前始终有效。
+ *
+ * @tparam T 元素类型（需可默认构造、可赋值）
+ */
+template<typename T>
+class SlotMap {
+public:
+    /**
+     * @brief 对象句柄，默认构造为空句柄
+     */
+    struct Handle {
+        int index;               ///< 槽位
+        unsigned generation;     ///< 创建时槽位的代数（奇数）
+
+        Handle() : index(-1), generation(0) {}
+        Handle(int index, unsigned generation) : index(index), generation(generation) {}
+        bool isNull() const { return index < 0; }
+        bool operator==(const Handle& other) const { return index == other.index && generation == other.generation; }
+        bool operator!=(const Handle& other) const { return !(*this == other); }
+    };
+
+private:
+    /// 槽位：占用时 target 为稠密下标，空闲时为空闲链表的下一个槽位（-1 表示结尾）
+    struct Slot {
+        unsigned generation;
+        int target;
+    };
+
+    static const unsigned RETIRED_GENERATION = ~0u - 1;   ///< 释放后达到该代数的槽位不再复用
+
+    Array<T> values;        ///< 稠密数组：活动对象
+    Array<int> owners;      ///< 稠密下标 -> 槽位
+    Array<Slot> slots;      ///< 槽位数组
+    int freeHead;           ///< 空闲链表头，-1 表示没有空闲槽位
+    int retired;            ///< 不再复用的槽位数
+
+    void releaseSlot(int index);
+
+public:
+    /**
+     * @brief 构造函数
+     * @param capacity 初始容量，满后按 2 倍扩容
+     */
+    explicit SlotMap(int capacity = 16);
+
+    /**
+     * @brief 插入对象
+     * @param value 对象
+     * @return 新对象的句柄
+     */
+    Handle insert(const T& value);
+
+    /**
+     * @brief 删除句柄指向的对象
+     * @param handle 句柄
+     * @return 句柄有效并删除返回true，过期或空句柄返回false
+     */
+    bool erase(const Handle& handle);
+
+    /**
+     * @brief 句柄是否有效
+     * @param handle 句柄
+     * @return 指向的对象仍存在返回true
+     */
+    bool contains(const Handle& handle) const;
+
+    /**
+     * @brief 查找句柄指向的对象
+     * @param handle 句柄
+     * @return 对象指针，过期或空句柄返回 nullptr；指针在下一次插入或删除前有效
+     */
+    T* find(const Handle& handle);
+    const T* find(const Handle& handle) const;
+
+    /**
+     * @brief 访问句柄指向的对象
+     * @param handle 句柄
+     * @return 对象引用
+     * @throws std::out_of_range 如果句柄过期或为空
+     */
+    T& at(const Handle& handle);
+    const T& at(const Handle& handle) const;
+
+    /**
+     * @brief 不抛异常的读取
+     * @param handle 句柄
+     * @param out 成功时写入对象
+     * @return 句柄有效返回true，否则返回false（out不变）
+     */
+    bool try_get(const Handle& handle, T& out) const;
+
+    /**
+     * @brief 不检查句柄的访问，调用者保证 contains(handle)
+     * @param handle 句柄
+     * @return 对象引用
+     */
+    T& unchecked_get(const Handle& handle) { return values.unchecked_get(slots.unchecked_get(handle.index).target); }
+    const T& unchecked_get(const Handle& handle) const {
+        return values.unchecked_get(slots.unchecked_get(handle.index).target);
+    }
+
+    /**
+     * @brief 按稠密下标访问活动对象，调用者保证 0 <= i < size()
+     * @param i 稠密下标
+     * @return 对象引用
+     */
+    T& valueAt(int i) { return values.unchecked_get(i); }
+    const T& valueAt(int i) const { return values.unchecked_get(i); }
+
+    /**
+     * @brief 稠密下标处对象的句柄，调用者保证 0 <= i < size()
+     * @param i 稠密下标
+     * @return 句柄
+     */
+    Handle handleAt(int i) const;
+
+    /**
+     * @brief 按稠密数组顺序访问全部活动对象
+     * @param visit 可调用对象 visit(T&)
+     */
+    template<typename F>
+    void forEach(F visit);
+
+    /**
+     * @brief 删除全部对象，已发出的句柄全部失效
+     */
+    void clear();
+
+    /**
+     * @brief 为 n 个对象预留容量
+     * @param n 对象个数
+     */
+    void reserve(int n);
+
+    /**
+     * @brief 活动对象个数
+     * @return 对象个数
+     */
+    int size() const { return values.size(); }
+
+    /**
+     * @brief 判断是否为空
+     * @return 为空返回true
+     */
+    bool isEmpty() const { return values.isEmpty(); }
+
+    /**
+     * @brief 已分配的槽位数（包括空闲与不再复用的槽位）
+     * @return 槽位数
+     */
+    int slotCount() const { return slots.size(); }
+
+    /**
+     * @brief 因代数即将回绕而不再复用的槽位数
+     * @return 槽位数
+     */
+    int retiredSlots() const { return retired; }
+};
+
+// ================== 实现部分 ==================
+
+// 构造函数：三个数组都按 2 倍扩容
+template<typename T>
+SlotMap<T>::SlotMap(int capacity)
+    : values(capacity, GrowthPolicy::geometric(2.0)), owners(capacity, GrowthPolicy::geometric(2.0)),
+      slots(capacity, GrowthPolicy::geometric(2.0)), freeHead(-1), retired(0) {}
+
+// 插入：先确保有空闲槽位，再追加对象与反向下标，最后占用槽位。
+// 追加失败时只多出一个空闲槽位，已有对象与句柄不受影响
+template<typename T>
+typename SlotMap<T>::Handle SlotMap<T>::insert(const T& value) {
+    if (freeHead < 0) {
+        Slot slot;
+        slot.generation = 0;
+        slot.target = -1;
+        slots.insert(slots.size(), slot);
+        freeHead = slots.size() - 1;
+    }
+    int dense = values.size();
+    values.insert(dense, value);
+    try {
+        owners.insert(dense, freeHead);
+    } catch (...) {
+        values.unchecked_remove(dense);
+        throw;
+    }
+    int index = freeHead;
+    Slot& slot = slots.unchecked_get(index);
+    freeHead = slot.target;
+    slot.target = dense;
+    ++slot.generation;
+    return Handle(index, slot.generation);
+}
+
+// 释放槽位：代数加一变为偶数，放回空闲链表；代数即将回绕时不再复用
+template<typename T>
+void SlotMap<T>::releaseSlot(int index) {
+    Slot& slot = slots.unchecked_get(index);
+    ++slot.generation;
+    if (slot.generation == RETIRED_GENERATION) {
+        slot.target = -1;
+        ++retired;
+        return;
+    }
+    slot.target = freeHead;
+    freeHead = index;
+}
+
+// 删除：把最后一个对象移到被删位置并修正它的槽位，再从末尾删除，O(1)
+template<typename T>
+bool SlotMap<T>::erase(const Handle& handle) {
+    if (!contains(handle)) return false;
+    int dense = slots.unchecked_get(handle.index).target;
+    int last = values.size() - 1;
+    if (dense != last) {
+        values.unchecked_get(dense) = std::move(values.unchecked_get(last));
+        int moved = owners.unchecked_get(last);
+        owners.unchecked_get(dense) = moved;
+        slots.unchecked_get(moved).target = dense;
+    }
+    values.unchecked_remove(last);
+    owners.unchecked_remove(last);
+    releaseSlot(handle.index);
+    return true;
+}
+
+// 句柄有效：槽位存在且代数相同（空句柄与空闲槽位的代数为偶数，不会相同）
+template<typename T>
+bool SlotMap<T>::contains(const Handle& handle) const {
+    return handle.index >= 0 && handle.index < slots.size() &&
+           slots.unchecked_get(handle.index).generation == handle.generation && (handle.generation & 1u) != 0;
+}
+
+// 查找
+template<typename T>
+T* SlotMap<T>::find(const Handle& handle) {
+    return contains(handle) ? &unchecked_get(handle) : nullptr;
+}
+
+// 查找（常量版本）
+template<typename T>
+const T* SlotMap<T>::find(const Handle& handle) const {
+    return contains(handle) ? &unchecked_get(handle) : nullptr;
+}
+
+// 访问
+template<typename T>
+T& SlotMap<T>::at(const Handle& handle) {
+    DS_CHECK(contains(handle), std::out_of_range, "Stale or null handle");
+    return unchecked_get(handle);
+}
+
+// 访问（常量版本）
+template<typename T>
+const T& SlotMap<T>::at(const Handle& handle) const {
+    DS_CHECK(contains(handle), std::out_of_range, "Stale or null handle");
+    return unchecked_get(handle);
+}
+
+// 不抛异常的读取
+template<typename T>
+bool SlotMap<T>::try_get(const Handle& handle, T& out) const {
+    if (!contains(handle)) return false;
+    out = unchecked_get(handle);
+    return true;
+}
+
+// 稠密下标处对象的句柄
+template<typename T>
+typename SlotMap<T>::Handle SlotMap<T>::handleAt(int i) const {
+    int index = owners.unchecked_get(i);
+    return Handle(index, slots.unchecked_get(index).generation);
+}
+
+// 按稠密数组顺序遍历
+template<typename T>
+template<typename F>
+void SlotMap<T>::forEach(F visit) {
+    for (int i = 0; i < values.size(); ++i) visit(values.unchecked_get(i));
+}
+
+// 清空：释放全部占用的槽位，代数加一使已发出的句柄失效
+template<typename T>
+void SlotMap<T>::clear() {
+    for (int i = values.size() - 1; i >= 0; --i) releaseSlot(owners.unchecked_get(i));
+    while (!values.isEmpty()) {
+        values.unchecked_remove(values.size() - 1);
+        owners.unchecked_remove(owners.size() - 1);
+    }
+}
+
+// 预留容量：不再复用的槽位不计入可用槽位
+template<typename T>
+void SlotMap<T>::reserve(int n) {
+    values.reserve(n);
+    owners.reserve(n);
+    slots.reserve(n + retired);
+}
@@ -1,7 +1,12 @@
 #include "../include/array.hpp"
+#include <chrono>
+#include <cstdint>
+#include <fstream>
 #include <iostream>
 #include <string>
 #include <limits>
+#include <stdexcept>
+#include <vector>
 #ifdef _WIN32
 #include <windows.h>
 #endif
@@ -13,12 +18,20 @@ void printMenu() {
     std::cout << "  remove <下标>        : 删除指定下标的元素\n";
     std::cout << "  set <下标> <值>      : 设置指定下标的值\n";
     std::cout << "  get <下标>           : 获取指定下标的值\n";
+    std::cout << "  tryget <下标>        : 不抛异常的读取（try_get）\n";
     std::cout << "  search <值>          : 查找值，返回下标\n";
     std::cout << "  extend <扩容数>      : 扩展数组容量\n";
+    std::cout << "  policy <策略> [参数] : 满时扩容策略：none、exact、fixed <步长>、geometric <倍数>\n";
+    std::cout << "  reserve <容量>       : 预留容量\n";
+    std::cout << "  shrink               : 收缩容量到元素个数（shrink_to_fit）\n";
+    std::cout << "  capacity             : 当前容量与扩容策略\n";
     std::cout << "  size                 : 当前元素个数\n";
     std::cout << "  isEmpty              : 判断数组是否为空\n";
     std::cout << "  isFull               : 判断数组是否已满\n";
     std::cout << "  print                : 打印数组内容\n";
+    std::cout << "  bench <元素数> <轮数> : 对比 get（异常）、try_get、unchecked_get 的读取耗时\n";
+    std::cout << "  grow <元素数>        : 各扩容策略下逐个追加的耗时与扩容次数\n";
+    std::cout << "  huge <MB>            : 普通分配与大页分配的首次写入、随机读取对比\n";
     std::cout << "  help                 : 显示菜单\n";
     std::cout << "  exit / 0             : 退出程序\n";
     std::cout << "-----------------------------------\n";
@@ -40,6 +53,151 @@ void clearInput() {
     std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
 }
 
+// 计时工具：执行f并返回耗时（毫秒）
+template<typename F>
+double timeIt(F f) {
+    auto start = std::chrono::steady_clock::now();
+    f();
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+// 顺序读取全部元素，以及按随机下标读取（约10%越界）
+void bench(int n, int rounds) {
+    Array<int> arr(n);
+    for (int i = 0; i < n; ++i) arr.insert(i, i);
+    long long s1 = 0, s2 = 0, s3 = 0;
+    double tGet = timeIt([&]() {
+        for (int r = 0; r < rounds; ++r)
+            for (int i = 0; i < arr.size(); ++i) s1 += arr.get(i);
+    });
+    double tTry = timeIt([&]() {
+        int v;
+        for (int r = 0; r < rounds; ++r)
+            for (int i = 0; i < arr.size(); ++i)
+                if (arr.try_get(i, v)) s2 += v;
+    });
+    double tUnchecked = timeIt([&]() {
+        for (int r = 0; r < rounds; ++r)
+            for (int i = 0; i < arr.size(); ++i) s3 += arr.unchecked_get(i);
+    });
+    std::cout << "  顺序读取 " << n << "x" << rounds << ": get " << tGet << " ms，try_get " << tTry
+              << " ms，unchecked_get " << tUnchecked << " ms" << (s1 == s2 && s2 == s3 ? "" : "（结果不一致！）") << "\n";
+#if defined(DS_CHECKS_AS_ASSERTS)
+    std::cout << "  断言模式下 get 越界不再抛出异常，跳过随机越界读取对比。\n";
+#else
+    std::vector<int> probes(n);
+    unsigned x = 12345;
+    for (int i = 0; i < n; ++i) {
+        x = x * 1103515245u + 12345u;
+        probes[i] = static_cast<int>((x >> 8) % static_cast<unsigned>(n + n / 9 + 1));
+    }
+    long long hit1 = 0, hit2 = 0;
+    double tCatch = timeIt([&]() {
+        for (int i = 0; i < n; ++i) {
+            try {
+                hit1 += arr.get(probes[i]);
+            } catch (const std::out_of_range&) {
+            }
+        }
+    });
+    double tTryProbe = timeIt([&]() {
+        int v;
+        for (int i = 0; i < n; ++i)
+            if (arr.try_get(probes[i], v)) hit2 += v;
+    });
+    std::cout << "  随机读取（约10%越界）" << n << " 次: get+try/catch " << tCatch << " ms，try_get " << tTryProbe
+              << " ms" << (hit1 == hit2 ? "" : "（结果不一致！）") << "\n";
+#endif
+}
+
+const char* policyName(const GrowthPolicy& p) {
+    switch (p.getKind()) {
+    case GrowthPolicy::NONE: return "none（满时报错）";
+    case GrowthPolicy::GEOMETRIC: return "geometric";
+    case GrowthPolicy::FIXED: return "fixed";
+    default: return "exact";
+    }
+}
+
+void printCapacity(const Array<int>& arr) {
+    const GrowthPolicy& p = arr.growthPolicy();
+    std::cout << "容量: " << arr.getCapacity() << "，元素个数: " << arr.size() << "，策略: " << policyName(p);
+    if (p.getKind() == GrowthPolicy::GEOMETRIC) std::cout << " x" << p.getFactor();
+    if (p.getKind() == GrowthPolicy::FIXED) std::cout << " +" << p.getStep();
+    std::cout << "\n";
+}
+
+// 从容量1开始逐个追加n个元素，统计耗时和扩容次数
+void growOnce(const char* name, const GrowthPolicy& policy, int n) {
+    Array<int> arr(1, policy);
+    int reallocs = 0;
+    double t = timeIt([&]() {
+        for (int i = 0; i < n; ++i) {
+            int before = arr.getCapacity();
+            arr.insert(arr.size(), i);
+            if (arr.getCapacity() != before) ++reallocs;
+        }
+    });
+    std::cout << "  " << name << ": " << t << " ms，扩容 " << reallocs << " 次，最终容量 " << arr.getCapacity();
+    arr.shrink_to_fit();
+    std::cout << "，shrink_to_fit 后 " << arr.getCapacity() << "\n";
+}
+
+void growBench(int n) {
+    std::cout << "  从容量1开始追加 " << n << " 个 int：\n";
+    if (n <= 100000) growOnce("exact", GrowthPolicy::exact(), n);
+    else std::cout << "  exact: 元素数超过 100000 时为 O(n²)，跳过\n";
+    growOnce("fixed +1024", GrowthPolicy::fixed(1024), n);
+    growOnce("geometric x1.5", GrowthPolicy::geometric(1.5), n);
+    growOnce("geometric x2", GrowthPolicy::geometric(2.0), n);
+}
+
+// 当前进程的透明大页用量（KB），不可读时返回-1
+long long anonHugePagesKB() {
+    std::ifstream in("/proc/self/smaps_rollup");
+    std::string key;
+    long long value;
+    while (in >> key) {
+        if (key == "AnonHugePages:" && in >> value) return value;
+        in.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+    }
+    return -1;
+}
+
+// 同一大小的缓冲区分别用普通分配和大页分配：顺序首次写入（缺页），再做相互依赖的随机读取（TLB 未命中）
+void hugeOnce(const char* name, std::size_t bytes, bool huge) {
+    long long before = anonHugePagesKB();
+    uint64_t* buf = static_cast<uint64_t*>(HugePageMemory::allocate(bytes, huge));
+    std::size_t n = bytes / sizeof(uint64_t);
+    double tTouch = timeIt([&]() {
+        for (std::size_t i = 0; i < n; ++i) buf[i] = i * 2654435761u;
+    });
+    long long after = anonHugePagesKB();
+    const int reads = 20000000;
+    uint64_t idx = 0, sum = 0;
+    double tRead = timeIt([&]() {
+        for (int i = 0; i < reads; ++i) {
+            uint64_t v = buf[idx];
+            sum += v;
+            idx = (v ^ (static_cast<uint64_t>(i) * 0x9E3779B97F4A7C15ull)) % n;
+        }
+    });
+    HugePageMemory::deallocate(buf, bytes, huge);
+    std::cout << "  " << name << ": 首次写入 " << tTouch << " ms，" << reads << " 次随机读取 " << tRead << " ms（每次 "
+              << tRead * 1e6 / reads << " ns）";
+    if (before >= 0 && after >= 0) std::cout << "，大页 " << (after - before) / 1024 << " MB";
+    std::cout << "（校验和 " << sum << "）\n";
+}
+
+void hugeBench(int mb) {
+    std::size_t bytes = static_cast<std::size_t>(mb) << 20;
+    if (!HugePageMemory::supported()) std::cout << "  当前平台或编译选项不支持大页路径，两次结果应相近。\n";
+    std::cout << "  缓冲区 " << mb << " MB：\n";
+    hugeOnce("普通分配", bytes, false);
+    hugeOnce("大页分配", bytes, true);
+}
+
 int main() {
 #ifdef _WIN32
     // 设置 Windows 控制台为 UTF-8，防止中文输出乱码
@@ -111,6 +269,26 @@ int main() {
             } catch (const std::exception& e) {
                 std::cout << "错误: " << e.what() << "\n";
             }
+        } else if (cmd == "tryget") {
+            int idx;
+            if (!(std::cin >> idx)) {
+                std::cout << "输入有误。用法: tryget <下标>\n";
+                clearInput();
+                continue;
+            }
+            int val = 0;
+            if (arr.try_get(idx, val))
+                std::cout << "下标 " << idx << " 的值为: " << val << "\n";
+            else
+                std::cout << "下标 " << idx << " 越界，try_get 返回 false。\n";
+        } else if (cmd == "bench") {
+            int n, rounds;
+            if (!(std::cin >> n >> rounds) || n <= 0 || rounds <= 0) {
+                std::cout << "输入有误。用法: bench <元素数> <轮数>\n";
+                clearInput();
+                continue;
+            }
+            bench(n, rounds);
         } else if (cmd == "search") {
             int val;
             if (!(std::cin >> val)) {
@@ -132,6 +310,59 @@ int main() {
             }
             arr.extend(enlarge);
             std::cout << "已扩容 " << enlarge << "。\n";
+        } else if (cmd == "policy") {
+            std::string kind;
+            std::cin >> kind;
+            try {
+                if (kind == "none") {
+                    arr.setGrowthPolicy(GrowthPolicy::none());
+                } else if (kind == "exact") {
+                    arr.setGrowthPolicy(GrowthPolicy::exact());
+                } else if (kind == "fixed" || kind == "geometric") {
+                    double param;
+                    if (!(std::cin >> param)) {
+                        std::cout << "输入有误。用法: policy fixed <步长> 或 policy geometric <倍数>\n";
+                        clearInput();
+                        continue;
+                    }
+                    arr.setGrowthPolicy(kind == "fixed" ? GrowthPolicy::fixed(static_cast<int>(param))
+                                                        : GrowthPolicy::geometric(param));
+                } else {
+                    std::cout << "输入有误。策略为 none、exact、fixed <步长> 或 geometric <倍数>\n";
+                    clearInput();
+                    continue;
+                }
+                printCapacity(arr);
+            } catch (const std::exception& e) {
+                std::cout << "错误: " << e.what() << "\n";
+            }
+        } else if (cmd == "reserve") {
+            int n;
+            if (!(std::cin >> n)) {
+                std::cout << "输入有误。用法: reserve <容量>\n";
+                clearInput();
+                continue;
+            }
+            arr.reserve(n);
+            printCapacity(arr);
+        } else if (cmd == "shrink") {
+            arr.shrink_to_fit();
+            printCapacity(arr);
+        } else if (cmd == "capacity") {
+            printCapacity(arr);
+        } else if (cmd == "grow" || cmd == "huge") {
+            int n;
+            if (!(std::cin >> n) || n <= 0) {
+                std::cout << "输入有误。用法: " << cmd << " <正整数>\n";
+                clearInput();
+                continue;
+            }
+            try {
+                if (cmd == "grow") growBench(n);
+                else hugeBench(n);
+            } catch (const std::exception& e) {
+                std::cout << "错误: " << e.what() << "\n";
+            }
         } else if (cmd == "size") {
             std::cout << "当前元素个数: " << arr.size() << "\n";
         } else if (cmd == "isEmpty") {
@@ -0,0 +1,175 @@
+#include "../include/array.hpp"
+#include "../include/filteredArray.hpp"
+#include <chrono>
+#include <iostream>
+#include <limits>
+#include <string>
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+void printMenu() {
+    std::cout << "\n====== 带布隆过滤器的顺序表交互测试菜单 ======\n";
+    std::cout << "（初始容量16，满时可用 extend 扩容）\n";
+    std::cout << "命令列表：\n";
+    std::cout << "  insert <下标> <值>       : 在下标插入值\n";
+    std::cout << "  remove <下标>            : 删除指定下标的元素\n";
+    std::cout << "  set <下标> <值>          : 设置指定下标的值（旧值计入过期）\n";
+    std::cout << "  get <下标>               : 获取指定下标的值\n";
+    std::cout << "  search <值>              : 查找值（先查过滤器）\n";
+    std::cout << "  extend <扩容数>          : 扩展数组容量\n";
+    std::cout << "  print                    : 打印数组内容\n";
+    std::cout << "  stats                    : 长度、过期数、重建次数与过滤器状态\n";
+    std::cout << "  rebuild                  : 立即重建过滤器\n";
+    std::cout << "  bench <元素数> <查询数>   : 查询多数落空时与 Array::search 对比\n";
+    std::cout << "  help                     : 显示菜单\n";
+    std::cout << "  exit / 0                 : 退出程序\n";
+    std::cout << "-----------------------------------\n";
+    std::cout << "请输入命令: ";
+}
+
+void clearInput() {
+    std::cin.clear();
+    std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+}
+
+// 计时工具：执行f并返回耗时（毫秒）
+template<typename F>
+double timeIt(F f) {
+    auto start = std::chrono::steady_clock::now();
+    f();
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+void printStats(const FilteredArray<int>& arr) {
+    const BloomFilter<int>& f = arr.bloom();
+    std::cout << "长度: " << arr.size() << "，过期数: " << arr.staleCount() << "，重建次数: " << arr.rebuilds()
+              << "\n过滤器: 预期容量 " << f.capacity() << "，已加入 " << f.count() << "，" << f.bytes()
+              << " 字节，k=" << f.hashes() << "，填充率 " << f.fillRatio() << "\n";
+}
+
+// 数组中放 n 个偶数，查询 q 次：九成查奇数（落空），一成查存在的偶数；
+// 之后把一半元素改写为新值，检查过期与重建后查询仍然正确
+void bench(int n, int q) {
+    Array<int> plain(n);
+    FilteredArray<int> filtered(n);
+    for (int i = 0; i < n; ++i) {
+        plain.insert(i, 2 * i);
+        filtered.insert(i, 2 * i);
+    }
+    long long s1 = 0, s2 = 0;
+    unsigned seed = 12345;
+    double tPlain = timeIt([&]() {
+        unsigned x = seed;
+        for (int i = 0; i < q; ++i) {
+            x = x * 1103515245u + 12345u;
+            int v = static_cast<int>((x >> 8) % static_cast<unsigned>(n)) * 2 + (i % 10 != 0 ? 1 : 0);
+            s1 += plain.search(v);
+        }
+    });
+    double tFiltered = timeIt([&]() {
+        unsigned x = seed;
+        for (int i = 0; i < q; ++i) {
+            x = x * 1103515245u + 12345u;
+            int v = static_cast<int>((x >> 8) % static_cast<unsigned>(n)) * 2 + (i % 10 != 0 ? 1 : 0);
+            s2 += filtered.search(v);
+        }
+    });
+    std::cout << "  " << n << " 个元素，" << q << " 次查询（90% 落空）\n";
+    std::cout << "  Array::search: " << tPlain << " ms，FilteredArray::search: " << tFiltered << " ms"
+              << (s1 == s2 ? "" : "（结果不一致！）") << "\n";
+    bool ok = true;
+    for (int i = 0; i < n; i += 2) {
+        plain.set(i, -2 * i - 1);
+        filtered.set(i, -2 * i - 1);
+    }
+    for (int i = 0; i < n && ok; ++i) {
+        ok = plain.search(2 * i) == filtered.search(2 * i) && plain.search(-2 * i - 1) == filtered.search(-2 * i - 1);
+    }
+    std::cout << "  改写一半元素后: 重建 " << filtered.rebuilds() << " 次，过期 " << filtered.staleCount()
+              << "，查询结果" << (ok ? "一致" : "不一致！") << "\n";
+}
+
+int main() {
+#ifdef _WIN32
+    SetConsoleOutputCP(CP_UTF8);
+    SetConsoleCP(CP_UTF8);
+#endif
+    FilteredArray<int> arr(16);
+    std::string cmd;
+    printMenu();
+    while (true) {
+        std::cout << "> ";
+        if (!(std::cin >> cmd)) break;
+        try {
+            if (cmd == "insert" || cmd == "set") {
+                int index, v;
+                if (!(std::cin >> index >> v)) {
+                    std::cout << "输入有误。用法: " << cmd << " <下标> <值>\n";
+                    clearInput();
+                    continue;
+                }
+                if (cmd == "insert") arr.insert(index, v);
+                else arr.set(index, v);
+                std::cout << "完成，长度: " << arr.size() << "，过期数: " << arr.staleCount() << "\n";
+            } else if (cmd == "remove" || cmd == "get" || cmd == "extend") {
+                int n;
+                if (!(std::cin >> n)) {
+                    std::cout << "输入有误。用法: " << cmd << " <数值>\n";
+                    clearInput();
+                    continue;
+                }
+                if (cmd == "remove") {
+                    arr.remove(n);
+                    std::cout << "已删除，过期数: " << arr.staleCount() << "\n";
+                } else if (cmd == "get") {
+                    int v = arr.get(n);
+                    std::cout << "下标 " << n << " 的值为: " << v << "\n";
+                } else {
+                    arr.extend(n);
+                    std::cout << "已扩容 " << n << "。\n";
+                }
+            } else if (cmd == "search") {
+                int v;
+                if (!(std::cin >> v)) {
+                    std::cout << "输入有误。用法: search <值>\n";
+                    clearInput();
+                    continue;
+                }
+                bool maybe = arr.bloom().mayContain(v);
+                int index = arr.search(v);
+                std::cout << "过滤器: " << (maybe ? "可能存在" : "一定不存在") << "，"
+                          << (index >= 0 ? "下标 " + std::to_string(index) : std::string("未找到")) << "\n";
+            } else if (cmd == "print") {
+                std::cout << "[";
+                for (int i = 0; i < arr.size(); ++i) std::cout << (i ? ", " : "") << arr.get(i);
+                std::cout << "]\n";
+            } else if (cmd == "stats") {
+                printStats(arr);
+            } else if (cmd == "rebuild") {
+                arr.rebuild();
+                printStats(arr);
+            } else if (cmd == "bench") {
+                int n, q;
+                if (!(std::cin >> n >> q) || n <= 0 || q < 0) {
+                    std::cout << "输入有误。用法: bench <元素数> <查询数>\n";
+                    clearInput();
+                    continue;
+                }
+                bench(n, q);
+            } else if (cmd == "help") {
+                printMenu();
+            } else if (cmd == "exit" || cmd == "0") {
+                std::cout << "程序结束，再见！\n";
+                break;
+            } else {
+                std::cout << "未知命令。输入 help 查看菜单。\n";
+            }
+        } catch (const std::exception& e) {
+            std::cout << "错误: " << e.what() << "\n";
+        }
+        clearInput();
+    }
+    return 0;
+}
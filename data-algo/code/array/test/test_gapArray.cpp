@@ -0,0 +1,281 @@
+#include "../include/array.hpp"
+#include "../include/gapArray.hpp"
+#include "../include/ropeArray.hpp"
+#include <chrono>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+void printMenu() {
+    std::cout << "\n====== 间隙缓冲数组 / 分块绳索交互测试菜单 ======\n";
+    std::cout << "（每条编辑命令同时作用于 GapArray 与 RopeArray，并检查两者一致）\n";
+    std::cout << "命令列表：\n";
+    std::cout << "  insert <下标> <值>        : 在下标插入值\n";
+    std::cout << "  remove <下标>             : 删除指定下标的元素\n";
+    std::cout << "  erase <下标> <个数>       : 删除一段元素（仅 GapArray 批量删除，RopeArray 逐个删除）\n";
+    std::cout << "  set <下标> <值>           : 设置指定下标的值\n";
+    std::cout << "  get <下标>                : 获取指定下标的值\n";
+    std::cout << "  search <值>               : 查找值，返回下标\n";
+    std::cout << "  type <下标> <个数>        : 模拟在光标处连续输入若干个值\n";
+    std::cout << "  gap <下标>                : 把间隙移动到指定位置\n";
+    std::cout << "  print                     : 打印内容、间隙位置与块数\n";
+    std::cout << "  size                      : 当前元素个数\n";
+    std::cout << "  clear                     : 清空\n";
+    std::cout << "  bench <初始个数> <编辑次数> : 局部编辑与随机编辑下与 Array、std::vector 对比\n";
+    std::cout << "  help                      : 显示菜单\n";
+    std::cout << "  exit / 0                  : 退出程序\n";
+    std::cout << "-----------------------------------\n";
+    std::cout << "请输入命令: ";
+}
+
+void clearInput() {
+    std::cin.clear();
+    std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+}
+
+// 打印并检查两种结构内容一致
+void printBoth(const GapArray<int>& gap, const RopeArray<int>& rope) {
+    std::cout << "内容: [";
+    bool first = true;
+    int shown = 0;
+    gap.forEach([&](const int& v) {
+        if (shown++ >= 100) return;
+        std::cout << (first ? "" : ", ") << v;
+        first = false;
+    });
+    std::cout << (gap.size() > 100 ? ", ...]\n" : "]\n");
+    bool same = gap.size() == rope.size();
+    for (int i = 0; same && i < gap.size(); ++i) same = gap.get(i) == rope.get(i);
+    std::cout << "间隙位置: " << gap.gapPosition() << "，容量: " << gap.getCapacity()
+              << "，绳索块数: " << rope.leafCount() << "，两者" << (same ? "一致" : "不一致！") << "\n";
+}
+
+// 计时工具：执行f并返回耗时（毫秒）
+template<typename F>
+double timeIt(F f) {
+    auto start = std::chrono::steady_clock::now();
+    f();
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+// 生成编辑序列：local 为真时光标每次只小幅移动，模拟文本编辑；否则位置完全随机
+struct Edit {
+    bool insert;
+    double where;   // 相对位置 [0,1)，执行时乘以当前长度
+    int step;       // 局部编辑时光标的移动量
+};
+
+std::vector<Edit> makeEdits(int ops, bool local, std::mt19937& rng) {
+    std::vector<Edit> edits(ops);
+    std::uniform_real_distribution<double> uni(0.0, 1.0);
+    for (int i = 0; i < ops; ++i) {
+        edits[i].insert = rng() % 10 < 7;
+        edits[i].where = uni(rng);
+        edits[i].step = static_cast<int>(rng() % 17) - 8;
+        if (local && rng() % 1000 == 0) edits[i].step = 1 << 30;   // 偶尔跳到别处
+    }
+    return edits;
+}
+
+// 对任意提供 size/insert/remove 的结构执行编辑序列，返回校验和
+template<typename Insert, typename Remove, typename Size>
+long long runEdits(const std::vector<Edit>& edits, int count, bool local, Insert ins, Remove rem, Size size) {
+    long long cursor = 0, checksum = 0;
+    for (int i = 0; i < count; ++i) {
+        const Edit& e = edits[i];
+        long long n = size();
+        if (!local || e.step == (1 << 30)) cursor = static_cast<long long>(e.where * (n + 1));
+        else cursor += e.step;
+        if (cursor < 0) cursor = 0;
+        if (cursor > n) cursor = n;
+        if (e.insert || n == 0) {
+            ins(static_cast<int>(cursor), i);
+            ++cursor;
+        } else {
+            if (cursor == n) --cursor;
+            rem(static_cast<int>(cursor));
+        }
+        checksum += cursor;
+    }
+    return checksum;
+}
+
+void benchCase(int n, int ops, bool local) {
+    std::mt19937 rng(local ? 11 : 22);
+    std::vector<Edit> edits = makeEdits(ops, local, rng);
+    // Array 每次插入都搬移尾部元素，最多测 2000 次，按平均耗时比较
+    int arrayOps = ops < 2000 ? ops : 2000;
+
+    Array<int> arr(n + arrayOps + 1);
+    std::vector<int> vec;
+    GapArray<int> gap(n);
+    RopeArray<int> rope;
+    for (int i = 0; i < n; ++i) {
+        arr.insert(i, i);
+        vec.push_back(i);
+        gap.push_back(i);
+        rope.push_back(i);
+    }
+    long long c2 = 0, c3 = 0, c4 = 0;
+    double tArr = timeIt([&]() {
+        runEdits(edits, arrayOps, local,
+                 [&](int p, int v) { arr.insert(p, v); }, [&](int p) { arr.remove(p); },
+                 [&]() { return arr.size(); });
+    });
+    double tVec = timeIt([&]() {
+        c2 = runEdits(edits, ops, local,
+                      [&](int p, int v) { vec.insert(vec.begin() + p, v); }, [&](int p) { vec.erase(vec.begin() + p); },
+                      [&]() { return static_cast<int>(vec.size()); });
+    });
+    double tGap = timeIt([&]() {
+        c3 = runEdits(edits, ops, local,
+                      [&](int p, int v) { gap.insert(p, v); }, [&](int p) { gap.remove(p); },
+                      [&]() { return gap.size(); });
+    });
+    double tRope = timeIt([&]() {
+        c4 = runEdits(edits, ops, local,
+                      [&](int p, int v) { rope.insert(p, v); }, [&](int p) { rope.remove(p); },
+                      [&]() { return rope.size(); });
+    });
+    bool same = c2 == c3 && c3 == c4 && vec.size() == static_cast<size_t>(gap.size()) && gap.size() == rope.size();
+    for (int i = 0; same && i < gap.size(); i += 97) same = vec[i] == gap.get(i) && gap.get(i) == rope.get(i);
+    std::cout << (local ? "  [局部编辑] " : "  [随机编辑] ") << "初始 " << n << " 个，编辑 " << ops << " 次，平均每次:\n";
+    std::cout << "    Array       " << tArr * 1e6 / arrayOps << " ns（只测前 " << arrayOps << " 次）\n";
+    std::cout << "    std::vector " << tVec * 1e6 / ops << " ns\n";
+    std::cout << "    GapArray    " << tGap * 1e6 / ops << " ns\n";
+    std::cout << "    RopeArray   " << tRope * 1e6 / ops << " ns（" << rope.leafCount() << " 块）"
+              << (same ? "" : "  结果不一致！") << "\n";
+
+    // 编辑之后的随机读取
+    std::vector<int> probes(ops);
+    for (int i = 0; i < ops; ++i) probes[i] = static_cast<int>(rng() % gap.size());
+    long long s1 = 0, s2 = 0, s3 = 0;
+    double rVec = timeIt([&]() { for (int i = 0; i < ops; ++i) s1 += vec[probes[i]]; });
+    double rGap = timeIt([&]() { for (int i = 0; i < ops; ++i) s2 += gap.get(probes[i]); });
+    double rRope = timeIt([&]() { for (int i = 0; i < ops; ++i) s3 += rope.get(probes[i]); });
+    std::cout << "    随机读取 " << ops << " 次: std::vector " << rVec << " ms，GapArray " << rGap
+              << " ms，RopeArray " << rRope << " ms" << (s1 == s2 && s2 == s3 ? "" : "  结果不一致！") << "\n";
+}
+
+int main() {
+#ifdef _WIN32
+    SetConsoleOutputCP(CP_UTF8);
+    SetConsoleCP(CP_UTF8);
+#endif
+    GapArray<int> gap;
+    RopeArray<int> rope;
+    std::mt19937 rng(2024);
+    std::string cmd;
+    printMenu();
+    while (true) {
+        std::cout << "> ";
+        if (!(std::cin >> cmd)) break;
+        try {
+            if (cmd == "insert" || cmd == "set") {
+                int idx, val;
+                if (!(std::cin >> idx >> val)) {
+                    std::cout << "输入有误。用法: " << cmd << " <下标> <值>\n";
+                    clearInput();
+                    continue;
+                }
+                if (cmd == "insert") {
+                    gap.insert(idx, val);
+                    rope.insert(idx, val);
+                    std::cout << "已在下标 " << idx << " 插入 " << val << "。\n";
+                } else {
+                    gap.set(idx, val);
+                    rope.set(idx, val);
+                    std::cout << "已将下标 " << idx << " 设置为 " << val << "。\n";
+                }
+            } else if (cmd == "remove" || cmd == "get" || cmd == "gap") {
+                int idx;
+                if (!(std::cin >> idx)) {
+                    std::cout << "输入有误。用法: " << cmd << " <下标>\n";
+                    clearInput();
+                    continue;
+                }
+                if (cmd == "remove") {
+                    gap.remove(idx);
+                    rope.remove(idx);
+                    std::cout << "已删除下标 " << idx << " 的元素。\n";
+                } else if (cmd == "get") {
+                    int a = gap.get(idx), b = rope.get(idx);
+                    std::cout << "下标 " << idx << " 的值为: " << a << (a == b ? "" : "（RopeArray 不一致！）") << "\n";
+                } else {
+                    gap.moveGap(idx);
+                    std::cout << "间隙已移动到 " << gap.gapPosition() << "。\n";
+                }
+            } else if (cmd == "erase") {
+                int idx, count;
+                if (!(std::cin >> idx >> count)) {
+                    std::cout << "输入有误。用法: erase <下标> <个数>\n";
+                    clearInput();
+                    continue;
+                }
+                gap.remove(idx, count);
+                for (int i = 0; i < count; ++i) rope.remove(idx);
+                std::cout << "已删除 " << count << " 个元素。\n";
+            } else if (cmd == "type") {
+                int idx, count;
+                if (!(std::cin >> idx >> count) || count < 0) {
+                    std::cout << "输入有误。用法: type <下标> <个数>\n";
+                    clearInput();
+                    continue;
+                }
+                for (int i = 0; i < count; ++i) {
+                    int v = static_cast<int>(rng() % 100);
+                    gap.insert(idx + i, v);
+                    rope.insert(idx + i, v);
+                }
+                std::cout << "已在下标 " << idx << " 起连续输入 " << count << " 个值。\n";
+            } else if (cmd == "search") {
+                int val;
+                if (!(std::cin >> val)) {
+                    std::cout << "输入有误。用法: search <值>\n";
+                    clearInput();
+                    continue;
+                }
+                int idx = gap.search(val);
+                if (idx == -1)
+                    std::cout << "未找到值 " << val << "。\n";
+                else
+                    std::cout << "值 " << val << " 首次出现下标为 " << idx
+                              << (rope.search(val) == idx ? "" : "（RopeArray 不一致！）") << "。\n";
+            } else if (cmd == "print") {
+                printBoth(gap, rope);
+            } else if (cmd == "size") {
+                std::cout << "当前元素个数: " << gap.size() << "\n";
+            } else if (cmd == "clear") {
+                gap.clear();
+                rope.clear();
+                std::cout << "已清空。\n";
+            } else if (cmd == "bench") {
+                int n, ops;
+                if (!(std::cin >> n >> ops) || n < 0 || ops <= 0) {
+                    std::cout << "输入有误。用法: bench <初始个数> <编辑次数>\n";
+                    clearInput();
+                    continue;
+                }
+                benchCase(n, ops, true);
+                benchCase(n, ops, false);
+            } else if (cmd == "help") {
+                printMenu();
+            } else if (cmd == "exit" || cmd == "0") {
+                std::cout << "程序结束，再见！\n";
+                break;
+            } else {
+                std::cout << "未知命令。输入 help 查看菜单。\n";
+            }
+        } catch (const std::exception& e) {
+            std::cout << "错误: " << e.what() << "\n";
+        }
+        clearInput();
+    }
+    return 0;
+}
@@ -0,0 +1,412 @@
+#include "../include/array.hpp"
+#include "../include/fenwickTree.hpp"
+#include "../include/segmentTree.hpp"
+#include <chrono>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <string>
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+typedef long long Value;
+
+void printMenu() {
+    std::cout << "\n====== 区间聚合索引（树状数组 / 线段树）交互测试菜单 ======\n";
+    std::cout << "命令列表：\n";
+    std::cout << "  build <个数> <最大值>      : 用随机数据 O(n) 构建全部索引\n";
+    std::cout << "  set <下标> <值>            : 单点赋值\n";
+    std::cout << "  add <起点> <终点> <增量>   : 区间 [起点,终点) 加增量（懒标记线段树 O(log n)）\n";
+    std::cout << "  sum <起点> <终点>          : 区间和\n";
+    std::cout << "  min <起点> <终点>          : 区间最小值\n";
+    std::cout << "  max <起点> <终点>          : 区间最大值\n";
+    std::cout << "  kth <目标>                 : 前缀和首次达到目标的前缀长度（树状数组二分下降）\n";
+    std::cout << "  print                      : 打印数组内容\n";
+    std::cout << "  stress <操作数>            : 随机修改与查询，与逐个扫描对照\n";
+    std::cout << "  bench <个数> <操作数>      : 与逐个扫描 Array 对比修改与查询耗时\n";
+    std::cout << "  help                       : 显示菜单\n";
+    std::cout << "  exit / 0                   : 退出程序\n";
+    std::cout << "-----------------------------------\n";
+    std::cout << "请输入命令: ";
+}
+
+void clearInput() {
+    std::cin.clear();
+    std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+}
+
+// 计时工具：执行f并返回耗时（毫秒）
+template<typename F>
+double timeIt(F f) {
+    auto start = std::chrono::steady_clock::now();
+    f();
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+// 交互状态：同一份数据上的全部索引
+struct Indexes {
+    Array<Value> data;
+    FenwickTree<Value> fenwick;
+    SegmentTree<Value, MinOp<Value> > minTree;
+    SegmentTree<Value, MaxOp<Value> > maxTree;
+    LazySegmentTree<Value> lazySum;
+    LazySegmentTree<Value, MinOp<Value>, RangeAddMinMax<Value> > lazyMin;
+
+    Indexes()
+        : data(0, GrowthPolicy::geometric(2.0)), minTree(0, MinOp<Value>::identity()),
+          maxTree(0, MaxOp<Value>::identity()), lazyMin(0, MinOp<Value>::identity()) {}
+
+    void build() {
+        fenwick.build(data);
+        minTree.build(data);
+        maxTree.build(data);
+        lazySum.build(data);
+        lazyMin.build(data);
+    }
+};
+
+Value scanSum(const Array<Value>& a, int lo, int hi) {
+    Value s = 0;
+    for (int i = lo; i < hi; ++i) s += a.unchecked_get(i);
+    return s;
+}
+
+Value scanMin(const Array<Value>& a, int lo, int hi) {
+    Value m = MinOp<Value>::identity();
+    for (int i = lo; i < hi; ++i) m = std::min(m, a.unchecked_get(i));
+    return m;
+}
+
+Value scanMax(const Array<Value>& a, int lo, int hi) {
+    Value m = MaxOp<Value>::identity();
+    for (int i = lo; i < hi; ++i) m = std::max(m, a.unchecked_get(i));
+    return m;
+}
+
+// 一次函数 x -> a*x + b（模 P）的复合：不满足交换律，用于检查线段树合并顺序
+struct Affine {
+    Value a, b;
+};
+
+struct ComposeAffine {
+    static const Value P = 1000000007;
+    // 先作用 f 再作用 g
+    Affine operator()(const Affine& f, const Affine& g) const {
+        Affine h;
+        h.a = f.a * g.a % P;
+        h.b = (f.b * g.a + g.b) % P;
+        return h;
+    }
+};
+
+bool stressAffine(std::mt19937& rng) {
+    int n = static_cast<int>(rng() % 300) + 1;
+    Affine unit;
+    unit.a = 1;
+    unit.b = 0;
+    Vector<Affine> fs(n, unit);
+    for (int i = 0; i < n; ++i) {
+        fs[i].a = rng() % 1000;
+        fs[i].b = rng() % 1000;
+    }
+    SegmentTree<Affine, ComposeAffine> tree(0, unit);
+    tree.build(fs);
+    ComposeAffine op;
+    for (int q = 0; q < 200; ++q) {
+        int i = static_cast<int>(rng() % n);
+        fs[i].a = rng() % 1000;
+        fs[i].b = rng() % 1000;
+        tree.set(i, fs[i]);
+        int lo = static_cast<int>(rng() % (n + 1)), hi = static_cast<int>(rng() % (n + 1));
+        if (lo > hi) std::swap(lo, hi);
+        Affine expect = unit;
+        for (int k = lo; k < hi; ++k) expect = op(expect, fs[k]);
+        Affine got = tree.query(lo, hi);
+        if (got.a != expect.a || got.b != expect.b) return false;
+    }
+    return true;
+}
+
+// 区间赋值策略：与逐个赋值对照
+bool stressAssign(std::mt19937& rng) {
+    int n = static_cast<int>(rng() % 500) + 1;
+    Vector<Value> a(n, 0);
+    for (int i = 0; i < n; ++i) a[i] = static_cast<Value>(rng() % 1000);
+    LazySegmentTree<Value, std::plus<Value>, RangeAssignSum<Value> > sum;
+    LazySegmentTree<Value, MaxOp<Value>, RangeAssignMinMax<Value> > mx(0, MaxOp<Value>::identity());
+    sum.build(a);
+    mx.build(a);
+    for (int q = 0; q < 300; ++q) {
+        int lo = static_cast<int>(rng() % (n + 1)), hi = static_cast<int>(rng() % (n + 1));
+        if (lo > hi) std::swap(lo, hi);
+        if (q % 3 == 0) {
+            Value v = static_cast<Value>(rng() % 1000) - 500;
+            for (int k = lo; k < hi; ++k) a[k] = v;
+            sum.update(lo, hi, std::make_pair(true, v));
+            mx.update(lo, hi, std::make_pair(true, v));
+        } else {
+            Value s = 0, m = MaxOp<Value>::identity();
+            for (int k = lo; k < hi; ++k) {
+                s += a[k];
+                m = std::max(m, a[k]);
+            }
+            if (sum.query(lo, hi) != s || mx.query(lo, hi) != m) return false;
+            if (hi > lo && sum.get(lo) != a[lo]) return false;
+        }
+    }
+    return true;
+}
+
+void stress(Indexes& idx, int ops) {
+    std::mt19937 rng(9);
+    int n = idx.data.size();
+    if (n == 0) {
+        std::cout << "  请先用 build 构建数据。\n";
+        return;
+    }
+    for (int i = 0; i < ops; ++i) {
+        int lo = static_cast<int>(rng() % (n + 1)), hi = static_cast<int>(rng() % (n + 1));
+        if (lo > hi) std::swap(lo, hi);
+        int op = static_cast<int>(rng() % 4);
+        bool ok = true;
+        if (op == 0) {
+            int k = static_cast<int>(rng() % n);
+            Value v = static_cast<Value>(rng() % 2001) - 1000;
+            idx.data.unchecked_set(k, v);
+            idx.fenwick.set(k, v);
+            idx.minTree.set(k, v);
+            idx.maxTree.set(k, v);
+            idx.lazySum.set(k, v);
+            idx.lazyMin.set(k, v);
+        } else if (op == 1) {
+            Value d = static_cast<Value>(rng() % 201) - 100;
+            for (int k = lo; k < hi; ++k) idx.data.unchecked_set(k, idx.data.unchecked_get(k) + d);
+            idx.lazySum.update(lo, hi, d);
+            idx.lazyMin.update(lo, hi, d);
+            ok = idx.lazySum.query(lo, hi) == scanSum(idx.data, lo, hi);
+            for (int k = lo; k < hi; ++k) {
+                Value v = idx.data.unchecked_get(k);
+                idx.fenwick.set(k, v);
+                idx.minTree.set(k, v);
+                idx.maxTree.set(k, v);
+            }
+        } else {
+            Value s = scanSum(idx.data, lo, hi);
+            ok = idx.fenwick.rangeSum(lo, hi) == s && idx.lazySum.query(lo, hi) == s &&
+                 idx.minTree.query(lo, hi) == scanMin(idx.data, lo, hi) &&
+                 idx.lazyMin.query(lo, hi) == scanMin(idx.data, lo, hi) &&
+                 idx.maxTree.query(lo, hi) == scanMax(idx.data, lo, hi);
+        }
+        if (!ok) {
+            std::cout << "  第 " << i << " 次操作后与逐个扫描不一致！\n";
+            return;
+        }
+    }
+    bool same = true;
+    for (int k = 0; k < n && same; ++k) {
+        Value v = idx.data.unchecked_get(k);
+        same = idx.fenwick.get(k) == v && idx.minTree.get(k) == v && idx.lazySum.get(k) == v && idx.lazyMin.get(k) == v;
+    }
+    for (int r = 0; r < 50 && same; ++r) same = stressAffine(rng) && stressAssign(rng);
+    std::cout << "  " << ops << " 次随机操作完成，"
+              << (same ? "全部与逐个扫描一致（含不满足交换律的运算与区间赋值）" : "结果不一致！") << "\n";
+}
+
+// 两组负载：单点修改 + 区间和查询；区间加 + 区间最小值查询。查询区间长度随机
+void bench(int n, int ops) {
+    std::mt19937 rng(21);
+    Array<Value> data(n);
+    for (int i = 0; i < n; ++i) data.insert(i, static_cast<Value>(rng() % 1000));
+    std::vector<int> lo(ops), hi(ops), pos(ops);
+    std::vector<Value> val(ops);
+    for (int i = 0; i < ops; ++i) {
+        lo[i] = static_cast<int>(rng() % static_cast<unsigned>(n + 1));
+        hi[i] = static_cast<int>(rng() % static_cast<unsigned>(n + 1));
+        if (lo[i] > hi[i]) std::swap(lo[i], hi[i]);
+        pos[i] = static_cast<int>(rng() % static_cast<unsigned>(n));
+        val[i] = static_cast<Value>(rng() % 1000);
+    }
+    int scanOps = static_cast<int>(std::min<long long>(ops, 400000000LL / n));
+
+    FenwickTree<Value> fenwick;
+    SegmentTree<Value> segment;
+    LazySegmentTree<Value> lazySum;
+    double tBuild = timeIt([&]() { fenwick.build(data); });
+    double tSegBuild = timeIt([&]() { segment.build(data); });
+    double tLazyBuild = timeIt([&]() { lazySum.build(data); });
+
+    Array<Value> copy(data);
+    Value s1 = 0, s2 = 0, s3 = 0, s4 = 0;
+    double tScan = timeIt([&]() {
+        for (int i = 0; i < scanOps; ++i) {
+            copy.unchecked_set(pos[i], val[i]);
+            s1 += scanSum(copy, lo[i], hi[i]);
+        }
+    });
+    double tFenwick = timeIt([&]() {
+        for (int i = 0; i < ops; ++i) {
+            fenwick.set(pos[i], val[i]);
+            s2 += fenwick.rangeSum(lo[i], hi[i]);
+        }
+    });
+    double tSegment = timeIt([&]() {
+        for (int i = 0; i < ops; ++i) {
+            segment.set(pos[i], val[i]);
+            s3 += segment.query(lo[i], hi[i]);
+        }
+    });
+    double tLazy = timeIt([&]() {
+        for (int i = 0; i < ops; ++i) {
+            lazySum.set(pos[i], val[i]);
+            s4 += lazySum.query(lo[i], hi[i]);
+        }
+    });
+    std::cout << "  " << n << " 个元素。构建: 树状数组 " << tBuild << " ms，线段树 " << tSegBuild << " ms，懒标记线段树 "
+              << tLazyBuild << " ms\n";
+    std::cout << "  单点修改 + 区间和（每次一对）：逐个扫描 " << (scanOps > 0 ? tScan * 1e6 / scanOps : 0)
+              << " ns，树状数组 " << tFenwick * 1e6 / ops << " ns，线段树 " << tSegment * 1e6 / ops
+              << " ns，懒标记线段树 " << tLazy * 1e6 / ops << " ns"
+              << (scanOps < ops || (s1 == s2 && s2 == s3 && s3 == s4) ? "" : "（结果不一致！）") << "\n";
+
+    Array<Value> copy2(data);
+    LazySegmentTree<Value, MinOp<Value>, RangeAddMinMax<Value> > lazyMin(0, MinOp<Value>::identity());
+    lazyMin.build(data);
+    Value m1 = 0, m2 = 0;
+    double tScanAdd = timeIt([&]() {
+        for (int i = 0; i < scanOps; ++i) {
+            int a = lo[(i + 1) % ops], b = hi[(i + 1) % ops];
+            for (int k = a; k < b; ++k) copy2.unchecked_set(k, copy2.unchecked_get(k) + val[i] - 500);
+            m1 ^= scanMin(copy2, lo[i], hi[i]);
+        }
+    });
+    double tLazyAdd = timeIt([&]() {
+        for (int i = 0; i < ops; ++i) {
+            lazyMin.update(lo[(i + 1) % ops], hi[(i + 1) % ops], val[i] - 500);
+            m2 ^= lazyMin.query(lo[i], hi[i]);
+        }
+    });
+    std::cout << "  区间加 + 区间最小值（每次一对）：逐个扫描 " << (scanOps > 0 ? tScanAdd * 1e6 / scanOps : 0)
+              << " ns，懒标记线段树 " << tLazyAdd * 1e6 / ops << " ns"
+              << (scanOps < ops || m1 == m2 ? "" : "（结果不一致！）") << "\n";
+    if (scanOps < ops) std::cout << "  （逐个扫描只运行前 " << scanOps << " 次）\n";
+}
+
+bool readRange(int& lo, int& hi) {
+    if (std::cin >> lo >> hi) return true;
+    std::cout << "输入有误。用法: <命令> <起点> <终点>\n";
+    clearInput();
+    return false;
+}
+
+int main() {
+#ifdef _WIN32
+    SetConsoleOutputCP(CP_UTF8);
+    SetConsoleCP(CP_UTF8);
+#endif
+    Indexes idx;
+    std::string cmd;
+    printMenu();
+    while (true) {
+        std::cout << "> ";
+        if (!(std::cin >> cmd)) break;
+        try {
+            if (cmd == "build") {
+                int n, maxValue;
+                if (!(std::cin >> n >> maxValue) || n < 0 || maxValue <= 0) {
+                    std::cout << "输入有误。用法: build <个数> <最大值>\n";
+                    clearInput();
+                    continue;
+                }
+                std::mt19937 rng(static_cast<unsigned>(n));
+                Array<Value> fresh(n, GrowthPolicy::geometric(2.0));
+                for (int i = 0; i < n; ++i) fresh.insert(i, static_cast<Value>(rng() % static_cast<unsigned>(maxValue)));
+                idx.data = fresh;
+                idx.build();
+                std::cout << "已构建 " << n << " 个元素。\n";
+            } else if (cmd == "set") {
+                int i;
+                Value v;
+                if (!(std::cin >> i >> v)) {
+                    std::cout << "输入有误。用法: set <下标> <值>\n";
+                    clearInput();
+                    continue;
+                }
+                idx.data.set(i, v);
+                idx.fenwick.set(i, v);
+                idx.minTree.set(i, v);
+                idx.maxTree.set(i, v);
+                idx.lazySum.set(i, v);
+                idx.lazyMin.set(i, v);
+                std::cout << "已修改。\n";
+            } else if (cmd == "add") {
+                int lo, hi;
+                Value d;
+                if (!(std::cin >> lo >> hi >> d)) {
+                    std::cout << "输入有误。用法: add <起点> <终点> <增量>\n";
+                    clearInput();
+                    continue;
+                }
+                idx.lazySum.update(lo, hi, d);
+                idx.lazyMin.update(lo, hi, d);
+                // 其余索引只支持单点修改，逐个同步以便对照
+                for (int k = lo; k < hi; ++k) {
+                    Value v = idx.data.get(k) + d;
+                    idx.data.set(k, v);
+                    idx.fenwick.set(k, v);
+                    idx.minTree.set(k, v);
+                    idx.maxTree.set(k, v);
+                }
+                std::cout << "已对 " << hi - lo << " 个元素加 " << d << "。\n";
+            } else if (cmd == "sum" || cmd == "min" || cmd == "max") {
+                int lo, hi;
+                if (!readRange(lo, hi)) continue;
+                if (cmd == "sum") {
+                    std::cout << "树状数组: " << idx.fenwick.rangeSum(lo, hi) << "，懒标记线段树: "
+                              << idx.lazySum.query(lo, hi) << "，逐个扫描: " << scanSum(idx.data, lo, hi) << "\n";
+                } else if (cmd == "min") {
+                    std::cout << "线段树: " << idx.minTree.query(lo, hi) << "，懒标记线段树: " << idx.lazyMin.query(lo, hi)
+                              << "，逐个扫描: " << scanMin(idx.data, lo, hi) << "\n";
+                } else {
+                    std::cout << "线段树: " << idx.maxTree.query(lo, hi) << "，逐个扫描: " << scanMax(idx.data, lo, hi)
+                              << "\n";
+                }
+            } else if (cmd == "kth") {
+                Value target;
+                if (!(std::cin >> target)) {
+                    std::cout << "输入有误。用法: kth <目标>\n";
+                    clearInput();
+                    continue;
+                }
+                int k = idx.fenwick.lowerBound(target);
+                if (k > idx.fenwick.size()) std::cout << "全部元素之和小于 " << target << "。\n";
+                else std::cout << "前 " << k << " 个元素之和首次达到 " << target << "（元素须非负）\n";
+            } else if (cmd == "print") {
+                std::cout << "数组内容: [";
+                for (int i = 0; i < idx.data.size(); ++i) std::cout << (i ? ", " : "") << idx.data.get(i);
+                std::cout << "]\n";
+            } else if (cmd == "stress" || cmd == "bench") {
+                int a, b = 0;
+                if (!(std::cin >> a) || a <= 0 || (cmd == "bench" && (!(std::cin >> b) || b <= 0))) {
+                    std::cout << "输入有误。用法: " << cmd << (cmd == "bench" ? " <个数> <操作数>" : " <操作数>") << "\n";
+                    clearInput();
+                    continue;
+                }
+                if (cmd == "stress") stress(idx, a);
+                else bench(a, b);
+            } else if (cmd == "help") {
+                printMenu();
+            } else if (cmd == "exit" || cmd == "0") {
+                std::cout << "程序结束，再见！\n";
+                break;
+            } else {
+                std::cout << "未知命令。输入 help 查看菜单。\n";
+            }
+        } catch (const std::exception& e) {
+            std::cout << "错误: " << e.what() << "\n";
+        }
+        clearInput();
+    }
+    return 0;
+}
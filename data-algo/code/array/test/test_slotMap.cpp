@@ -0,0 +1,276 @@
+#include "../include/array.hpp"
+#include "../include/slotMap.hpp"
+#include <chrono>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+typedef SlotMap<int>::Handle Handle;
+
+void printMenu() {
+    std::cout << "\n====== 对象池（SlotMap）交互测试菜单 ======\n";
+    std::cout << "命令列表：\n";
+    std::cout << "  insert <值>                  : 插入对象，返回句柄（槽位 代数）\n";
+    std::cout << "  erase <槽位> <代数>          : 按句柄删除\n";
+    std::cout << "  get <槽位> <代数>            : 按句柄读取（过期句柄返回空）\n";
+    std::cout << "  set <槽位> <代数> <值>       : 按句柄修改\n";
+    std::cout << "  print                        : 按稠密数组顺序打印对象与句柄\n";
+    std::cout << "  size                         : 对象个数、槽位数\n";
+    std::cout << "  clear                        : 删除全部对象（已发出的句柄全部失效）\n";
+    std::cout << "  stress <操作数>              : 随机插入/删除/查找，与 std::map 对照并检查过期句柄\n";
+    std::cout << "  bench <对象数> <操作数>      : 删除+插入与遍历，与 Array、std::unordered_map 对比\n";
+    std::cout << "  help                         : 显示菜单\n";
+    std::cout << "  exit / 0                     : 退出程序\n";
+    std::cout << "-----------------------------------\n";
+    std::cout << "请输入命令: ";
+}
+
+void clearInput() {
+    std::cin.clear();
+    std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+}
+
+// 计时工具：执行f并返回耗时（毫秒）
+template<typename F>
+double timeIt(F f) {
+    auto start = std::chrono::steady_clock::now();
+    f();
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+void stress(SlotMap<int>& pool, int ops) {
+    std::mt19937 rng(3);
+    std::map<std::pair<int, unsigned>, int> ref;
+    std::vector<Handle> live, dead;
+    for (int i = 0; i < pool.size(); ++i) {
+        Handle h = pool.handleAt(i);
+        ref[std::make_pair(h.index, h.generation)] = pool.valueAt(i);
+        live.push_back(h);
+    }
+    for (int i = 0; i < ops; ++i) {
+        int op = static_cast<int>(rng() % 10);
+        bool ok = true;
+        if (op < 5 || live.empty()) {
+            int v = static_cast<int>(rng() % 100000);
+            Handle h = pool.insert(v);
+            ok = ref.insert(std::make_pair(std::make_pair(h.index, h.generation), v)).second;
+            live.push_back(h);
+        } else if (op < 8) {
+            size_t k = rng() % live.size();
+            Handle h = live[k];
+            ok = pool.erase(h) && !pool.erase(h);
+            ref.erase(std::make_pair(h.index, h.generation));
+            live[k] = live.back();
+            live.pop_back();
+            dead.push_back(h);
+        } else {
+            Handle h = live[rng() % live.size()];
+            const int* v = pool.find(h);
+            ok = v != nullptr && *v == ref[std::make_pair(h.index, h.generation)];
+            if (!dead.empty()) ok = ok && pool.find(dead[rng() % dead.size()]) == nullptr;
+        }
+        if (!ok || pool.size() != static_cast<int>(ref.size())) {
+            std::cout << "  第 " << i << " 次操作后与 std::map 不一致！\n";
+            return;
+        }
+    }
+    // 稠密数组中的每个对象都能由自己的句柄找到
+    bool same = true;
+    for (int i = 0; i < pool.size() && same; ++i) {
+        Handle h = pool.handleAt(i);
+        std::map<std::pair<int, unsigned>, int>::iterator it = ref.find(std::make_pair(h.index, h.generation));
+        same = it != ref.end() && it->second == pool.valueAt(i) && &pool.at(h) == &pool.valueAt(i);
+    }
+    for (size_t i = 0; i < dead.size() && same; ++i) same = !pool.contains(dead[i]);
+    std::cout << "  " << ops << " 次随机操作完成，对象 " << pool.size() << " 个，槽位 " << pool.slotCount() << " 个，"
+              << (same ? "与 std::map 一致，过期句柄全部失效" : "与 std::map 不一致！") << "\n";
+}
+
+struct Entity {
+    int id;
+    float x, y, vx, vy;
+    int hp;
+};
+
+Entity makeEntity(int id) {
+    Entity e;
+    e.id = id;
+    e.x = e.y = 0.0f;
+    e.vx = static_cast<float>(id % 7);
+    e.vy = static_cast<float>(id % 5);
+    e.hp = 100;
+    return e;
+}
+
+// n 个实体，每次操作删除一个随机实体再插入一个新实体；之后把全部实体遍历 10 遍。
+// Array 按 id 线性查找后 remove（后续元素前移），只在操作数较少时运行
+void bench(int n, int ops) {
+    std::mt19937 rng(17);
+    std::vector<int> victims(ops);
+    for (int i = 0; i < ops; ++i) victims[i] = static_cast<int>(rng() % static_cast<unsigned>(n));
+
+    SlotMap<Entity> pool(n);
+    std::vector<SlotMap<Entity>::Handle> handles(n);
+    for (int i = 0; i < n; ++i) handles[i] = pool.insert(makeEntity(i));
+    double tPool = timeIt([&]() {
+        for (int i = 0; i < ops; ++i) {
+            int k = victims[i];
+            pool.erase(handles[k]);
+            handles[k] = pool.insert(makeEntity(n + i));
+        }
+    });
+    long long s1 = 0;
+    double tPoolIter = timeIt([&]() {
+        for (int r = 0; r < 10; ++r) {
+            for (int i = 0; i < pool.size(); ++i) {
+                Entity& e = pool.valueAt(i);
+                e.x += e.vx;
+                s1 += e.hp + static_cast<long long>(e.x);
+            }
+        }
+    });
+
+    std::unordered_map<int, Entity> table;
+    std::vector<int> ids(n);
+    for (int i = 0; i < n; ++i) {
+        table[i] = makeEntity(i);
+        ids[i] = i;
+    }
+    double tTable = timeIt([&]() {
+        for (int i = 0; i < ops; ++i) {
+            int k = victims[i];
+            table.erase(ids[k]);
+            ids[k] = n + i;
+            table[ids[k]] = makeEntity(n + i);
+        }
+    });
+    long long s2 = 0;
+    double tTableIter = timeIt([&]() {
+        for (int r = 0; r < 10; ++r) {
+            for (std::unordered_map<int, Entity>::iterator it = table.begin(); it != table.end(); ++it) {
+                Entity& e = it->second;
+                e.x += e.vx;
+                s2 += e.hp + static_cast<long long>(e.x);
+            }
+        }
+    });
+
+    std::cout << "  " << n << " 个实体，" << ops << " 次删除+插入，之后遍历 10 遍\n";
+    std::cout << "  SlotMap: 删除+插入 " << tPool << " ms，遍历 " << tPoolIter << " ms\n";
+    std::cout << "  std::unordered_map: 删除+插入 " << tTable << " ms，遍历 " << tTableIter << " ms"
+              << (s1 == s2 ? "" : "（结果不一致！）") << "\n";
+
+    long long arrayOps = 200000000LL / n;
+    if (arrayOps > ops) arrayOps = ops;
+    Array<Entity> arr(n + 1);
+    for (int i = 0; i < n; ++i) arr.insert(i, makeEntity(i));
+    for (int i = 0; i < n; ++i) ids[i] = i;
+    double tArray = timeIt([&]() {
+        for (long long i = 0; i < arrayOps; ++i) {
+            int k = victims[i];
+            int pos = 0;
+            while (arr.unchecked_get(pos).id != ids[k]) ++pos;
+            arr.remove(pos);
+            ids[k] = n + static_cast<int>(i);
+            arr.insert(arr.size(), makeEntity(ids[k]));
+        }
+    });
+    std::cout << "  Array（按 id 查找后 remove）: " << arrayOps << " 次删除+插入 " << tArray << " ms，折合每次 "
+              << (arrayOps > 0 ? tArray * 1e6 / arrayOps : 0) << " ns（SlotMap 每次 "
+              << (ops > 0 ? tPool * 1e6 / ops : 0) << " ns）\n";
+}
+
+int main() {
+#ifdef _WIN32
+    SetConsoleOutputCP(CP_UTF8);
+    SetConsoleCP(CP_UTF8);
+#endif
+    SlotMap<int> pool;
+    std::string cmd;
+    printMenu();
+    while (true) {
+        std::cout << "> ";
+        if (!(std::cin >> cmd)) break;
+        try {
+            if (cmd == "insert") {
+                int v;
+                if (!(std::cin >> v)) {
+                    std::cout << "输入有误。用法: insert <值>\n";
+                    clearInput();
+                    continue;
+                }
+                Handle h = pool.insert(v);
+                std::cout << "句柄: 槽位 " << h.index << " 代数 " << h.generation << "\n";
+            } else if (cmd == "erase" || cmd == "get" || cmd == "set") {
+                int index;
+                unsigned generation;
+                int v = 0;
+                if (!(std::cin >> index >> generation) || (cmd == "set" && !(std::cin >> v))) {
+                    std::cout << "输入有误。用法: " << cmd << " <槽位> <代数>" << (cmd == "set" ? " <值>" : "") << "\n";
+                    clearInput();
+                    continue;
+                }
+                Handle h(index, generation);
+                if (cmd == "erase") {
+                    std::cout << (pool.erase(h) ? "已删除。\n" : "句柄已过期或无效。\n");
+                } else if (cmd == "get") {
+                    const int* p = pool.find(h);
+                    if (p != nullptr) std::cout << "值为: " << *p << "\n";
+                    else std::cout << "句柄已过期或无效。\n";
+                } else {
+                    pool.at(h) = v;
+                    std::cout << "已修改。\n";
+                }
+            } else if (cmd == "print") {
+                for (int i = 0; i < pool.size(); ++i) {
+                    Handle h = pool.handleAt(i);
+                    std::cout << "[" << i << "] " << pool.valueAt(i) << "（槽位 " << h.index << " 代数 " << h.generation
+                              << "）\n";
+                }
+                std::cout << "共 " << pool.size() << " 个对象\n";
+            } else if (cmd == "size") {
+                std::cout << "对象个数: " << pool.size() << "，槽位数: " << pool.slotCount()
+                          << "，不再复用的槽位: " << pool.retiredSlots() << "\n";
+            } else if (cmd == "clear") {
+                pool.clear();
+                std::cout << "已清空。\n";
+            } else if (cmd == "stress") {
+                int ops;
+                if (!(std::cin >> ops) || ops <= 0) {
+                    std::cout << "输入有误。用法: stress <操作数>\n";
+                    clearInput();
+                    continue;
+                }
+                stress(pool, ops);
+            } else if (cmd == "bench") {
+                int n, ops;
+                if (!(std::cin >> n >> ops) || n <= 0 || ops < 0) {
+                    std::cout << "输入有误。用法: bench <对象数> <操作数>\n";
+                    clearInput();
+                    continue;
+                }
+                bench(n, ops);
+            } else if (cmd == "help") {
+                printMenu();
+            } else if (cmd == "exit" || cmd == "0") {
+                std::cout << "程序结束，再见！\n";
+                break;
+            } else {
+                std::cout << "未知命令。输入 help 查看菜单。\n";
+            }
+        } catch (const std::exception& e) {
+            std::cout << "错误: " << e.what() << "\n";
+        }
+        clearInput();
+    }
+    return 0;
+}
@@ -0,0 +1,906 @@
+#pragma once
+#include "../../vector/code/vector.hpp"
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+#if defined(__SSE4_2__)
+#include <nmmintrin.h>
+#endif
+
+/**
+ * @brief 节点内有序键数组的查找
+ *
+ * 通用版本为二分查找。键为 int（SSE2）或 long long（SSE4.2）且比较器为 std::less 时，
+ * 特化版本每次比较 4 个或 2 个键，按顺序扫描到第一个不满足条件的向量为止：节点的键只占几条缓存行，
+ * 顺序扫描没有二分查找那样难以预测的分支，硬件预取也能覆盖整个节点。
+ *
+ * @tparam K 键类型
+ * @tparam Compare 比较器
+ */
+template<typename K, typename Compare>
+struct BPlusSearch {
+    /**
+     * @brief 第一个不小于 key 的下标
+     */
+    static int lowerBound(const K* keys, int n, const K& key, const Compare& less) {
+        int lo = 0, hi = n;
+        while (lo < hi) {
+            int mid = (lo + hi) / 2;
+            if (less(keys[mid], key)) lo = mid + 1;
+            else hi = mid;
+        }
+        return lo;
+    }
+
+    /**
+     * @brief 第一个大于 key 的下标
+     */
+    static int upperBound(const K* keys, int n, const K& key, const Compare& less) {
+        int lo = 0, hi = n;
+        while (lo < hi) {
+            int mid = (lo + hi) / 2;
+            if (less(key, keys[mid])) hi = mid;
+            else lo = mid + 1;
+        }
+        return lo;
+    }
+};
+
+#if defined(__SSE2__)
+/**
+ * @brief int 键的 SSE2 查找，每次比较 4 个键
+ *
+ * 键有序，满足条件的通道一定是掩码的低位前缀，前缀长度即为该组中满足条件的个数。
+ */
+template<>
+struct BPlusSearch<int, std::less<int>> {
+    static int prefix(int mask) { return (mask & 1) + ((mask >> 1) & 1) + ((mask >> 2) & 1) + ((mask >> 3) & 1); }
+
+    static int lowerBound(const int* keys, int n, const int& key, const std::less<int>&) {
+        __m128i k = _mm_set1_epi32(key);
+        int i = 0;
+        for (; i + 4 <= n; i += 4) {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(keys + i));
+            int mask = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmplt_epi32(v, k)));
+            if (mask != 0xF) return i + prefix(mask);
+        }
+        while (i < n && keys[i] < key) ++i;
+        return i;
+    }
+
+    static int upperBound(const int* keys, int n, const int& key, const std::less<int>&) {
+        __m128i k = _mm_set1_epi32(key);
+        int i = 0;
+        for (; i + 4 <= n; i += 4) {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(keys + i));
+            int mask = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(v, k))) ^ 0xF;
+            if (mask != 0xF) return i + prefix(mask);
+        }
+        while (i < n && !(key < keys[i])) ++i;
+        return i;
+    }
+};
+#endif
+
+#if defined(__SSE4_2__)
+/**
+ * @brief long long 键的 SSE4.2 查找，每次比较 2 个键
+ */
+template<>
+struct BPlusSearch<long long, std::less<long long>> {
+    static int prefix(int mask) { return (mask & 1) + ((mask >> 1) & 1); }
+
+    static int lowerBound(const long long* keys, int n, const long long& key, const std::less<long long>&) {
+        __m128i k = _mm_set1_epi64x(key);
+        int i = 0;
+        for (; i + 2 <= n; i += 2) {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(keys + i));
+            int mask = _mm_movemask_pd(_mm_castsi128_pd(_mm_cmpgt_epi64(k, v)));
+            if (mask != 0x3) return i + prefix(mask);
+        }
+        while (i < n && keys[i] < key) ++i;
+        return i;
+    }
+
+    static int upperBound(const long long* keys, int n, const long long& key, const std::less<long long>&) {
+        __m128i k = _mm_set1_epi64x(key);
+        int i = 0;
+        for (; i + 2 <= n; i += 2) {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(keys + i));
+            int mask = _mm_movemask_pd(_mm_castsi128_pd(_mm_cmpgt_epi64(v, k))) ^ 0x3;
+            if (mask != 0x3) return i + prefix(mask);
+        }
+        while (i < n && !(key < keys[i])) ++i;
+        return i;
+    }
+};
+#endif
+
+/**
+ * @brief B+ 树（有序映射）模板类
+ *
+ * 所有键值对存放在叶子中，叶子按键有序并双向链接；内部节点只存分隔键和孩子指针，用于路由。
+ * 节点的键数组约占 256 字节（4 条缓存行），int 键时每个节点 64 个键，树高约为 log₆₄(n)：
+ * 10⁸ 个键只有 5 层，一次查找只访问 5 个节点，而红黑树要沿 27 层左右的指针逐个跳转。
+ *
+ * - 插入/删除自顶向下：下降前先分裂已满的孩子、补足过少的孩子（向兄弟借或与兄弟合并），不需要回溯
+ * - bulkLoad 从有序序列自底向上建树，节点按给定填充率（默认全满）紧密填充
+ * - 叶子链表使区间扫描只需一次下降，之后顺序读取连续的叶子
+ *
+ * @tparam K 键类型（需可默认构造、可赋值）
+ * @tparam V 值类型（需可默认构造、可赋值）
+ * @tparam Compare 键的严格弱序比较器，默认 std::less<K>
+ */
+template<typename K, typename V, typename Compare = std::less<K>>
+class BPlusTree {
+public:
+    static const int NODE_KEY_BYTES = 256;   ///< 每个节点键数组的目标字节数
+    static const int LEAF_CAPACITY = NODE_KEY_BYTES / sizeof(K) < 4 ? 4 : NODE_KEY_BYTES / sizeof(K);    ///< 叶子最多键数
+    static const int INNER_CAPACITY = NODE_KEY_BYTES / sizeof(K) < 4 ? 4 : NODE_KEY_BYTES / sizeof(K);   ///< 内部节点最多键数
+    static const int LEAF_MIN = LEAF_CAPACITY / 2;             ///< 非根叶子最少键数
+    static const int INNER_MIN = (INNER_CAPACITY - 1) / 2;     ///< 非根内部节点最少键数
+
+private:
+    /**
+     * @brief 节点公共部分
+     */
+    struct Node {
+        bool leaf;   ///< 是否为叶子
+        int count;   ///< 键个数
+        explicit Node(bool isLeaf) : leaf(isLeaf), count(0) {}
+    };
+
+    /**
+     * @brief 叶子：键与值分两个数组存放，查找只扫描键
+     */
+    struct Leaf : Node {
+        K keys[LEAF_CAPACITY];     ///< 有序键
+        V values[LEAF_CAPACITY];   ///< 对应的值
+        Leaf* prev;                ///< 前一个叶子
+        Leaf* next;                ///< 后一个叶子
+        Leaf() : Node(true), prev(nullptr), next(nullptr) {}
+    };
+
+    /**
+     * @brief 内部节点：孩子 i 覆盖 [keys[i-1], keys[i]) 内的键
+     */
+    struct Inner : Node {
+        K keys[INNER_CAPACITY];                ///< 分隔键
+        Node* children[INNER_CAPACITY + 1];    ///< 孩子，个数为 count + 1
+        Inner() : Node(false) {}
+    };
+
+    typedef BPlusSearch<K, Compare> Search;
+
+public:
+    /**
+     * @brief 顺序迭代器，沿叶子链表前进
+     */
+    class Iterator {
+    public:
+        Iterator() : leaf(nullptr), index(0) {}
+        const K& key() const { return leaf->keys[index]; }
+        V& value() const { return leaf->values[index]; }
+        Iterator& operator++() {
+            if (++index == leaf->count) {
+                leaf = leaf->next;
+                index = 0;
+            }
+            return *this;
+        }
+        bool operator==(const Iterator& other) const { return leaf == other.leaf && index == other.index; }
+        bool operator!=(const Iterator& other) const { return !(*this == other); }
+
+    private:
+        friend class BPlusTree;
+        Iterator(Leaf* l, int i) : leaf(l), index(i) {}
+        Leaf* leaf;
+        int index;
+    };
+
+private:
+    Node* root;        ///< 根节点，空树为nullptr
+    Leaf* first;       ///< 最左叶子
+    int length;        ///< 键值对个数
+    int levels;        ///< 层数（空树为0）
+    Compare less;      ///< 键比较器
+
+    static int route(const Inner* node, const K& key, const Compare& less) {
+        return Search::upperBound(node->keys, node->count, key, less);
+    }
+    static bool full(const Node* node) {
+        return node->count == (node->leaf ? LEAF_CAPACITY : INNER_CAPACITY);
+    }
+
+    static int groupCount(int n, int per, int minPer);
+    void splitChild(Inner* parent, int i);
+    void fixChild(Inner* parent, int i);
+    void destroy(Node* node);
+    Leaf* findLeaf(const K& key) const;
+    bool checkNode(const Node* node, int depth, const K* lo, const K* hi, int& leafDepth, int& total) const;
+
+public:
+    /**
+     * @brief 构造空树
+     * @param compare 比较器
+     */
+    explicit BPlusTree(const Compare& compare = Compare());
+
+    /**
+     * @brief 拷贝构造，按源树顺序批量构建，O(n)
+     * @param other 被拷贝的树
+     */
+    BPlusTree(const BPlusTree& other);
+
+    /**
+     * @brief 移动构造，O(1)
+     * @param other 被移动的树，之后为空树
+     */
+    BPlusTree(BPlusTree&& other) noexcept;
+
+    /**
+     * @brief 赋值操作符（拷贝并交换）
+     * @param other 被赋值的树
+     * @return 当前对象的引用
+     */
+    BPlusTree& operator=(BPlusTree other) noexcept;
+
+    /**
+     * @brief 析构函数，释放所有节点
+     */
+    ~BPlusTree();
+
+    /**
+     * @brief 插入键值对，键已存在时更新值，O(log n)
+     * @param key 键
+     * @param value 值
+     * @return 新插入返回true，更新返回false
+     */
+    bool insert(const K& key, const V& value);
+
+    /**
+     * @brief 查找键，O(log n)
+     * @param key 键
+     * @return 指向值的指针，不存在返回nullptr
+     */
+    V* find(const K& key);
+    const V* find(const K& key) const;
+
+    /**
+     * @brief 判断键是否存在
+     * @param key 键
+     * @return 存在返回true
+     */
+    bool contains(const K& key) const { return find(key) != nullptr; }
+
+    /**
+     * @brief 获取键对应的值
+     * @param key 键
+     * @return 值的引用
+     * @throws std::out_of_range 如果键不存在
+     */
+    V& at(const K& key);
+
+    /**
+     * @brief 删除键，O(log n)
+     * @param key 键
+     * @return 删除成功返回true，键不存在返回false
+     */
+    bool erase(const K& key);
+
+    /**
+     * @brief 用严格递增的键序列重建整棵树，自底向上逐层紧密填充，O(n)
+     * @param keys 有序键数组
+     * @param values 对应的值数组
+     * @param n 个数
+     * @param fill 填充率 [0.5, 1]，小于1时为之后的插入预留空位
+     * @throws std::invalid_argument 如果键不是严格递增或填充率越界（树保持不变）
+     * @throws std::bad_alloc 如果分配节点失败（已建好的节点被释放，树为空）
+     */
+    void bulkLoad(const K* keys, const V* values, int n, double fill = 1.0);
+
+    /**
+     * @brief 从有序 Vector 批量构建
+     * @param keys 严格递增的键
+     * @param values 对应的值，个数须与键相同
+     * @param fill 填充率 [0.5, 1]
+     * @throws std::invalid_argument 如果个数不同、键不是严格递增或填充率越界
+     */
+    void bulkLoad(const Vector<K>& keys, const Vector<V>& values, double fill = 1.0);
+
+    /**
+     * @brief 第一个键不小于 key 的位置，O(log n)
+     * @param key 键
+     * @return 迭代器，不存在时等于 end()
+     */
+    Iterator lowerBound(const K& key) const;
+
+    Iterator begin() const { return Iterator(length == 0 ? nullptr : first, 0); }
+    Iterator end() const { return Iterator(nullptr, 0); }
+
+    /**
+     * @brief 按键升序访问 [lo, hi) 内的元素，O(log n + k)
+     * @param lo 下界（含）
+     * @param hi 上界（不含）
+     * @param visit 回调 visit(key, value)
+     * @return 访问的元素个数
+     */
+    template<typename F>
+    int range(const K& lo, const K& hi, F visit) const;
+
+    /**
+     * @brief 按键升序遍历全部元素
+     * @param visit 访问函数
+     */
+    void traverse(void (*visit)(const K&, const V&)) const;
+
+    /**
+     * @brief 清空
+     */
+    void clear();
+
+    /**
+     * @brief 交换两棵树
+     * @param other 另一棵树
+     */
+    void swap(BPlusTree& other) noexcept;
+
+    int size() const { return length; }
+    bool empty() const { return length == 0; }
+
+    /**
+     * @brief 层数（根到叶子的节点数），空树为0
+     */
+    int height() const { return levels; }
+
+    /**
+     * @brief 检查结构不变式：键有序且落在分隔键区间内、非根节点不少于半满、叶子同深度、叶子链表与个数一致
+     * @return 全部满足返回true
+     */
+    bool check() const;
+
+    /**
+     * @brief 按层访问节点，visit(层号, 是否叶子, 键数组, 键个数)，层号从根的0开始
+     * @param visit 回调
+     */
+    template<typename F>
+    void forEachNode(F visit) const;
+};
+
+// ================== 实现部分 ==================
+
+// 构造空树
+template<typename K, typename V, typename Compare>
+BPlusTree<K, V, Compare>::BPlusTree(const Compare& compare)
+    : root(nullptr), first(nullptr), length(0), levels(0), less(compare) {}
+
+// 拷贝构造：源树已有序，取出后批量构建
+template<typename K, typename V, typename Compare>
+BPlusTree<K, V, Compare>::BPlusTree(const BPlusTree& other) : BPlusTree(other.less) {
+    std::vector<K> keys;
+    std::vector<V> values;
+    keys.reserve(other.length);
+    values.reserve(other.length);
+    for (Iterator it = other.begin(); it != other.end(); ++it) {
+        keys.push_back(it.key());
+        values.push_back(it.value());
+    }
+    if (other.length > 0) bulkLoad(&keys[0], &values[0], other.length);
+}
+
+// 移动构造
+template<typename K, typename V, typename Compare>
+BPlusTree<K, V, Compare>::BPlusTree(BPlusTree&& other) noexcept
+    : root(other.root), first(other.first), length(other.length), levels(other.levels), less(other.less) {
+    other.root = nullptr;
+    other.first = nullptr;
+    other.length = 0;
+    other.levels = 0;
+}
+
+// 赋值：参数按值传入，交换即可
+template<typename K, typename V, typename Compare>
+BPlusTree<K, V, Compare>& BPlusTree<K, V, Compare>::operator=(BPlusTree other) noexcept {
+    swap(other);
+    return *this;
+}
+
+// 析构函数
+template<typename K, typename V, typename Compare>
+BPlusTree<K, V, Compare>::~BPlusTree() {
+    destroy(root);
+}
+
+// 递归释放子树
+template<typename K, typename V, typename Compare>
+void BPlusTree<K, V, Compare>::destroy(Node* node) {
+    if (node == nullptr) return;
+    if (node->leaf) {
+        delete static_cast<Leaf*>(node);
+        return;
+    }
+    Inner* inner = static_cast<Inner*>(node);
+    for (int i = 0; i <= inner->count; ++i) destroy(inner->children[i]);
+    delete inner;
+}
+
+// 分裂已满的孩子 i：叶子把后一半移到新叶子，分隔键为新叶子的首键；
+// 内部节点把中间键上移，其后的键和孩子移到新节点
+template<typename K, typename V, typename Compare>
+void BPlusTree<K, V, Compare>::splitChild(Inner* parent, int i) {
+    Node* child = parent->children[i];
+    Node* right;
+    K separator;
+    if (child->leaf) {
+        Leaf* left = static_cast<Leaf*>(child);
+        Leaf* node = new Leaf();
+        int mid = left->count / 2;
+        for (int j = mid; j < left->count; ++j) {
+            node->keys[j - mid] = left->keys[j];
+            node->values[j - mid] = left->values[j];
+        }
+        node->count = left->count - mid;
+        left->count = mid;
+        node->next = left->next;
+        node->prev = left;
+        if (left->next != nullptr) left->next->prev = node;
+        left->next = node;
+        separator = node->keys[0];
+        right = node;
+    } else {
+        Inner* left = static_cast<Inner*>(child);
+        Inner* node = new Inner();
+        int mid = left->count / 2;
+        separator = left->keys[mid];
+        for (int j = mid + 1; j < left->count; ++j) node->keys[j - mid - 1] = left->keys[j];
+        for (int j = mid + 1; j <= left->count; ++j) node->children[j - mid - 1] = left->children[j];
+        node->count = left->count - mid - 1;
+        left->count = mid;
+        right = node;
+    }
+    for (int j = parent->count; j > i; --j) {
+        parent->keys[j] = parent->keys[j - 1];
+        parent->children[j + 1] = parent->children[j];
+    }
+    parent->keys[i] = separator;
+    parent->children[i + 1] = right;
+    ++parent->count;
+}
+
+// 插入：根已满时先分裂根；下降途中遇到已满的孩子先分裂，叶子一定有空位
+template<typename K, typename V, typename Compare>
+bool BPlusTree<K, V, Compare>::insert(const K& key, const V& value) {
+    if (root == nullptr) {
+        Leaf* leaf = new Leaf();
+        root = first = leaf;
+        levels = 1;
+    }
+    if (full(root)) {
+        Inner* top = new Inner();
+        top->children[0] = root;
+        root = top;
+        ++levels;
+        splitChild(top, 0);
+    }
+    Node* node = root;
+    while (!node->leaf) {
+        Inner* inner = static_cast<Inner*>(node);
+        int i = route(inner, key, less);
+        if (full(inner->children[i])) {
+            splitChild(inner, i);
+            if (!less(key, inner->keys[i])) ++i;
+        }
+        node = inner->children[i];
+    }
+    Leaf* leaf = static_cast<Leaf*>(node);
+    int pos = Search::lowerBound(leaf->keys, leaf->count, key, less);
+    if (pos < leaf->count && !less(key, leaf->keys[pos])) {
+        leaf->values[pos] = value;
+        return false;
+    }
+    for (int j = leaf->count; j > pos; --j) {
+        leaf->keys[j] = leaf->keys[j - 1];
+        leaf->values[j] = leaf->values[j - 1];
+    }
+    leaf->keys[pos] = key;
+    leaf->values[pos] = value;
+    ++leaf->count;
+    ++length;
+    return true;
+}
+
+// 从根下降到可能包含 key 的叶子
+template<typename K, typename V, typename Compare>
+typename BPlusTree<K, V, Compare>::Leaf* BPlusTree<K, V, Compare>::findLeaf(const K& key) const {
+    Node* node = root;
+    if (node == nullptr) return nullptr;
+    while (!node->leaf) {
+        const Inner* inner = static_cast<const Inner*>(node);
+        node = inner->children[route(inner, key, less)];
+    }
+    return static_cast<Leaf*>(node);
+}
+
+// 查找键
+template<typename K, typename V, typename Compare>
+V* BPlusTree<K, V, Compare>::find(const K& key) {
+    Leaf* leaf = findLeaf(key);
+    if (leaf == nullptr) return nullptr;
+    int pos = Search::lowerBound(leaf->keys, leaf->count, key, less);
+    if (pos < leaf->count && !less(key, leaf->keys[pos])) return &leaf->values[pos];
+    return nullptr;
+}
+
+// 查找键（常量版本）
+template<typename K, typename V, typename Compare>
+const V* BPlusTree<K, V, Compare>::find(const K& key) const {
+    return const_cast<BPlusTree*>(this)->find(key);
+}
+
+// 获取键对应的值，不存在时抛出异常
+template<typename K, typename V, typename Compare>
+V& BPlusTree<K, V, Compare>::at(const K& key) {
+    V* v = find(key);
+    if (v == nullptr) {
+        throw std::out_of_range("Key not found");
+    }
+    return *v;
+}
+
+// 补足孩子 i：左兄弟或右兄弟多于最少键数时借一个，否则与一个兄弟合并
+template<typename K, typename V, typename Compare>
+void BPlusTree<K, V, Compare>::fixChild(Inner* parent, int i) {
+    Node* child = parent->children[i];
+    Node* leftSib = i > 0 ? parent->children[i - 1] : nullptr;
+    Node* rightSib = i < parent->count ? parent->children[i + 1] : nullptr;
+    int minCount = child->leaf ? LEAF_MIN : INNER_MIN;
+    if (child->leaf) {
+        Leaf* c = static_cast<Leaf*>(child);
+        if (leftSib != nullptr && leftSib->count > minCount) {
+            Leaf* l = static_cast<Leaf*>(leftSib);
+            for (int j = c->count; j > 0; --j) {
+                c->keys[j] = c->keys[j - 1];
+                c->values[j] = c->values[j - 1];
+            }
+            c->keys[0] = l->keys[l->count - 1];
+            c->values[0] = l->values[l->count - 1];
+            ++c->count;
+            --l->count;
+            parent->keys[i - 1] = c->keys[0];
+            return;
+        }
+        if (rightSib != nullptr && rightSib->count > minCount) {
+            Leaf* r = static_cast<Leaf*>(rightSib);
+            c->keys[c->count] = r->keys[0];
+            c->values[c->count] = r->values[0];
+            ++c->count;
+            for (int j = 1; j < r->count; ++j) {
+                r->keys[j - 1] = r->keys[j];
+                r->values[j - 1] = r->values[j];
+            }
+            --r->count;
+            parent->keys[i] = r->keys[0];
+            return;
+        }
+    } else {
+        Inner* c = static_cast<Inner*>(child);
+        if (leftSib != nullptr && leftSib->count > minCount) {
+            Inner* l = static_cast<Inner*>(leftSib);
+            for (int j = c->count; j > 0; --j) c->keys[j] = c->keys[j - 1];
+            for (int j = c->count + 1; j > 0; --j) c->children[j] = c->children[j - 1];
+            c->keys[0] = parent->keys[i - 1];
+            c->children[0] = l->children[l->count];
+            ++c->count;
+            parent->keys[i - 1] = l->keys[l->count - 1];
+            --l->count;
+            return;
+        }
+        if (rightSib != nullptr && rightSib->count > minCount) {
+            Inner* r = static_cast<Inner*>(rightSib);
+            c->keys[c->count] = parent->keys[i];
+            c->children[c->count + 1] = r->children[0];
+            ++c->count;
+            parent->keys[i] = r->keys[0];
+            for (int j = 1; j < r->count; ++j) r->keys[j - 1] = r->keys[j];
+            for (int j = 1; j <= r->count; ++j) r->children[j - 1] = r->children[j];
+            --r->count;
+            return;
+        }
+    }
+    // 两侧兄弟都只有最少键数：把右边的节点并入左边的节点，删去父节点中的分隔键
+    int li = rightSib != nullptr ? i : i - 1;
+    Node* left = parent->children[li];
+    Node* right = parent->children[li + 1];
+    if (left->leaf) {
+        Leaf* l = static_cast<Leaf*>(left);
+        Leaf* r = static_cast<Leaf*>(right);
+        for (int j = 0; j < r->count; ++j) {
+            l->keys[l->count + j] = r->keys[j];
+            l->values[l->count + j] = r->values[j];
+        }
+        l->count += r->count;
+        l->next = r->next;
+        if (r->next != nullptr) r->next->prev = l;
+        delete r;
+    } else {
+        Inner* l = static_cast<Inner*>(left);
+        Inner* r = static_cast<Inner*>(right);
+        l->keys[l->count] = parent->keys[li];
+        for (int j = 0; j < r->count; ++j) l->keys[l->count + 1 + j] = r->keys[j];
+        for (int j = 0; j <= r->count; ++j) l->children[l->count + 1 + j] = r->children[j];
+        l->count += r->count + 1;
+        delete r;
+    }
+    for (int j = li; j < parent->count - 1; ++j) {
+        parent->keys[j] = parent->keys[j + 1];
+        parent->children[j + 1] = parent->children[j + 2];
+    }
+    --parent->count;
+}
+
+// 删除：下降前保证孩子多于最少键数，删除后叶子仍不少于半满；根只剩一个孩子时树高减一
+template<typename K, typename V, typename Compare>
+bool BPlusTree<K, V, Compare>::erase(const K& key) {
+    if (root == nullptr) return false;
+    Node* node = root;
+    while (!node->leaf) {
+        Inner* inner = static_cast<Inner*>(node);
+        int i = route(inner, key, less);
+        int minCount = inner->children[i]->leaf ? LEAF_MIN : INNER_MIN;
+        if (inner->children[i]->count <= minCount) {
+            fixChild(inner, i);
+            i = route(inner, key, less);
+        }
+        if (inner == root && inner->count == 0) {
+            root = inner->children[0];
+            delete inner;
+            --levels;
+            node = root;
+            continue;
+        }
+        node = inner->children[i];
+    }
+    Leaf* leaf = static_cast<Leaf*>(node);
+    int pos = Search::lowerBound(leaf->keys, leaf->count, key, less);
+    if (pos == leaf->count || less(key, leaf->keys[pos])) return false;
+    for (int j = pos + 1; j < leaf->count; ++j) {
+        leaf->keys[j - 1] = leaf->keys[j];
+        leaf->values[j - 1] = leaf->values[j];
+    }
+    --leaf->count;
+    --length;
+    if (length == 0) clear();
+    return true;
+}
+
+// 把 n 个元素平均分到若干节点：节点数取 ceil(n / per)，若平均数低于 minPer 再减少节点数，
+// 每个节点分到 n / 节点数 或多一个，不超过 per 也不少于 minPer（只有一个节点时除外）
+template<typename K, typename V, typename Compare>
+int BPlusTree<K, V, Compare>::groupCount(int n, int per, int minPer) {
+    int groups = (n + per - 1) / per;
+    if (groups > 1 && n / groups < minPer) groups = n / minPer;
+    return groups < 1 ? 1 : groups;
+}
+
+// 批量构建：先检查输入，再逐层平均切分；内部节点的分隔键为右侧各孩子子树的最小键
+template<typename K, typename V, typename Compare>
+void BPlusTree<K, V, Compare>::bulkLoad(const K* keys, const V* values, int n, double fill) {
+    if (!(fill >= 0.5 && fill <= 1.0)) {
+        throw std::invalid_argument("Fill factor must be in [0.5, 1]");
+    }
+    for (int i = 1; i < n; ++i) {
+        if (!less(keys[i - 1], keys[i])) {
+            throw std::invalid_argument("Keys must be strictly increasing");
+        }
+    }
+    clear();
+    if (n <= 0) return;
+
+    // level 与 up 中的非空指针是尚未挂到上层的子树；节点被父节点接管后对应位置置空，
+    // 中途分配或拷贝失败时据此释放已建好的部分，树保持为空
+    std::vector<Node*> level, up;
+    try {
+        // 叶子层
+        int perLeaf = static_cast<int>(LEAF_CAPACITY * fill);
+        int leafCount = groupCount(n, perLeaf < LEAF_MIN ? LEAF_MIN : perLeaf, LEAF_MIN);
+        level.assign(leafCount, nullptr);
+        std::vector<K> lows(leafCount);
+        Leaf* prev = nullptr;
+        Leaf* head = nullptr;
+        int pos = 0;
+        for (int b = 0; b < leafCount; ++b) {
+            int take = n / leafCount + (b < n % leafCount ? 1 : 0);
+            Leaf* leaf = new Leaf();
+            level[b] = leaf;
+            for (int j = 0; j < take; ++j) {
+                leaf->keys[j] = keys[pos + j];
+                leaf->values[j] = values[pos + j];
+            }
+            leaf->count = take;
+            leaf->prev = prev;
+            if (prev != nullptr) prev->next = leaf;
+            else head = leaf;
+            prev = leaf;
+            lows[b] = keys[pos];
+            pos += take;
+        }
+        int height = 1;
+
+        // 内部节点层，每个节点的孩子数在 [INNER_MIN + 1, INNER_CAPACITY + 1] 内
+        int perInner = static_cast<int>(INNER_CAPACITY * fill) + 1;
+        while (level.size() > 1) {
+            int m = static_cast<int>(level.size());
+            int parents = groupCount(m, perInner < INNER_MIN + 1 ? INNER_MIN + 1 : perInner, INNER_MIN + 1);
+            up.assign(parents, nullptr);
+            std::vector<K> upLows(parents);
+            int c = 0;
+            for (int b = 0; b < parents; ++b) {
+                int take = m / parents + (b < m % parents ? 1 : 0);
+                Inner* inner = new Inner();
+                for (int j = 0; j < take; ++j) {
+                    inner->children[j] = level[c + j];
+                    level[c + j] = nullptr;
+                }
+                inner->count = take - 1;
+                up[b] = inner;
+                for (int j = 1; j < take; ++j) inner->keys[j - 1] = lows[c + j];
+                upLows[b] = lows[c];
+                c += take;
+            }
+            level.swap(up);
+            up.clear();
+            lows.swap(upLows);
+            ++height;
+        }
+        root = level[0];
+        first = head;
+        length = n;
+        levels = height;
+    } catch (...) {
+        for (size_t i = 0; i < level.size(); ++i) destroy(level[i]);
+        for (size_t i = 0; i < up.size(); ++i) destroy(up[i]);
+        throw;
+    }
+}
+
+// 从有序 Vector 批量构建
+template<typename K, typename V, typename Compare>
+void BPlusTree<K, V, Compare>::bulkLoad(const Vector<K>& keys, const Vector<V>& values, double fill) {
+    if (keys.size() != values.size()) {
+        throw std::invalid_argument("Keys and values must have the same size");
+    }
+    bulkLoad(keys.data(), values.data(), keys.size(), fill);
+}
+
+// 第一个不小于 key 的位置：所在叶子中没有时为下一个叶子的首个元素
+template<typename K, typename V, typename Compare>
+typename BPlusTree<K, V, Compare>::Iterator BPlusTree<K, V, Compare>::lowerBound(const K& key) const {
+    Leaf* leaf = findLeaf(key);
+    if (leaf == nullptr) return end();
+    int pos = Search::lowerBound(leaf->keys, leaf->count, key, less);
+    if (pos == leaf->count) return Iterator(leaf->next, 0);
+    return Iterator(leaf, pos);
+}
+
+// 区间访问：一次下降后沿叶子链表顺序读取
+template<typename K, typename V, typename Compare>
+template<typename F>
+int BPlusTree<K, V, Compare>::range(const K& lo, const K& hi, F visit) const {
+    Leaf* leaf = findLeaf(lo);
+    if (leaf == nullptr) return 0;
+    int pos = Search::lowerBound(leaf->keys, leaf->count, lo, less);
+    int visited = 0;
+    while (leaf != nullptr) {
+        for (; pos < leaf->count; ++pos) {
+            if (!less(leaf->keys[pos], hi)) return visited;
+            visit(leaf->keys[pos], leaf->values[pos]);
+            ++visited;
+        }
+        leaf = leaf->next;
+        pos = 0;
+    }
+    return visited;
+}
+
+// 按序遍历全部元素
+template<typename K, typename V, typename Compare>
+void BPlusTree<K, V, Compare>::traverse(void (*visit)(const K&, const V&)) const {
+    for (Leaf* leaf = length == 0 ? nullptr : first; leaf != nullptr; leaf = leaf->next) {
+        for (int i = 0; i < leaf->count; ++i) visit(leaf->keys[i], leaf->values[i]);
+    }
+}
+
+// 清空
+template<typename K, typename V, typename Compare>
+void BPlusTree<K, V, Compare>::clear() {
+    destroy(root);
+    root = nullptr;
+    first = nullptr;
+    length = 0;
+    levels = 0;
+}
+
+// 交换两棵树
+template<typename K, typename V, typename Compare>
+void BPlusTree<K, V, Compare>::swap(BPlusTree& other) noexcept {
+    std::swap(root, other.root);
+    std::swap(first, other.first);
+    std::swap(length, other.length);
+    std::swap(levels, other.levels);
+    std::swap(less, other.less);
+}
+
+// 递归检查子树，lo/hi 为父节点给出的键区间 [lo, hi)，为空表示无界
+template<typename K, typename V, typename Compare>
+bool BPlusTree<K, V, Compare>::checkNode(const Node* node, int depth, const K* lo, const K* hi, int& leafDepth,
+                                         int& total) const {
+    bool isRoot = node == root;
+    const K* keys = node->leaf ? static_cast<const Leaf*>(node)->keys : static_cast<const Inner*>(node)->keys;
+    int minCount = node->leaf ? LEAF_MIN : INNER_MIN;
+    if (node->count > (node->leaf ? LEAF_CAPACITY : INNER_CAPACITY)) return false;
+    if (!isRoot && node->count < minCount) return false;
+    if (isRoot && !node->leaf && node->count < 1) return false;
+    for (int i = 0; i < node->count; ++i) {
+        if (i > 0 && !less(keys[i - 1], keys[i])) return false;
+        if (lo != nullptr && less(keys[i], *lo)) return false;
+        if (hi != nullptr && !less(keys[i], *hi)) return false;
+    }
+    if (node->leaf) {
+        if (leafDepth < 0) leafDepth = depth;
+        total += node->count;
+        return leafDepth == depth;
+    }
+    const Inner* inner = static_cast<const Inner*>(node);
+    for (int i = 0; i <= inner->count; ++i) {
+        const K* clo = i == 0 ? lo : &inner->keys[i - 1];
+        const K* chi = i == inner->count ? hi : &inner->keys[i];
+        if (!checkNode(inner->children[i], depth + 1, clo, chi, leafDepth, total)) return false;
+    }
+    return true;
+}
+
+// 检查全部不变式，另沿叶子链表核对个数与顺序
+template<typename K, typename V, typename Compare>
+bool BPlusTree<K, V, Compare>::check() const {
+    if (root == nullptr) return length == 0 && levels == 0 && first == nullptr;
+    int leafDepth = -1, total = 0;
+    if (!checkNode(root, 0, nullptr, nullptr, leafDepth, total)) return false;
+    if (total != length || leafDepth + 1 != levels) return false;
+    int chained = 0;
+    const Leaf* prev = nullptr;
+    for (const Leaf* leaf = first; leaf != nullptr; prev = leaf, leaf = leaf->next) {
+        if (leaf->prev != prev) return false;
+        if (prev != nullptr && prev->count > 0 && leaf->count > 0 &&
+            !less(prev->keys[prev->count - 1], leaf->keys[0]))
+            return false;
+        chained += leaf->count;
+    }
+    return chained == length;
+}
+
+// 按层访问节点
+template<typename K, typename V, typename Compare>
+template<typename F>
+void BPlusTree<K, V, Compare>::forEachNode(F visit) const {
+    if (root == nullptr) return;
+    std::vector<const Node*> cur(1, root), next;
+    for (int depth = 0; !cur.empty(); ++depth) {
+        next.clear();
+        for (size_t i = 0; i < cur.size(); ++i) {
+            const Node* node = cur[i];
+            if (node->leaf) {
+                visit(depth, true, static_cast<const Leaf*>(node)->keys, node->count);
+            } else {
+                const Inner* inner = static_cast<const Inner*>(node);
+                visit(depth, false, inner->keys, node->count);
+                for (int j = 0; j <= inner->count; ++j) next.push_back(inner->children[j]);
+            }
+        }
+        cur.swap(next);
+    }
+}
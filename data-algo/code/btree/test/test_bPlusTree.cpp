@@ -0,0 +1,303 @@
+#include "../include/bPlusTree.hpp"
+#include "../../skiplist/include/skipList.hpp"
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+void printMenu() {
+    std::cout << "\n====== B+ 树交互测试菜单 ======\n";
+    std::cout << "命令列表：\n";
+    std::cout << "  insert <键> <值>          : 插入或更新\n";
+    std::cout << "  find <键>                 : 查找\n";
+    std::cout << "  erase <键>                : 删除\n";
+    std::cout << "  range <下界> <上界>       : 按序列出 [下界,上界) 内的元素\n";
+    std::cout << "  lower <键>                : 第一个不小于键的元素\n";
+    std::cout << "  random <个数> <键上界>    : 插入随机键\n";
+    std::cout << "  bulk <个数> [填充率]      : 用键 0,2,4,... 批量构建（替换全部内容）\n";
+    std::cout << "  print                     : 按序打印全部元素\n";
+    std::cout << "  nodes                     : 按层打印节点（每层最多 8 个节点）\n";
+    std::cout << "  size                      : 元素个数与层数\n";
+    std::cout << "  check                     : 检查结构不变式\n";
+    std::cout << "  clear                     : 清空\n";
+    std::cout << "  stress <操作数>           : 随机插入/删除/查找，与 std::map 对照并检查不变式\n";
+    std::cout << "  bench <个数>              : 与 std::map（红黑树）、SkipList 对比插入、查找、区间扫描\n";
+    std::cout << "  help                      : 显示菜单\n";
+    std::cout << "  exit / 0                  : 退出程序\n";
+    std::cout << "-----------------------------------\n";
+    std::cout << "请输入命令: ";
+}
+
+void clearInput() {
+    std::cin.clear();
+    std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+}
+
+// 计时工具：执行f并返回耗时（毫秒）
+template<typename F>
+double timeIt(F f) {
+    auto start = std::chrono::steady_clock::now();
+    f();
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+// 与 std::less<int> 等价，但不匹配 SIMD 特化，用于对比节点内二分查找
+struct PlainLess {
+    bool operator()(int a, int b) const { return a < b; }
+};
+
+void printPair(const int& key, const int& value) {
+    std::cout << key << ":" << value << " ";
+}
+
+void printNodes(const BPlusTree<int, int>& tree) {
+    int lastDepth = -1, shown = 0;
+    tree.forEachNode([&](int depth, bool leaf, const int* keys, int count) {
+        if (depth != lastDepth) {
+            std::cout << (lastDepth < 0 ? "" : "\n") << "L" << depth << (leaf ? "（叶子）" : "") << ":";
+            lastDepth = depth;
+            shown = 0;
+        }
+        if (++shown > 8) {
+            if (shown == 9) std::cout << " ...";
+            return;
+        }
+        std::cout << " [";
+        for (int i = 0; i < count; ++i) {
+            if (i == 3 && count > 6) {
+                std::cout << " ..";
+                i = count - 3;
+            }
+            std::cout << (i ? " " : "") << keys[i];
+        }
+        std::cout << "](" << count << ")";
+    });
+    std::cout << "\n";
+}
+
+void stress(BPlusTree<int, int>& tree, int ops) {
+    std::mt19937 rng(7);
+    std::map<int, int> ref;
+    for (BPlusTree<int, int>::Iterator it = tree.begin(); it != tree.end(); ++it) ref[it.key()] = it.value();
+    int range = ops / 2 + 16;
+    for (int i = 0; i < ops; ++i) {
+        int k = static_cast<int>(rng() % static_cast<unsigned>(range));
+        int op = static_cast<int>(rng() % 10);
+        bool ok = true;
+        if (op < 5) {
+            bool added = ref.find(k) == ref.end();
+            ref[k] = i;
+            ok = tree.insert(k, i) == added;
+        } else if (op < 8) {
+            ok = tree.erase(k) == (ref.erase(k) == 1);
+        } else {
+            const int* v = tree.find(k);
+            std::map<int, int>::iterator it = ref.find(k);
+            ok = (v != nullptr) == (it != ref.end()) && (v == nullptr || *v == it->second);
+        }
+        if (!ok || (i % 1000 == 0 && !tree.check())) {
+            std::cout << "  第 " << i << " 次操作后与 std::map 不一致或不变式被破坏！\n";
+            return;
+        }
+    }
+    bool same = tree.check() && tree.size() == static_cast<int>(ref.size());
+    std::map<int, int>::iterator r = ref.begin();
+    for (BPlusTree<int, int>::Iterator it = tree.begin(); same && it != tree.end(); ++it, ++r)
+        same = it.key() == r->first && it.value() == r->second;
+    std::cout << "  " << ops << " 次随机操作完成，元素 " << tree.size() << " 个，层数 " << tree.height() << "，"
+              << (same ? "与 std::map 一致" : "与 std::map 不一致！") << "\n";
+}
+
+// n 个随机键：逐个插入、批量构建、随机查找、区间扫描（每次约 100 个元素）
+void bench(int n) {
+    std::mt19937 rng(42);
+    std::vector<int> keys(n);
+    for (int i = 0; i < n; ++i) keys[i] = static_cast<int>(rng() & 0x7FFFFFFF);
+    std::vector<int> probes(keys);
+    std::shuffle(probes.begin(), probes.end(), rng);
+    int scans = n / 100 < 100000 ? n / 100 + 1 : 100000;
+    int span = static_cast<int>(0x7FFFFFFFLL / n * 100);
+
+    BPlusTree<int, int> tree;
+    std::map<int, int> rb;
+    SkipList<int, int> skip;
+    double tInsert = timeIt([&]() {
+        for (int i = 0; i < n; ++i) tree.insert(keys[i], i);
+    });
+    double tMapInsert = timeIt([&]() {
+        for (int i = 0; i < n; ++i) rb[keys[i]] = i;
+    });
+    double tSkipInsert = timeIt([&]() {
+        for (int i = 0; i < n; ++i) skip.insert(keys[i], i);
+    });
+
+    // 批量构建：先排序去重（与逐个插入的结果一致，值取最后一次插入的下标）
+    Vector<int> sortedKeys, sortedValues;
+    std::vector<std::pair<int, int> > pairs;
+    for (int i = 0; i < n; ++i) pairs.push_back(std::make_pair(keys[i], i));
+    std::stable_sort(pairs.begin(), pairs.end(),
+                     [](const std::pair<int, int>& a, const std::pair<int, int>& b) { return a.first < b.first; });
+    for (size_t i = 0; i < pairs.size(); ++i) {
+        if (i + 1 < pairs.size() && pairs[i + 1].first == pairs[i].first) continue;
+        sortedKeys.push_back(pairs[i].first);
+        sortedValues.push_back(pairs[i].second);
+    }
+    BPlusTree<int, int> bulk;
+    double tBulk = timeIt([&]() { bulk.bulkLoad(sortedKeys, sortedValues); });
+    BPlusTree<int, int, PlainLess> plain;
+    plain.bulkLoad(sortedKeys.data(), sortedValues.data(), sortedKeys.size());
+
+    long long s1 = 0, s2 = 0, s3 = 0, s4 = 0, s5 = 0;
+    double tFind = timeIt([&]() {
+        for (int i = 0; i < n; ++i) s1 += *tree.find(probes[i]);
+    });
+    double tBulkFind = timeIt([&]() {
+        for (int i = 0; i < n; ++i) s2 += *bulk.find(probes[i]);
+    });
+    double tPlainFind = timeIt([&]() {
+        for (int i = 0; i < n; ++i) s3 += *plain.find(probes[i]);
+    });
+    double tMapFind = timeIt([&]() {
+        for (int i = 0; i < n; ++i) s4 += rb.find(probes[i])->second;
+    });
+    double tSkipFind = timeIt([&]() {
+        for (int i = 0; i < n; ++i) s5 += *skip.find(probes[i]);
+    });
+
+    long long r1 = 0, r2 = 0, r3 = 0;
+    double tRange = timeIt([&]() {
+        for (int i = 0; i < scans; ++i)
+            bulk.range(probes[i], probes[i] + span, [&](const int&, const int& v) { r1 += v; });
+    });
+    double tMapRange = timeIt([&]() {
+        for (int i = 0; i < scans; ++i) {
+            std::map<int, int>::const_iterator it = rb.lower_bound(probes[i]);
+            for (; it != rb.end() && it->first < probes[i] + span; ++it) r2 += it->second;
+        }
+    });
+    double tSkipRange = timeIt([&]() {
+        for (int i = 0; i < scans; ++i)
+            skip.range(probes[i], probes[i] + span, [&](const int&, const int& v) { r3 += v; });
+    });
+
+    std::cout << "  " << n << " 个随机键，B+ 树每节点 " << BPlusTree<int, int>::LEAF_CAPACITY << " 个键，逐个插入后 "
+              << tree.height() << " 层，批量构建后 " << bulk.height() << " 层\n";
+    std::cout << "  插入: B+ 树 " << tInsert << " ms，std::map " << tMapInsert << " ms，SkipList " << tSkipInsert
+              << " ms；bulkLoad " << tBulk << " ms\n";
+    std::cout << "  查找: B+ 树 " << tFind << " ms，批量构建的 B+ 树 " << tBulkFind << " ms（节点内二分 "
+              << tPlainFind << " ms），std::map " << tMapFind << " ms，SkipList " << tSkipFind << " ms"
+              << (s1 == s2 && s2 == s3 && s3 == s4 && s4 == s5 ? "" : "（结果不一致！）") << "\n";
+    std::cout << "  区间扫描 " << scans << " 次（每次约 100 个）: B+ 树 " << tRange << " ms，std::map " << tMapRange
+              << " ms，SkipList " << tSkipRange << " ms" << (r1 == r2 && r2 == r3 ? "" : "（结果不一致！）") << "\n";
+}
+
+int main() {
+#ifdef _WIN32
+    SetConsoleOutputCP(CP_UTF8);
+    SetConsoleCP(CP_UTF8);
+#endif
+    BPlusTree<int, int> tree;
+    std::string cmd;
+    printMenu();
+    while (true) {
+        std::cout << "> ";
+        if (!(std::cin >> cmd)) break;
+        try {
+            if (cmd == "insert" || cmd == "range" || cmd == "random") {
+                int a, b;
+                if (!(std::cin >> a >> b)) {
+                    std::cout << "输入有误。用法: " << cmd << " <数值> <数值>\n";
+                    clearInput();
+                    continue;
+                }
+                if (cmd == "insert") {
+                    std::cout << (tree.insert(a, b) ? "已插入。\n" : "键已存在，已更新值。\n");
+                } else if (cmd == "range") {
+                    int n = tree.range(a, b, printPair);
+                    std::cout << "\n共 " << n << " 个\n";
+                } else {
+                    std::mt19937 rng(static_cast<unsigned>(tree.size() + 1));
+                    for (int i = 0; i < a && b > 0; ++i) tree.insert(static_cast<int>(rng() % static_cast<unsigned>(b)), i);
+                    std::cout << "元素个数: " << tree.size() << "，层数: " << tree.height() << "\n";
+                }
+            } else if (cmd == "find" || cmd == "erase" || cmd == "lower" || cmd == "stress" || cmd == "bench") {
+                int k;
+                if (!(std::cin >> k)) {
+                    std::cout << "输入有误。用法: " << cmd << " <数值>\n";
+                    clearInput();
+                    continue;
+                }
+                if (cmd == "find") {
+                    const int* v = tree.find(k);
+                    if (v != nullptr) std::cout << "键 " << k << " 的值为: " << *v << "\n";
+                    else std::cout << "未找到键 " << k << "。\n";
+                } else if (cmd == "erase") {
+                    std::cout << (tree.erase(k) ? "已删除。\n" : "键不存在。\n");
+                } else if (cmd == "lower") {
+                    BPlusTree<int, int>::Iterator it = tree.lowerBound(k);
+                    if (it == tree.end()) std::cout << "没有不小于 " << k << " 的键。\n";
+                    else std::cout << it.key() << ":" << it.value() << "\n";
+                } else if (k <= 0) {
+                    std::cout << "个数须为正整数。\n";
+                } else if (cmd == "stress") {
+                    stress(tree, k);
+                } else {
+                    bench(k);
+                }
+            } else if (cmd == "bulk") {
+                int n;
+                if (!(std::cin >> n) || n < 0) {
+                    std::cout << "输入有误。用法: bulk <个数> [填充率]\n";
+                    clearInput();
+                    continue;
+                }
+                double fill = 1.0;
+                if (std::cin.peek() != '\n' && !(std::cin >> fill)) {
+                    std::cout << "输入有误。用法: bulk <个数> [填充率]\n";
+                    clearInput();
+                    continue;
+                }
+                Vector<int> keys, values;
+                keys.reserve(n);
+                values.reserve(n);
+                for (int i = 0; i < n; ++i) {
+                    keys.push_back(2 * i);
+                    values.push_back(i);
+                }
+                tree.bulkLoad(keys, values, fill);
+                std::cout << "元素个数: " << tree.size() << "，层数: " << tree.height() << "\n";
+            } else if (cmd == "print") {
+                tree.traverse(printPair);
+                std::cout << "\n";
+            } else if (cmd == "nodes") {
+                printNodes(tree);
+            } else if (cmd == "size") {
+                std::cout << "元素个数: " << tree.size() << "，层数: " << tree.height() << "\n";
+            } else if (cmd == "check") {
+                std::cout << (tree.check() ? "结构不变式全部满足。\n" : "结构不变式被破坏！\n");
+            } else if (cmd == "clear") {
+                tree.clear();
+                std::cout << "已清空。\n";
+            } else if (cmd == "help") {
+                printMenu();
+            } else if (cmd == "exit" || cmd == "0") {
+                std::cout << "程序结束，再见！\n";
+                break;
+            } else {
+                std::cout << "未知命令。输入 help 查看菜单。\n";
+            }
+        } catch (const std::exception& e) {
+            std::cout << "错误: " << e.what() << "\n";
+        }
+        clearInput();
+    }
+    return 0;
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+/**
+ * @file dsCheck.hpp
+ * @brief 容器边界/空检查的统一宏
+ *
+ * 默认情况下 DS_CHECK(条件, 异常类型, 消息) 在条件不成立时抛出该异常，行为与各容器原来的
+ * if-throw 相同。编译时定义 DS_CHECKS_AS_ASSERTS 后，检查改为 assert：调试构建中违反即终止，
+ * 再定义 NDEBUG 时检查完全消失，热循环中不再有任何抛出路径。
+ *
+ * 需要在运行时处理失败又不想使用异常时，使用各容器的 try_* 接口（返回 bool）；
+ * 调用者已保证前置条件时，使用 unchecked_* 接口。
+ */
+
+#if defined(DS_CHECKS_AS_ASSERTS)
+
+#include <cassert>
+
+#define DS_CHECK(cond, exception, message) assert((cond) && message)
+
+#else
+
+#define DS_CHECK(cond, exception, message) \
+    do {                                   \
+        if (!(cond)) throw exception(message); \
+    } while (0)
+
+#endif
@@ -0,0 +1,120 @@
+#pragma once
+#include <climits>
+#include <cmath>
+#include <stdexcept>
+
+/**
+ * @file growthPolicy.hpp
+ * @brief 顺序存储容器的扩容策略
+ *
+ * 容器容量不足时，由策略根据当前容量和所需容量给出新容量：
+ * - NONE：不自动扩容，由容器按“已满”处理（Array 默认，保持原有行为）
+ * - GEOMETRIC：按倍数增长，连续追加 n 个元素总共只搬移 O(n) 次（Vector 默认，倍数 2）
+ * - FIXED：每次增加固定步长的整数倍，连续追加时搬移次数为 O(n²/步长)
+ * - EXACT：恰好扩到所需容量，内存最省，连续追加时搬移次数为 O(n²)
+ */
+class GrowthPolicy {
+public:
+    /**
+     * @brief 策略类型
+     */
+    enum Kind {
+        NONE,        ///< 不自动扩容
+        GEOMETRIC,   ///< 按倍数增长
+        FIXED,       ///< 按固定步长增长
+        EXACT        ///< 恰好扩到所需容量
+    };
+
+private:
+    Kind kind;       ///< 策略类型
+    double factor;   ///< 增长倍数（GEOMETRIC）
+    int step;        ///< 增长步长（FIXED）
+
+    GrowthPolicy(Kind kind, double factor, int step) : kind(kind), factor(factor), step(step) {}
+
+public:
+    /**
+     * @brief 不自动扩容
+     */
+    static GrowthPolicy none() { return GrowthPolicy(NONE, 1.0, 0); }
+
+    /**
+     * @brief 按倍数增长
+     * @param factor 增长倍数，须大于1
+     * @throws std::invalid_argument 如果倍数不大于1
+     */
+    static GrowthPolicy geometric(double factor = 2.0);
+
+    /**
+     * @brief 按固定步长增长
+     * @param step 步长，须为正
+     * @throws std::invalid_argument 如果步长不为正
+     */
+    static GrowthPolicy fixed(int step);
+
+    /**
+     * @brief 恰好扩到所需容量
+     */
+    static GrowthPolicy exact() { return GrowthPolicy(EXACT, 1.0, 0); }
+
+    Kind getKind() const { return kind; }
+    double getFactor() const { return factor; }
+    int getStep() const { return step; }
+
+    /**
+     * @brief 是否会自动扩容
+     * @return 策略不为 NONE 时返回true
+     */
+    bool grows() const { return kind != NONE; }
+
+    /**
+     * @brief 计算新容量
+     * @param capacity 当前容量
+     * @param required 所需的最小容量
+     * @return 不小于 required 的新容量（不超过 INT_MAX）；required 不超过当前容量或策略为 NONE 时返回 capacity
+     */
+    int next(int capacity, int required) const;
+};
+
+// ================== 实现部分 ==================
+
+// 按倍数增长
+inline GrowthPolicy GrowthPolicy::geometric(double factor) {
+    if (!(factor > 1.0)) {
+        throw std::invalid_argument("Growth factor must be greater than 1");
+    }
+    return GrowthPolicy(GEOMETRIC, factor, 0);
+}
+
+// 按固定步长增长
+inline GrowthPolicy GrowthPolicy::fixed(int step) {
+    if (step <= 0) {
+        throw std::invalid_argument("Growth step must be positive");
+    }
+    return GrowthPolicy(FIXED, 1.0, step);
+}
+
+// 计算新容量：用 long long 计算，结果截断到 INT_MAX
+inline int GrowthPolicy::next(int capacity, int required) const {
+    if (required <= capacity || kind == NONE) return capacity;
+    long long cap = capacity;
+    switch (kind) {
+    case GEOMETRIC:
+        if (cap < 1) cap = 1;
+        while (cap < required) {
+            long long grown = static_cast<long long>(std::ceil(static_cast<double>(cap) * factor));
+            cap = grown > cap ? grown : cap + 1;
+            if (cap >= INT_MAX) break;
+        }
+        break;
+    case FIXED: {
+        long long steps = (static_cast<long long>(required) - cap + step - 1) / step;
+        cap += steps * step;
+        break;
+    }
+    default:
+        cap = required;
+        break;
+    }
+    return cap > INT_MAX ? INT_MAX : static_cast<int>(cap);
+}
@@ -0,0 +1,608 @@
+#pragma once
+#include "../../common/include/dsCheck.hpp"
+#include "../../trace/include/traceHooks.hpp"
+#include <cstddef>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+/**
+ * @brief 计算不超过n的最大2的幂的指数，用于在编译期确定块大小
+ * @param n 正整数
+ * @return floor(log2(n))
+ */
+constexpr int dequeLog2Floor(std::size_t n) {
+    return n <= 1 ? 0 : 1 + dequeLog2Floor(n >> 1);
+}
+
+/**
+ * @brief 分段双端队列模板类
+ *
+ * 元素存放在若干固定大小的数据块中，由一个块指针数组（map）统一索引。
+ * 两端插入/删除只会在首尾块内操作，必要时分配或释放一个块，均为 O(1)；
+ * 下标访问通过移位和掩码定位块与块内偏移，为 O(1)。
+ * 块本身从不移动，因此两端操作不会使其他元素的引用失效。
+ *
+ * @tparam T 元素类型
+ */
+template<typename T>
+class Deque {
+private:
+    static constexpr int BLOCK_SHIFT =
+        dequeLog2Floor(sizeof(T) >= 256 ? 16 : 4096 / sizeof(T));   ///< 块大小的指数（块约4KB，至少16个元素）
+    static constexpr int BLOCK_SIZE = 1 << BLOCK_SHIFT;          ///< 每块元素个数
+    static constexpr int BLOCK_MASK = BLOCK_SIZE - 1;            ///< 块内偏移掩码
+    static constexpr int MIN_MAP_SIZE = 8;                       ///< 块指针数组最小长度
+
+    T** map;        ///< 块指针数组，未使用的槽为nullptr
+    int mapSize;    ///< 块指针数组长度
+    int first;      ///< 首元素在整个map中的绝对位置（块号 * BLOCK_SIZE + 块内偏移）
+    int length;     ///< 元素个数
+    T* spare;       ///< 缓存的一个空闲块，避免在块边界反复分配/释放
+
+    /**
+     * @brief 获取绝对位置对应的元素地址
+     * @param pos 绝对位置
+     * @return 元素指针
+     */
+    T* slot(int pos) const;
+
+    /**
+     * @brief 分配一个数据块（优先复用空闲块）
+     * @return 块指针
+     */
+    T* allocateBlock();
+
+    /**
+     * @brief 释放一个数据块（缓存为空闲块或归还内存）
+     * @param block 块指针
+     */
+    void freeBlock(T* block);
+
+    /**
+     * @brief 保证map在指定一端至少还有一个空槽，必要时居中或扩大map
+     * @param atFront true表示在头部预留，false表示在尾部预留
+     */
+    void reserveMap(bool atFront);
+
+    /**
+     * @brief 队列变空后把起点重置到map中央
+     */
+    void recenter();
+
+public:
+    // 类型定义
+    using value_type = T;
+    using size_type = int;
+
+    /**
+     * @brief 构造函数，初始化空队列（不分配内存）
+     */
+    Deque();
+
+    /**
+     * @brief 拷贝构造函数，深拷贝
+     * @param other 被拷贝的队列
+     */
+    Deque(const Deque& other);
+
+    /**
+     * @brief 移动构造函数
+     * @param other 被移动的队列，移动后为空
+     */
+    Deque(Deque&& other) noexcept;
+
+    /**
+     * @brief 拷贝赋值
+     * @param other 被赋值的队列
+     * @return 当前对象的引用
+     */
+    Deque& operator=(const Deque& other);
+
+    /**
+     * @brief 移动赋值
+     * @param other 被移动的队列，移动后为空
+     * @return 当前对象的引用
+     */
+    Deque& operator=(Deque&& other) noexcept;
+
+    /**
+     * @brief 析构函数，销毁所有元素并释放所有块
+     */
+    ~Deque();
+
+    /**
+     * @brief 获取元素个数
+     * @return 元素个数
+     */
+    int size() const noexcept;
+
+    /**
+     * @brief 判断是否为空
+     * @return 为空返回true，否则返回false
+     */
+    bool empty() const noexcept;
+
+    /**
+     * @brief 下标访问（无越界检查），O(1)
+     * @param index 下标
+     * @return 元素引用
+     */
+    T& operator[](int index);
+    const T& operator[](int index) const;
+
+    /**
+     * @brief 带越界检查的下标访问，O(1)
+     * @param index 下标
+     * @return 元素引用
+     * @throws std::out_of_range 如果下标越界
+     */
+    T& at(int index);
+    const T& at(int index) const;
+
+    /**
+     * @brief 获取首元素
+     * @return 首元素引用
+     * @throws std::out_of_range 如果队列为空
+     */
+    T& front();
+    const T& front() const;
+
+    /**
+     * @brief 获取尾元素
+     * @return 尾元素引用
+     * @throws std::out_of_range 如果队列为空
+     */
+    T& back();
+    const T& back() const;
+
+    /**
+     * @brief 头部插入元素，O(1)
+     * @param value 元素值
+     */
+    void push_front(const T& value);
+
+    /**
+     * @brief 尾部插入元素，O(1)
+     * @param value 元素值
+     */
+    void push_back(const T& value);
+
+    /**
+     * @brief 删除首元素，O(1)
+     * @throws std::out_of_range 如果队列为空
+     */
+    void pop_front();
+
+    /**
+     * @brief 删除尾元素，O(1)
+     * @throws std::out_of_range 如果队列为空
+     */
+    void pop_back();
+
+    /**
+     * @brief 不抛异常的下标读取
+     * @param index 下标
+     * @param out 成功时写入元素值
+     * @return 下标有效返回true，越界返回false（out不变）
+     */
+    bool try_at(int index, T& out) const;
+
+    /**
+     * @brief 不抛异常的读取首元素
+     * @param out 成功时写入首元素
+     * @return 非空返回true，为空返回false（out不变）
+     */
+    bool try_front(T& out) const;
+
+    /**
+     * @brief 不抛异常的读取尾元素
+     * @param out 成功时写入尾元素
+     * @return 非空返回true，为空返回false（out不变）
+     */
+    bool try_back(T& out) const;
+
+    /**
+     * @brief 不抛异常的删除首元素，元素移动到out
+     * @param out 成功时写入原首元素
+     * @return 非空返回true，为空返回false（out不变）
+     */
+    bool try_pop_front(T& out);
+
+    /**
+     * @brief 不抛异常的删除尾元素，元素移动到out
+     * @param out 成功时写入原尾元素
+     * @return 非空返回true，为空返回false（out不变）
+     */
+    bool try_pop_back(T& out);
+
+    /**
+     * @brief 不检查的首/尾元素访问，调用者保证非空（下标访问见 operator[]）
+     * @return 元素引用
+     */
+    T& unchecked_front() { return *slot(first); }
+    const T& unchecked_front() const { return *slot(first); }
+    T& unchecked_back() { return *slot(first + length - 1); }
+    const T& unchecked_back() const { return *slot(first + length - 1); }
+
+    /**
+     * @brief 不检查的删除首元素，调用者保证非空
+     */
+    void unchecked_pop_front();
+
+    /**
+     * @brief 不检查的删除尾元素，调用者保证非空
+     */
+    void unchecked_pop_back();
+
+    /**
+     * @brief 清空队列，释放所有块（保留map）
+     */
+    void clear() noexcept;
+
+    /**
+     * @brief 与另一队列交换内容，O(1)
+     * @param other 另一队列
+     */
+    void swap(Deque& other) noexcept;
+
+    /**
+     * @brief 从头到尾遍历，对每个元素调用visit函数
+     * @param visit 回调函数，参数为const T&，无返回值
+     */
+    void traverse(void (*visit)(const T&)) const;
+};
+
+// ================== 实现部分 ==================
+
+// 获取绝对位置对应的元素地址
+template<typename T>
+T* Deque<T>::slot(int pos) const {
+    return map[pos >> BLOCK_SHIFT] + (pos & BLOCK_MASK);
+}
+
+// 分配数据块，优先复用空闲块
+template<typename T>
+T* Deque<T>::allocateBlock() {
+    if (spare != nullptr) {
+        T* block = spare;
+        spare = nullptr;
+        return block;
+    }
+    return static_cast<T*>(::operator new(sizeof(T) * BLOCK_SIZE));
+}
+
+// 释放数据块，空闲块缓存未满时留作复用
+template<typename T>
+void Deque<T>::freeBlock(T* block) {
+    if (spare == nullptr)
+        spare = block;
+    else
+        ::operator delete(block);
+}
+
+// 保证map指定一端有空槽：已用块不足一半时原地居中，否则扩大一倍
+template<typename T>
+void Deque<T>::reserveMap(bool atFront) {
+    if (map == nullptr) {
+        map = new T*[MIN_MAP_SIZE]();
+        mapSize = MIN_MAP_SIZE;
+        first = (MIN_MAP_SIZE / 2) << BLOCK_SHIFT;
+        return;
+    }
+    int firstBlock = first >> BLOCK_SHIFT;
+    int used = length == 0 ? 0 : ((first + length - 1) >> BLOCK_SHIFT) - firstBlock + 1;
+    if (atFront ? firstBlock > 0 : firstBlock + used < mapSize)
+        return;
+    int need = used + 1;
+    int newSize = need * 2 <= mapSize ? mapSize : (mapSize * 2 > need * 2 ? mapSize * 2 : need * 2);
+    int newStart = (newSize - need) / 2 + (atFront ? 1 : 0);
+    T** newMap = new T*[newSize]();
+    for (int i = 0; i < used; ++i)
+        newMap[newStart + i] = map[firstBlock + i];
+    delete[] map;
+    map = newMap;
+    mapSize = newSize;
+    first = (newStart << BLOCK_SHIFT) + (first & BLOCK_MASK);
+}
+
+// 队列变空后把起点重置到map中央，使后续两端插入都有余量
+template<typename T>
+void Deque<T>::recenter() {
+    first = (mapSize / 2) << BLOCK_SHIFT;
+}
+
+// 构造函数
+template<typename T>
+Deque<T>::Deque()
+    : map(nullptr), mapSize(0), first(0), length(0), spare(nullptr) {}
+
+// 拷贝构造函数，逐个尾插
+template<typename T>
+Deque<T>::Deque(const Deque& other)
+    : Deque() {
+    for (int i = 0; i < other.length; ++i)
+        push_back(other[i]);
+}
+
+// 移动构造函数
+template<typename T>
+Deque<T>::Deque(Deque&& other) noexcept
+    : map(other.map), mapSize(other.mapSize), first(other.first),
+      length(other.length), spare(other.spare) {
+    other.map = nullptr;
+    other.mapSize = 0;
+    other.first = 0;
+    other.length = 0;
+    other.spare = nullptr;
+}
+
+// 拷贝赋值，先拷贝再交换，保证强异常安全
+template<typename T>
+Deque<T>& Deque<T>::operator=(const Deque& other) {
+    if (this != &other) {
+        Deque tmp(other);
+        swap(tmp);
+    }
+    return *this;
+}
+
+// 移动赋值
+template<typename T>
+Deque<T>& Deque<T>::operator=(Deque&& other) noexcept {
+    if (this != &other) {
+        Deque tmp(std::move(other));
+        swap(tmp);
+    }
+    return *this;
+}
+
+// 析构函数
+template<typename T>
+Deque<T>::~Deque() {
+    clear();
+    if (spare != nullptr)
+        ::operator delete(spare);
+    delete[] map;
+}
+
+// 获取元素个数
+template<typename T>
+int Deque<T>::size() const noexcept {
+    return length;
+}
+
+// 判断是否为空
+template<typename T>
+bool Deque<T>::empty() const noexcept {
+    return length == 0;
+}
+
+// 下标访问（无越界检查）
+template<typename T>
+T& Deque<T>::operator[](int index) {
+    return *slot(first + index);
+}
+
+template<typename T>
+const T& Deque<T>::operator[](int index) const {
+    return *slot(first + index);
+}
+
+// 带越界检查的下标访问
+template<typename T>
+T& Deque<T>::at(int index) {
+    DS_CHECK(index >= 0 && index < length, std::out_of_range, "Index out of range");
+    return *slot(first + index);
+}
+
+template<typename T>
+const T& Deque<T>::at(int index) const {
+    DS_CHECK(index >= 0 && index < length, std::out_of_range, "Index out of range");
+    return *slot(first + index);
+}
+
+// 获取首元素
+template<typename T>
+T& Deque<T>::front() {
+    DS_CHECK(!empty(), std::out_of_range, "Deque is empty");
+    return *slot(first);
+}
+
+template<typename T>
+const T& Deque<T>::front() const {
+    DS_CHECK(!empty(), std::out_of_range, "Deque is empty");
+    return *slot(first);
+}
+
+// 获取尾元素
+template<typename T>
+T& Deque<T>::back() {
+    DS_CHECK(!empty(), std::out_of_range, "Deque is empty");
+    return *slot(first + length - 1);
+}
+
+template<typename T>
+const T& Deque<T>::back() const {
+    DS_CHECK(!empty(), std::out_of_range, "Deque is empty");
+    return *slot(first + length - 1);
+}
+
+// 头部插入：空队列或首元素位于块首时需要在前面新开一个块
+template<typename T>
+void Deque<T>::push_front(const T& value) {
+    DS_TRACE_SCOPE("Deque::push_front");
+    if (length == 0) {
+        push_back(value);
+        return;
+    }
+    bool newBlock = (first & BLOCK_MASK) == 0;
+    if (newBlock) {
+        reserveMap(true);
+        map[(first >> BLOCK_SHIFT) - 1] = allocateBlock();
+    }
+    int pos = first - 1;
+    try {
+        new (slot(pos)) T(value);
+    } catch (...) {
+        if (newBlock) {
+            freeBlock(map[pos >> BLOCK_SHIFT]);
+            map[pos >> BLOCK_SHIFT] = nullptr;
+        }
+        throw;
+    }
+    first = pos;
+    ++length;
+}
+
+// 尾部插入：空队列或尾后位置位于块首时需要在后面新开一个块
+template<typename T>
+void Deque<T>::push_back(const T& value) {
+    DS_TRACE_SCOPE("Deque::push_back");
+    if (map == nullptr)
+        reserveMap(false);
+    int pos = first + length;
+    bool newBlock = length == 0 || (pos & BLOCK_MASK) == 0;
+    if (newBlock) {
+        if ((pos >> BLOCK_SHIFT) >= mapSize) {
+            reserveMap(false);
+            pos = first + length;
+        }
+        map[pos >> BLOCK_SHIFT] = allocateBlock();
+    }
+    try {
+        new (slot(pos)) T(value);
+    } catch (...) {
+        if (newBlock) {
+            freeBlock(map[pos >> BLOCK_SHIFT]);
+            map[pos >> BLOCK_SHIFT] = nullptr;
+        }
+        throw;
+    }
+    ++length;
+}
+
+// 删除首元素：首块被取空时释放该块
+template<typename T>
+void Deque<T>::pop_front() {
+    DS_TRACE_SCOPE("Deque::pop_front");
+    DS_CHECK(!empty(), std::out_of_range, "Deque is empty");
+    unchecked_pop_front();
+}
+
+// 不检查的删除首元素：首块被取空时释放该块
+template<typename T>
+void Deque<T>::unchecked_pop_front() {
+    slot(first)->~T();
+    int block = first >> BLOCK_SHIFT;
+    ++first;
+    --length;
+    if (length == 0 || (first & BLOCK_MASK) == 0) {
+        freeBlock(map[block]);
+        map[block] = nullptr;
+    }
+    if (length == 0)
+        recenter();
+}
+
+// 删除尾元素：尾块被取空时释放该块
+template<typename T>
+void Deque<T>::pop_back() {
+    DS_TRACE_SCOPE("Deque::pop_back");
+    DS_CHECK(!empty(), std::out_of_range, "Deque is empty");
+    unchecked_pop_back();
+}
+
+// 不检查的删除尾元素：尾块被取空时释放该块
+template<typename T>
+void Deque<T>::unchecked_pop_back() {
+    int pos = first + length - 1;
+    slot(pos)->~T();
+    --length;
+    if (length == 0 || (pos & BLOCK_MASK) == 0) {
+        freeBlock(map[pos >> BLOCK_SHIFT]);
+        map[pos >> BLOCK_SHIFT] = nullptr;
+    }
+    if (length == 0)
+        recenter();
+}
+
+// 不抛异常的下标读取
+template<typename T>
+bool Deque<T>::try_at(int index, T& out) const {
+    if (index < 0 || index >= length)
+        return false;
+    out = *slot(first + index);
+    return true;
+}
+
+// 不抛异常的读取首元素
+template<typename T>
+bool Deque<T>::try_front(T& out) const {
+    if (length == 0)
+        return false;
+    out = unchecked_front();
+    return true;
+}
+
+// 不抛异常的读取尾元素
+template<typename T>
+bool Deque<T>::try_back(T& out) const {
+    if (length == 0)
+        return false;
+    out = unchecked_back();
+    return true;
+}
+
+// 不抛异常的删除首元素
+template<typename T>
+bool Deque<T>::try_pop_front(T& out) {
+    if (length == 0)
+        return false;
+    out = std::move(unchecked_front());
+    unchecked_pop_front();
+    return true;
+}
+
+// 不抛异常的删除尾元素
+template<typename T>
+bool Deque<T>::try_pop_back(T& out) {
+    if (length == 0)
+        return false;
+    out = std::move(unchecked_back());
+    unchecked_pop_back();
+    return true;
+}
+
+// 清空队列
+template<typename T>
+void Deque<T>::clear() noexcept {
+    while (length > 0) {
+        int pos = first + length - 1;
+        slot(pos)->~T();
+        --length;
+        if (length == 0 || (pos & BLOCK_MASK) == 0) {
+            freeBlock(map[pos >> BLOCK_SHIFT]);
+            map[pos >> BLOCK_SHIFT] = nullptr;
+        }
+    }
+    if (map != nullptr)
+        recenter();
+}
+
+// 与另一队列交换内容
+template<typename T>
+void Deque<T>::swap(Deque& other) noexcept {
+    std::swap(map, other.map);
+    std::swap(mapSize, other.mapSize);
+    std::swap(first, other.first);
+    std::swap(length, other.length);
+    std::swap(spare, other.spare);
+}
+
+// 从头到尾遍历
+template<typename T>
+void Deque<T>::traverse(void (*visit)(const T&)) const {
+    for (int i = 0; i < length; ++i)
+        visit(*slot(first + i));
+}
@@ -0,0 +1,194 @@
+#include "../include/deque.hpp"
+#include <iostream>
+#include <string>
+#include <limits>
+#include <chrono>
+#include <deque>
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+void printMenu() {
+    std::cout << "\n====== 双端队列交互测试菜单 ======\n";
+    std::cout << "命令列表：\n";
+    std::cout << "  pushfront <值>   : 头部插入\n";
+    std::cout << "  pushback <值>    : 尾部插入\n";
+    std::cout << "  popfront         : 删除首元素\n";
+    std::cout << "  popback          : 删除尾元素\n";
+    std::cout << "  front            : 查看首元素\n";
+    std::cout << "  back             : 查看尾元素\n";
+    std::cout << "  get <下标>       : 获取指定下标的值\n";
+    std::cout << "  trypopfront / trypopback : 不抛异常的删除并返回首/尾元素\n";
+    std::cout << "  tryget <下标>    : 不抛异常的下标读取（try_at）\n";
+    std::cout << "  size             : 当前元素个数\n";
+    std::cout << "  empty            : 判断是否为空\n";
+    std::cout << "  clear            : 清空队列\n";
+    std::cout << "  print            : 打印队列内容\n";
+    std::cout << "  bench <次数>     : 与 std::deque 对比性能\n";
+    std::cout << "  help             : 显示菜单\n";
+    std::cout << "  exit / 0         : 退出程序\n";
+    std::cout << "-----------------------------------\n";
+    std::cout << "请输入命令: ";
+}
+
+template<typename T>
+void printDeque(const Deque<T>& dq) {
+    std::cout << "[";
+    for (int i = 0; i < dq.size(); ++i) {
+        std::cout << dq[i];
+        if (i != dq.size() - 1) std::cout << ", ";
+    }
+    std::cout << "]\n";
+}
+
+// 计时工具：执行f并返回耗时（毫秒）
+template<typename F>
+double timeIt(F f) {
+    auto start = std::chrono::steady_clock::now();
+    f();
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+// 对同一组操作分别测量 Deque 与 std::deque
+template<typename DQ>
+void benchOne(const char* name, int n) {
+    long long sum = 0;
+    DQ dq;
+    double tBack = timeIt([&]() {
+        for (int i = 0; i < n; ++i) dq.push_back(i);
+    });
+    double tIndex = timeIt([&]() {
+        for (int r = 0; r < 4; ++r)
+            for (int i = 0; i < n; ++i) sum += dq[i];
+    });
+    double tFifo = timeIt([&]() {
+        for (int i = 0; i < n; ++i) {
+            dq.push_back(i);
+            sum += dq.front();
+            dq.pop_front();
+        }
+    });
+    double tPopBack = timeIt([&]() {
+        while (!dq.empty()) dq.pop_back();
+    });
+    double tFront = timeIt([&]() {
+        for (int i = 0; i < n; ++i) dq.push_front(i);
+        while (!dq.empty()) dq.pop_front();
+    });
+    std::cout << "  " << name << ": push_back " << tBack << " ms, 下标访问x4 " << tIndex
+              << " ms, 滑动FIFO " << tFifo << " ms, pop_back " << tPopBack
+              << " ms, push_front+pop_front " << tFront << " ms（校验和 " << sum << "）\n";
+}
+
+void clearInput() {
+    std::cin.clear();
+    std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+}
+
+int main() {
+#ifdef _WIN32
+    SetConsoleOutputCP(CP_UTF8);
+    SetConsoleCP(CP_UTF8);
+#endif
+    Deque<int> dq;
+    std::string cmd;
+    printMenu();
+    while (true) {
+        std::cout << "> ";
+        if (!(std::cin >> cmd)) break;
+        if (cmd == "pushfront" || cmd == "pushback") {
+            int val;
+            if (!(std::cin >> val)) {
+                std::cout << "输入有误。用法: " << cmd << " <值>\n";
+                clearInput();
+                continue;
+            }
+            if (cmd == "pushfront") {
+                dq.push_front(val);
+                std::cout << "已在头部插入 " << val << "。\n";
+            } else {
+                dq.push_back(val);
+                std::cout << "已在尾部插入 " << val << "。\n";
+            }
+        } else if (cmd == "popfront" || cmd == "popback") {
+            try {
+                if (cmd == "popfront")
+                    dq.pop_front();
+                else
+                    dq.pop_back();
+                std::cout << "已删除。\n";
+            } catch (const std::exception& e) {
+                std::cout << "错误: " << e.what() << "\n";
+            }
+        } else if (cmd == "front" || cmd == "back") {
+            try {
+                int val = (cmd == "front") ? dq.front() : dq.back();
+                std::cout << (cmd == "front" ? "首元素为: " : "尾元素为: ") << val << "\n";
+            } catch (const std::exception& e) {
+                std::cout << "错误: " << e.what() << "\n";
+            }
+        } else if (cmd == "get") {
+            int idx;
+            if (!(std::cin >> idx)) {
+                std::cout << "输入有误。用法: get <下标>\n";
+                clearInput();
+                continue;
+            }
+            try {
+                int val = dq.at(idx);
+                std::cout << "下标 " << idx << " 的值为: " << val << "\n";
+            } catch (const std::exception& e) {
+                std::cout << "错误: " << e.what() << "\n";
+            }
+        } else if (cmd == "trypopfront" || cmd == "trypopback") {
+            int val = 0;
+            bool ok = cmd == "trypopfront" ? dq.try_pop_front(val) : dq.try_pop_back(val);
+            if (ok)
+                std::cout << "已删除: " << val << "\n";
+            else
+                std::cout << "队列为空，" << cmd << " 返回 false。\n";
+        } else if (cmd == "tryget") {
+            int idx;
+            if (!(std::cin >> idx)) {
+                std::cout << "输入有误。用法: tryget <下标>\n";
+                clearInput();
+                continue;
+            }
+            int val = 0;
+            if (dq.try_at(idx, val))
+                std::cout << "下标 " << idx << " 的值为: " << val << "\n";
+            else
+                std::cout << "下标 " << idx << " 越界，try_at 返回 false。\n";
+        } else if (cmd == "size") {
+            std::cout << "当前元素个数: " << dq.size() << "\n";
+        } else if (cmd == "empty") {
+            std::cout << (dq.empty() ? "队列为空。" : "队列非空。") << "\n";
+        } else if (cmd == "clear") {
+            dq.clear();
+            std::cout << "队列已清空。\n";
+        } else if (cmd == "print") {
+            std::cout << "队列内容: ";
+            printDeque(dq);
+        } else if (cmd == "bench") {
+            int n;
+            if (!(std::cin >> n) || n <= 0) {
+                std::cout << "输入有误。用法: bench <次数>\n";
+                clearInput();
+                continue;
+            }
+            std::cout << "元素个数 " << n << "：\n";
+            benchOne<Deque<int>>("Deque     ", n);
+            benchOne<std::deque<int>>("std::deque", n);
+        } else if (cmd == "help") {
+            printMenu();
+        } else if (cmd == "exit" || cmd == "0") {
+            std::cout << "程序结束，再见！\n";
+            break;
+        } else {
+            std::cout << "未知命令。输入 help 查看菜单。\n";
+        }
+        clearInput();
+    }
+    return 0;
+}
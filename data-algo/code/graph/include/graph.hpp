@@ -0,0 +1,487 @@
+#pragma once
+#include "../../queue/include/queue.hpp"
+#include "../../stack/include/stack.hpp"
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief 边（有向时为 from -> to）
+ */
+struct Edge {
+    int from;   ///< 起点
+    int to;     ///< 终点
+};
+
+/**
+ * @brief 压缩稀疏行（CSR）存储的图
+ *
+ * 顶点编号为 0 ~ vertexCount()-1。顶点 u 的邻接点连续存放在
+ * targets[offsets[u], offsets[u+1]) 中，整张图只有两块连续数组，
+ * 遍历时顺序访存、缓存友好，适合千万级以上边数的只读图。
+ * 由边表构造：先统计每个顶点的出度并做前缀和，再把每条边写入对应位置。
+ * 有向图额外保存一份入边 CSR，供并行 BFS 的自底向上阶段使用。
+ *
+ * 图构造后不可修改；需要增删边时重新由边表构造。
+ */
+class CsrGraph {
+private:
+    int vertices;               ///< 顶点数
+    long long arcs;             ///< 存储的弧数（无向图每条边计两次）
+    bool directed;              ///< 是否为有向图
+    long long* offsets;         ///< 出边偏移数组，长度 vertices+1
+    int* targets;               ///< 出边终点数组，长度 arcs
+    long long* inOffsets;       ///< 入边偏移数组（仅有向图），长度 vertices+1
+    int* inTargets;             ///< 入边起点数组（仅有向图），长度 arcs
+
+    static const int TD_TO_BU_ALPHA = 14;     ///< 前沿出边数超过未访问边数的 1/ALPHA 时切换为自底向上
+    static const int BU_TO_TD_BETA = 24;      ///< 前沿顶点数少于总顶点数的 1/BETA 时切换回自顶向下
+    static const int PARALLEL_GRAIN = 4096;   ///< 每层工作量低于该值时单线程执行
+
+    /**
+     * @brief 由边表构造一份 CSR
+     * @param n 顶点数
+     * @param edges 边表
+     * @param m 边数
+     * @param reverse true时按终点分组（入边），false时按起点分组（出边）
+     * @param symmetric true时每条边同时写入两个方向（无向图）
+     * @param off 输出偏移数组
+     * @param tgt 输出邻接点数组
+     */
+    static void buildCsr(int n, const Edge* edges, int m, bool reverse, bool symmetric,
+                         long long*& off, int*& tgt);
+
+    /**
+     * @brief 检查顶点编号是否合法
+     * @param v 顶点编号
+     * @throws std::out_of_range 如果越界
+     */
+    void checkVertex(int v) const;
+
+    /**
+     * @brief 把 [0, work) 均分给若干线程执行 body(begin, end, threadId)
+     * @param threads 线程数
+     * @param work 工作量
+     * @param body 工作函数
+     */
+    template<typename F>
+    static void forkJoin(int threads, long long work, F body);
+
+public:
+    /**
+     * @brief 由边表构造图
+     * @param vertexCount 顶点数
+     * @param edges 边表
+     * @param edgeCount 边数
+     * @param directed true为有向图，false为无向图
+     * @throws std::invalid_argument 如果顶点数或边数为负
+     * @throws std::out_of_range 如果边的端点越界
+     */
+    CsrGraph(int vertexCount, const Edge* edges, int edgeCount, bool directed);
+
+    /**
+     * @brief 由边表构造图
+     * @param vertexCount 顶点数
+     * @param edges 边表
+     * @param directed true为有向图，false为无向图
+     */
+    CsrGraph(int vertexCount, const std::vector<Edge>& edges, bool directed);
+
+    CsrGraph(const CsrGraph&) = delete;
+    CsrGraph& operator=(const CsrGraph&) = delete;
+
+    /**
+     * @brief 析构函数，释放 CSR 数组
+     */
+    ~CsrGraph();
+
+    /**
+     * @brief 获取顶点数
+     * @return 顶点数
+     */
+    int vertexCount() const;
+
+    /**
+     * @brief 获取存储的弧数（无向图每条边计两次）
+     * @return 弧数
+     */
+    long long arcCount() const;
+
+    /**
+     * @brief 是否为有向图
+     * @return 有向返回true
+     */
+    bool isDirected() const;
+
+    /**
+     * @brief 获取顶点的出度
+     * @param u 顶点编号
+     * @return 出度
+     * @throws std::out_of_range 如果顶点越界
+     */
+    int degree(int u) const;
+
+    /**
+     * @brief 获取顶点邻接点数组的起始指针
+     * @param u 顶点编号
+     * @return 指向第一个邻接点的指针
+     * @throws std::out_of_range 如果顶点越界
+     */
+    const int* neighborsBegin(int u) const;
+
+    /**
+     * @brief 获取顶点邻接点数组的尾后指针
+     * @param u 顶点编号
+     * @return 指向最后一个邻接点之后的指针
+     * @throws std::out_of_range 如果顶点越界
+     */
+    const int* neighborsEnd(int u) const;
+
+    /**
+     * @brief 判断是否存在边 u -> v，O(deg(u))
+     * @param u 起点
+     * @param v 终点
+     * @return 存在返回true
+     */
+    bool hasEdge(int u, int v) const;
+
+    /**
+     * @brief 广度优先搜索（基于 Queue），按访问顺序调用visit
+     * @param source 起点
+     * @param dist 输出各顶点到起点的层数，不可达为-1；长度至少为 vertexCount()，可为nullptr
+     * @param visit 访问回调，可为nullptr
+     * @throws std::out_of_range 如果起点越界
+     */
+    void bfs(int source, int* dist, void (*visit)(int) = nullptr) const;
+
+    /**
+     * @brief 深度优先搜索（基于 Stack），按先序调用visit
+     * @param source 起点
+     * @param visit 访问回调
+     * @throws std::out_of_range 如果起点越界
+     */
+    void dfs(int source, void (*visit)(int)) const;
+
+    /**
+     * @brief 方向优化的并行广度优先搜索
+     *
+     * 以层为单位推进前沿：前沿较小时自顶向下扩展（线程划分前沿，CAS 认领新顶点）；
+     * 前沿的出边数超过未访问顶点边数的 1/14 时切换为自底向上（线程划分顶点，
+     * 每个未访问顶点只需找到一个位于前沿中的入邻居）；前沿重新变小时切换回自顶向下。
+     *
+     * @param source 起点
+     * @param dist 输出各顶点到起点的层数，不可达为-1；长度至少为 vertexCount()
+     * @param threads 线程数，0表示使用硬件并发数
+     * @throws std::out_of_range 如果起点越界
+     */
+    void parallelBfs(int source, int* dist, int threads = 0) const;
+
+    /**
+     * @brief 判断 target 是否可由 source 到达
+     * @param source 起点
+     * @param target 终点
+     * @param threads 线程数，0表示使用硬件并发数
+     * @return 可达返回true
+     * @throws std::out_of_range 如果顶点越界
+     */
+    bool reachable(int source, int target, int threads = 0) const;
+};
+
+// ================== 实现部分 ==================
+
+// 由边表构造一份 CSR：统计度数 -> 前缀和 -> 按游标写入
+inline void CsrGraph::buildCsr(int n, const Edge* edges, int m, bool reverse, bool symmetric,
+                               long long*& off, int*& tgt) {
+    off = new long long[n + 1]();
+    for (int i = 0; i < m; ++i) {
+        ++off[(reverse ? edges[i].to : edges[i].from) + 1];
+        if (symmetric)
+            ++off[edges[i].to + 1];
+    }
+    for (int u = 0; u < n; ++u)
+        off[u + 1] += off[u];
+    std::unique_ptr<long long[]> cursor(new long long[n]);
+    for (int u = 0; u < n; ++u)
+        cursor[u] = off[u];
+    tgt = new int[off[n] > 0 ? off[n] : 1];
+    for (int i = 0; i < m; ++i) {
+        int a = reverse ? edges[i].to : edges[i].from;
+        int b = reverse ? edges[i].from : edges[i].to;
+        tgt[cursor[a]++] = b;
+        if (symmetric)
+            tgt[cursor[b]++] = a;
+    }
+}
+
+// 检查顶点编号是否合法
+inline void CsrGraph::checkVertex(int v) const {
+    if (v < 0 || v >= vertices)
+        throw std::out_of_range("Vertex out of range");
+}
+
+// 把 [0, work) 均分给若干线程；工作量较小时直接在当前线程执行
+template<typename F>
+void CsrGraph::forkJoin(int threads, long long work, F body) {
+    if (threads <= 1 || work < PARALLEL_GRAIN) {
+        body(0LL, work, 0);
+        return;
+    }
+    std::vector<std::thread> pool;
+    long long chunk = (work + threads - 1) / threads;
+    for (int t = 1; t < threads; ++t) {
+        long long begin = chunk * t;
+        long long end = begin + chunk < work ? begin + chunk : work;
+        if (begin >= end)
+            break;
+        pool.push_back(std::thread(body, begin, end, t));
+    }
+    body(0LL, chunk < work ? chunk : work, 0);
+    for (size_t i = 0; i < pool.size(); ++i)
+        pool[i].join();
+}
+
+// 由边表构造图
+inline CsrGraph::CsrGraph(int vertexCount, const Edge* edges, int edgeCount, bool directed)
+    : vertices(vertexCount), arcs(0), directed(directed),
+      offsets(nullptr), targets(nullptr), inOffsets(nullptr), inTargets(nullptr) {
+    if (vertexCount < 0 || edgeCount < 0)
+        throw std::invalid_argument("Negative vertex or edge count");
+    for (int i = 0; i < edgeCount; ++i) {
+        checkVertex(edges[i].from);
+        checkVertex(edges[i].to);
+    }
+    try {
+        buildCsr(vertices, edges, edgeCount, false, !directed, offsets, targets);
+        if (directed)
+            buildCsr(vertices, edges, edgeCount, true, false, inOffsets, inTargets);
+    } catch (...) {
+        delete[] offsets;
+        delete[] targets;
+        delete[] inOffsets;
+        delete[] inTargets;
+        throw;
+    }
+    arcs = offsets[vertices];
+}
+
+// 由边表构造图（vector版本）
+inline CsrGraph::CsrGraph(int vertexCount, const std::vector<Edge>& edges, bool directed)
+    : CsrGraph(vertexCount, edges.empty() ? nullptr : &edges[0],
+               static_cast<int>(edges.size()), directed) {}
+
+// 析构函数
+inline CsrGraph::~CsrGraph() {
+    delete[] offsets;
+    delete[] targets;
+    delete[] inOffsets;
+    delete[] inTargets;
+}
+
+// 获取顶点数
+inline int CsrGraph::vertexCount() const {
+    return vertices;
+}
+
+// 获取弧数
+inline long long CsrGraph::arcCount() const {
+    return arcs;
+}
+
+// 是否为有向图
+inline bool CsrGraph::isDirected() const {
+    return directed;
+}
+
+// 获取出度
+inline int CsrGraph::degree(int u) const {
+    checkVertex(u);
+    return static_cast<int>(offsets[u + 1] - offsets[u]);
+}
+
+// 邻接点起始指针
+inline const int* CsrGraph::neighborsBegin(int u) const {
+    checkVertex(u);
+    return targets + offsets[u];
+}
+
+// 邻接点尾后指针
+inline const int* CsrGraph::neighborsEnd(int u) const {
+    checkVertex(u);
+    return targets + offsets[u + 1];
+}
+
+// 判断是否存在边 u -> v
+inline bool CsrGraph::hasEdge(int u, int v) const {
+    checkVertex(v);
+    for (const int* p = neighborsBegin(u); p != neighborsEnd(u); ++p) {
+        if (*p == v)
+            return true;
+    }
+    return false;
+}
+
+// 广度优先搜索：队列保存待扩展顶点
+inline void CsrGraph::bfs(int source, int* dist, void (*visit)(int)) const {
+    checkVertex(source);
+    std::vector<int> level(vertices, -1);
+    Queue<int> q;
+    level[source] = 0;
+    q.push(source);
+    while (!q.empty()) {
+        int u = q.peek();
+        q.pop();
+        if (visit != nullptr)
+            visit(u);
+        for (long long i = offsets[u]; i < offsets[u + 1]; ++i) {
+            int v = targets[i];
+            if (level[v] == -1) {
+                level[v] = level[u] + 1;
+                q.push(v);
+            }
+        }
+    }
+    if (dist != nullptr) {
+        for (int v = 0; v < vertices; ++v)
+            dist[v] = level[v];
+    }
+}
+
+// 深度优先搜索：栈保存待访问顶点，邻接点逆序入栈以保持与递归一致的先序
+inline void CsrGraph::dfs(int source, void (*visit)(int)) const {
+    checkVertex(source);
+    std::vector<char> visited(vertices, 0);
+    Stack<int> stk;
+    stk.push(source);
+    while (!stk.empty()) {
+        int u = stk.top();
+        stk.pop();
+        if (visited[u])
+            continue;
+        visited[u] = 1;
+        visit(u);
+        for (long long i = offsets[u + 1] - 1; i >= offsets[u]; --i) {
+            if (!visited[targets[i]])
+                stk.push(targets[i]);
+        }
+    }
+}
+
+// 方向优化的并行广度优先搜索
+inline void CsrGraph::parallelBfs(int source, int* dist, int threads) const {
+    checkVertex(source);
+    if (threads <= 0) {
+        threads = static_cast<int>(std::thread::hardware_concurrency());
+        if (threads <= 0)
+            threads = 1;
+    }
+    const long long* inOff = directed ? inOffsets : offsets;
+    const int* inTgt = directed ? inTargets : targets;
+    const int n = vertices;
+
+    std::unique_ptr<std::atomic<int>[]> level(new std::atomic<int>[n]);
+    for (int v = 0; v < n; ++v)
+        level[v].store(-1, std::memory_order_relaxed);
+    level[source].store(0, std::memory_order_relaxed);
+
+    std::vector<int> frontier(1, source);          // 自顶向下时的前沿（顶点表）
+    std::vector<char> inFrontier, inNext;          // 自底向上时的前沿（位图）
+    std::vector<std::vector<int> > localNext(threads);
+    std::vector<long long> localEdges(threads), localCount(threads);
+    long long unexploredEdges = arcs - (offsets[source + 1] - offsets[source]);
+    long long frontierSize = 1;
+    bool bottomUp = false;
+
+    for (int depth = 0; frontierSize > 0; ++depth) {
+        // 选择本层方向
+        if (!bottomUp) {
+            long long frontierEdges = 0;
+            for (size_t i = 0; i < frontier.size(); ++i)
+                frontierEdges += offsets[frontier[i] + 1] - offsets[frontier[i]];
+            if (frontierEdges > unexploredEdges / TD_TO_BU_ALPHA) {
+                bottomUp = true;
+                inFrontier.assign(n, 0);
+                for (size_t i = 0; i < frontier.size(); ++i)
+                    inFrontier[frontier[i]] = 1;
+                inNext.assign(n, 0);
+            }
+        } else if (frontierSize < n / BU_TO_TD_BETA) {
+            bottomUp = false;
+            frontier.clear();
+            for (int v = 0; v < n; ++v) {
+                if (inFrontier[v])
+                    frontier.push_back(v);
+            }
+        }
+
+        const int next = depth + 1;
+        for (int t = 0; t < threads; ++t) {
+            localEdges[t] = 0;
+            localCount[t] = 0;
+            localNext[t].clear();
+        }
+
+        if (!bottomUp) {
+            // 自顶向下：前沿中每个顶点检查其出边，CAS 认领未访问的邻居
+            forkJoin(threads, static_cast<long long>(frontier.size()),
+                     [&](long long begin, long long end, int t) {
+                for (long long i = begin; i < end; ++i) {
+                    int u = frontier[i];
+                    for (long long k = offsets[u]; k < offsets[u + 1]; ++k) {
+                        int v = targets[k];
+                        int expected = -1;
+                        if (level[v].load(std::memory_order_relaxed) == -1
+                            && level[v].compare_exchange_strong(expected, next,
+                                                                std::memory_order_relaxed)) {
+                            localNext[t].push_back(v);
+                            localEdges[t] += offsets[v + 1] - offsets[v];
+                        }
+                    }
+                }
+            });
+            frontier.clear();
+            for (int t = 0; t < threads; ++t) {
+                frontier.insert(frontier.end(), localNext[t].begin(), localNext[t].end());
+                unexploredEdges -= localEdges[t];
+            }
+            frontierSize = static_cast<long long>(frontier.size());
+        } else {
+            // 自底向上：每个未访问顶点在入邻居中寻找一个前沿顶点，找到即停止
+            forkJoin(threads, n, [&](long long begin, long long end, int t) {
+                for (long long v = begin; v < end; ++v) {
+                    inNext[v] = 0;
+                    if (level[v].load(std::memory_order_relaxed) != -1)
+                        continue;
+                    for (long long k = inOff[v]; k < inOff[v + 1]; ++k) {
+                        if (inFrontier[inTgt[k]]) {
+                            level[v].store(next, std::memory_order_relaxed);
+                            inNext[v] = 1;
+                            ++localCount[t];
+                            localEdges[t] += offsets[v + 1] - offsets[v];
+                            break;
+                        }
+                    }
+                }
+            });
+            inFrontier.swap(inNext);
+            frontierSize = 0;
+            for (int t = 0; t < threads; ++t) {
+                frontierSize += localCount[t];
+                unexploredEdges -= localEdges[t];
+            }
+        }
+    }
+
+    for (int v = 0; v < n; ++v)
+        dist[v] = level[v].load(std::memory_order_relaxed);
+}
+
+// 判断可达性
+inline bool CsrGraph::reachable(int source, int target, int threads) const {
+    checkVertex(source);
+    checkVertex(target);
+    std::vector<int> dist(vertices);
+    parallelBfs(source, &dist[0], threads);
+    return dist[target] != -1;
+}
@@ -0,0 +1,204 @@
+#include "../include/graph.hpp"
+#include <iostream>
+#include <string>
+#include <limits>
+#include <chrono>
+#include <random>
+#include <vector>
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+void printMenu() {
+    std::cout << "\n====== 图（CSR）交互测试菜单 ======\n";
+    std::cout << "命令列表：\n";
+    std::cout << "  edge <起点> <终点>         : 添加一条边（重新构造 CSR）\n";
+    std::cout << "  neighbors <顶点>           : 打印邻接点\n";
+    std::cout << "  bfs <起点>                 : 广度优先搜索（Queue）\n";
+    std::cout << "  dfs <起点>                 : 深度优先搜索（Stack）\n";
+    std::cout << "  pbfs <起点> [线程数]       : 方向优化并行 BFS，打印各顶点层数\n";
+    std::cout << "  reach <起点> <终点>        : 判断是否可达\n";
+    std::cout << "  random <顶点数> <边数>     : 生成随机图（替换当前图）\n";
+    std::cout << "  bench <起点> [线程数]      : 对比 bfs 与 pbfs 耗时\n";
+    std::cout << "  info                       : 顶点数与弧数\n";
+    std::cout << "  help                       : 显示菜单\n";
+    std::cout << "  exit / 0                   : 退出程序\n";
+    std::cout << "-----------------------------------\n";
+    std::cout << "请输入命令: ";
+}
+
+void printVertex(int v) {
+    std::cout << v << " ";
+}
+
+void clearInput() {
+    std::cin.clear();
+    std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+}
+
+// 读取可选的线程数参数，缺省为0（硬件并发数）
+int readOptionalThreads() {
+    int threads = 0;
+    std::string rest;
+    std::getline(std::cin, rest);
+    if (rest.find_first_not_of(" \t\r") != std::string::npos)
+        threads = std::stoi(rest);
+    return threads;
+}
+
+int main() {
+#ifdef _WIN32
+    SetConsoleOutputCP(CP_UTF8);
+    SetConsoleCP(CP_UTF8);
+#endif
+    int n;
+    std::cout << "请输入顶点数: ";
+    while (!(std::cin >> n) || n <= 0) {
+        std::cout << "顶点数无效，请输入正整数: ";
+        clearInput();
+    }
+    std::string kind;
+    std::cout << "是否为有向图（y/n）: ";
+    std::cin >> kind;
+    bool directed = (kind == "y" || kind == "Y");
+    std::vector<Edge> edges;
+    std::unique_ptr<CsrGraph> graph(new CsrGraph(n, edges, directed));
+
+    std::string cmd;
+    printMenu();
+    while (true) {
+        std::cout << "> ";
+        if (!(std::cin >> cmd)) break;
+        try {
+            if (cmd == "edge") {
+                Edge e;
+                if (!(std::cin >> e.from >> e.to)) {
+                    std::cout << "输入有误。用法: edge <起点> <终点>\n";
+                    clearInput();
+                    continue;
+                }
+                edges.push_back(e);
+                try {
+                    graph.reset(new CsrGraph(n, edges, directed));
+                    std::cout << "已添加边 " << e.from << (directed ? " -> " : " - ") << e.to << "。\n";
+                } catch (...) {
+                    edges.pop_back();
+                    throw;
+                }
+            } else if (cmd == "neighbors") {
+                int u;
+                if (!(std::cin >> u)) {
+                    std::cout << "输入有误。用法: neighbors <顶点>\n";
+                    clearInput();
+                    continue;
+                }
+                const int* end = graph->neighborsEnd(u);
+                std::cout << "顶点 " << u << " 的邻接点: ";
+                for (const int* p = graph->neighborsBegin(u); p != end; ++p)
+                    std::cout << *p << " ";
+                std::cout << "\n";
+            } else if (cmd == "bfs" || cmd == "dfs") {
+                int s;
+                if (!(std::cin >> s)) {
+                    std::cout << "输入有误。用法: " << cmd << " <起点>\n";
+                    clearInput();
+                    continue;
+                }
+                if (cmd == "bfs") {
+                    std::vector<int> dist(n);
+                    graph->bfs(s, &dist[0], nullptr);
+                    std::cout << "BFS 访问顺序: ";
+                    graph->bfs(s, nullptr, printVertex);
+                } else {
+                    std::cout << "DFS 访问顺序: ";
+                    graph->dfs(s, printVertex);
+                }
+                std::cout << "\n";
+            } else if (cmd == "pbfs") {
+                int s;
+                if (!(std::cin >> s)) {
+                    std::cout << "输入有误。用法: pbfs <起点> [线程数]\n";
+                    clearInput();
+                    continue;
+                }
+                int threads = readOptionalThreads();
+                std::vector<int> dist(n);
+                graph->parallelBfs(s, &dist[0], threads);
+                std::cout << "各顶点层数: ";
+                for (int v = 0; v < n && v < 64; ++v)
+                    std::cout << v << ":" << dist[v] << " ";
+                std::cout << (n > 64 ? "...\n" : "\n");
+                continue;
+            } else if (cmd == "reach") {
+                int s, t;
+                if (!(std::cin >> s >> t)) {
+                    std::cout << "输入有误。用法: reach <起点> <终点>\n";
+                    clearInput();
+                    continue;
+                }
+                std::cout << (graph->reachable(s, t) ? "可达。" : "不可达。") << "\n";
+            } else if (cmd == "random") {
+                int vn, em;
+                if (!(std::cin >> vn >> em) || vn <= 0 || em < 0) {
+                    std::cout << "输入有误。用法: random <顶点数> <边数>\n";
+                    clearInput();
+                    continue;
+                }
+                std::mt19937 rng(12345);
+                std::uniform_int_distribution<int> pick(0, vn - 1);
+                edges.clear();
+                edges.reserve(em);
+                for (int i = 0; i < em; ++i) {
+                    Edge e;
+                    e.from = pick(rng);
+                    e.to = pick(rng);
+                    edges.push_back(e);
+                }
+                n = vn;
+                auto start = std::chrono::steady_clock::now();
+                graph.reset(new CsrGraph(n, edges, directed));
+                auto end = std::chrono::steady_clock::now();
+                std::cout << "已生成随机图，构造 CSR 耗时 "
+                          << std::chrono::duration<double, std::milli>(end - start).count() << " ms。\n";
+            } else if (cmd == "bench") {
+                int s;
+                if (!(std::cin >> s)) {
+                    std::cout << "输入有误。用法: bench <起点> [线程数]\n";
+                    clearInput();
+                    continue;
+                }
+                int threads = readOptionalThreads();
+                std::vector<int> d1(n), d2(n);
+                auto t0 = std::chrono::steady_clock::now();
+                graph->bfs(s, &d1[0], nullptr);
+                auto t1 = std::chrono::steady_clock::now();
+                graph->parallelBfs(s, &d2[0], threads);
+                auto t2 = std::chrono::steady_clock::now();
+                int reached = 0;
+                bool same = true;
+                for (int v = 0; v < n; ++v) {
+                    if (d1[v] != -1) ++reached;
+                    if (d1[v] != d2[v]) same = false;
+                }
+                std::cout << "可达顶点 " << reached << " 个，结果" << (same ? "一致" : "不一致") << "。\n";
+                std::cout << "  bfs : " << std::chrono::duration<double, std::milli>(t1 - t0).count() << " ms\n";
+                std::cout << "  pbfs: " << std::chrono::duration<double, std::milli>(t2 - t1).count() << " ms\n";
+                continue;
+            } else if (cmd == "info") {
+                std::cout << "顶点数: " << graph->vertexCount() << "，弧数: " << graph->arcCount()
+                          << (graph->isDirected() ? "（有向）" : "（无向，每条边计两次）") << "\n";
+            } else if (cmd == "help") {
+                printMenu();
+            } else if (cmd == "exit" || cmd == "0") {
+                std::cout << "程序结束，再见！\n";
+                break;
+            } else {
+                std::cout << "未知命令。输入 help 查看菜单。\n";
+            }
+        } catch (const std::exception& e) {
+            std::cout << "错误: " << e.what() << "\n";
+        }
+        clearInput();
+    }
+    return 0;
+}
@@ -0,0 +1,211 @@
+#pragma once
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+#include <vector>
+
+/**
+ * @brief 分块布隆过滤器模板类
+ *
+ * 位数组按 512 位（一个 64 字节缓存行）分块，每个元素的 k 个位全部落在同一块内：
+ * 插入和查询只访问一个缓存行。查询结果为“可能存在”或“一定不存在”，没有假阴性；
+ * 假阳性率由构造时给定的预期元素数与目标误判率决定。
+ *
+ * 不支持删除：被删除元素的位保留在过滤器中，只会提高误判率，不会造成漏判。
+ * 上层容器在删除累积到一定比例时调用 reset 重建。
+ *
+ * @tparam T 元素类型
+ * @tparam Hash 哈希函数，默认为 std::hash<T>
+ */
+template<typename T, typename Hash = std::hash<T>>
+class BloomFilter {
+public:
+    static const int BLOCK_WORDS = 8;                  ///< 每块 8 个 64 位字，共 512 位
+    static const int BLOCK_BITS = BLOCK_WORDS * 64;    ///< 每块位数
+
+private:
+    std::vector<uint64_t> bits;   ///< 位数组，按块连续存放
+    size_t blockCount;            ///< 块数
+    int hashCount;                ///< 每个元素设置的位数 k
+    size_t expected;              ///< 预期元素数
+    size_t added;                 ///< 已加入的元素数（含重复与已被上层删除的）
+    double targetRate;            ///< 目标误判率
+    Hash hasher;                  ///< 哈希函数
+
+    static uint64_t mix(uint64_t h);
+
+public:
+    /**
+     * @brief 构造函数，按预期元素数与目标误判率确定位数与哈希个数
+     * @param expectedItems 预期元素数，至少按1计
+     * @param falsePositiveRate 目标误判率，范围 (0, 1)
+     * @throws std::invalid_argument 如果误判率不在 (0, 1) 内
+     */
+    explicit BloomFilter(size_t expectedItems = 1024, double falsePositiveRate = 0.01);
+
+    /**
+     * @brief 按新的预期元素数与误判率重新分配并清空
+     * @param expectedItems 预期元素数
+     * @param falsePositiveRate 目标误判率
+     * @throws std::invalid_argument 如果误判率不在 (0, 1) 内
+     * @throws std::bad_alloc 如果分配位数组失败（过滤器保持不变）
+     */
+    void reset(size_t expectedItems, double falsePositiveRate);
+
+    /**
+     * @brief 加入一个元素，O(k)，只访问一个缓存行
+     * @param value 元素
+     */
+    void add(const T& value);
+
+    /**
+     * @brief 查询元素是否可能存在，O(k)，只访问一个缓存行
+     * @param value 元素
+     * @return false 表示一定不存在；true 表示可能存在
+     */
+    bool mayContain(const T& value) const;
+
+    /**
+     * @brief 清空所有位，保留大小
+     */
+    void clear();
+
+    /**
+     * @brief 已加入的元素数
+     * @return 元素数
+     */
+    size_t count() const { return added; }
+
+    /**
+     * @brief 预期元素数（构造或 reset 时给定）
+     * @return 元素数
+     */
+    size_t capacity() const { return expected; }
+
+    /**
+     * @brief 目标误判率
+     * @return 误判率
+     */
+    double falsePositiveRate() const { return targetRate; }
+
+    /**
+     * @brief 每个元素设置的位数
+     * @return k
+     */
+    int hashes() const { return hashCount; }
+
+    /**
+     * @brief 位数组占用的字节数
+     * @return 字节数
+     */
+    size_t bytes() const { return bits.size() * sizeof(uint64_t); }
+
+    /**
+     * @brief 已置1的位所占比例，用于估计当前误判率（约为 比例^k）
+     * @return 比例 [0, 1]
+     */
+    double fillRatio() const;
+};
+
+// ================== 实现部分 ==================
+
+template<typename T, typename Hash> const int BloomFilter<T, Hash>::BLOCK_WORDS;
+template<typename T, typename Hash> const int BloomFilter<T, Hash>::BLOCK_BITS;
+
+// 构造函数
+template<typename T, typename Hash>
+BloomFilter<T, Hash>::BloomFilter(size_t expectedItems, double falsePositiveRate)
+    : blockCount(0), hashCount(1), expected(0), added(0), targetRate(falsePositiveRate) {
+    reset(expectedItems, falsePositiveRate);
+}
+
+// 每元素位数 m/n = -ln(p) / ln(2)^2，k = (m/n)·ln2。
+// 分块后各块负载不均，误判率略高于经典公式，位数多给 10% 弥补（k 仍按未加量的位数计算）
+template<typename T, typename Hash>
+void BloomFilter<T, Hash>::reset(size_t expectedItems, double falsePositiveRate) {
+    if (!(falsePositiveRate > 0.0 && falsePositiveRate < 1.0)) {
+        throw std::invalid_argument("False positive rate must be in (0, 1)");
+    }
+    if (expectedItems == 0) expectedItems = 1;
+    const double ln2 = 0.6931471805599453;
+    double bitsPerItem = -std::log(falsePositiveRate) / (ln2 * ln2) * 1.1;
+    int k = static_cast<int>(bitsPerItem / 1.1 * ln2 + 0.5);
+    double totalBits = bitsPerItem * static_cast<double>(expectedItems);
+    size_t blocks = static_cast<size_t>(totalBits / BLOCK_BITS) + 1;
+    // 先在临时数组中分配，成功后再一并提交，分配失败时过滤器保持原状
+    std::vector<uint64_t> fresh(blocks * BLOCK_WORDS, 0);
+    bits.swap(fresh);
+    blockCount = blocks;
+    hashCount = k < 1 ? 1 : (k > 16 ? 16 : k);
+    expected = expectedItems;
+    added = 0;
+    targetRate = falsePositiveRate;
+}
+
+// 64 位哈希终结函数（splitmix64），把 std::hash 的弱哈希（如整数恒等映射）打散
+template<typename T, typename Hash>
+uint64_t BloomFilter<T, Hash>::mix(uint64_t h) {
+    h ^= h >> 30;
+    h *= 0xBF58476D1CE4E5B9ULL;
+    h ^= h >> 27;
+    h *= 0x94D049BB133111EBULL;
+    h ^= h >> 31;
+    return h;
+}
+
+// 加入元素：高32位选块，低位每 9 位确定块内一个位，不够时再混合一次
+template<typename T, typename Hash>
+void BloomFilter<T, Hash>::add(const T& value) {
+    uint64_t h = mix(static_cast<uint64_t>(hasher(value)));
+    uint64_t* block = &bits[((h >> 32) % blockCount) * BLOCK_WORDS];
+    uint64_t g = mix(h ^ 0x9E3779B97F4A7C15ULL);
+    for (int i = 0, used = 0; i < hashCount; ++i, used += 9) {
+        if (used + 9 > 64) {
+            g = mix(g);
+            used = 0;
+        }
+        unsigned bit = static_cast<unsigned>(g >> used) & (BLOCK_BITS - 1);
+        block[bit >> 6] |= uint64_t(1) << (bit & 63);
+    }
+    ++added;
+}
+
+// 查询：与加入时相同的位置，任一位为0即一定不存在
+template<typename T, typename Hash>
+bool BloomFilter<T, Hash>::mayContain(const T& value) const {
+    uint64_t h = mix(static_cast<uint64_t>(hasher(value)));
+    const uint64_t* block = &bits[((h >> 32) % blockCount) * BLOCK_WORDS];
+    uint64_t g = mix(h ^ 0x9E3779B97F4A7C15ULL);
+    for (int i = 0, used = 0; i < hashCount; ++i, used += 9) {
+        if (used + 9 > 64) {
+            g = mix(g);
+            used = 0;
+        }
+        unsigned bit = static_cast<unsigned>(g >> used) & (BLOCK_BITS - 1);
+        if (!(block[bit >> 6] & (uint64_t(1) << (bit & 63)))) return false;
+    }
+    return true;
+}
+
+// 清空所有位
+template<typename T, typename Hash>
+void BloomFilter<T, Hash>::clear() {
+    for (size_t i = 0; i < bits.size(); ++i) bits[i] = 0;
+    added = 0;
+}
+
+// 已置1的位所占比例
+template<typename T, typename Hash>
+double BloomFilter<T, Hash>::fillRatio() const {
+    size_t ones = 0;
+    for (size_t i = 0; i < bits.size(); ++i) {
+        uint64_t w = bits[i];
+        while (w) {
+            w &= w - 1;
+            ++ones;
+        }
+    }
+    return static_cast<double>(ones) / (static_cast<double>(bits.size()) * 64.0);
+}
@@ -0,0 +1,490 @@
+#pragma once
+#include <stdexcept>
+
+/**
+ * @brief 双向链表节点模板结构体
+ *
+ * 表示双向链表的一个节点，包含数据域和指向前驱、后继节点的指针。
+ *
+ * @tparam T 节点存储的数据类型
+ */
+template<typename T>
+struct DLinkNode {
+    T data;                 ///< 节点存储的数据
+    DLinkNode<T>* prev;     ///< 指向前驱节点的指针
+    DLinkNode<T>* next;     ///< 指向后继节点的指针
+
+    /**
+     * @brief 构造函数
+     * @param x 节点数据，默认为T类型的默认值
+     */
+    DLinkNode(const T& x = T()) : data(x), prev(nullptr), next(nullptr) {}
+};
+
+/**
+ * @brief 双向循环链表模板类
+ *
+ * 带头结点的双向循环链表，头结点的 next 为首元素、prev 为尾元素，
+ * 因此两端的插入、删除均为 O(1)。push_front/push_back 返回新节点指针，
+ * 可作为句柄用于 O(1) 的 erase/moveToFront/moveToBack（如 LRU 缓存）。
+ *
+ * @tparam T 链表存储的数据类型
+ */
+template<typename T>
+class DLinkList {
+private:
+    DLinkNode<T>* head;    ///< 头结点指针（哨兵，不存放元素）
+    int length;            ///< 链表长度（元素个数）
+
+    /**
+     * @brief 获取指定位置的节点指针，从较近的一端开始查找
+     * @param index 节点索引（-1与length均返回头结点）
+     * @return 指向对应节点的指针，越界返回nullptr
+     */
+    DLinkNode<T>* access(int index) const;
+
+    /**
+     * @brief 将节点链入pos之前
+     * @param pos 位置节点
+     * @param p 待链入节点
+     */
+    static void linkBefore(DLinkNode<T>* pos, DLinkNode<T>* p);
+
+    /**
+     * @brief 将节点从链表中摘下（不释放）
+     * @param p 待摘下节点
+     */
+    static void unlink(DLinkNode<T>* p);
+
+public:
+    /**
+     * @brief 构造函数，初始化空链表
+     */
+    DLinkList();
+
+    /**
+     * @brief 拷贝构造函数，深拷贝链表
+     * @param other 被拷贝的链表
+     */
+    DLinkList(const DLinkList& other);
+
+    /**
+     * @brief 赋值操作符重载，深拷贝链表
+     * @param other 被赋值的链表
+     * @return 当前对象的引用
+     */
+    DLinkList& operator=(const DLinkList& other);
+
+    /**
+     * @brief 析构函数，释放所有节点
+     */
+    ~DLinkList();
+
+    /**
+     * @brief 清空链表内容
+     */
+    void clear();
+
+    /**
+     * @brief 判断链表是否为空
+     * @return 为空返回true，否则返回false
+     */
+    bool empty() const;
+
+    /**
+     * @brief 获取链表长度
+     * @return 链表中元素个数
+     */
+    int size() const;
+
+    /**
+     * @brief 获取首元素
+     * @return 首元素引用
+     * @throws std::out_of_range 如果链表为空
+     */
+    T& front();
+    const T& front() const;
+
+    /**
+     * @brief 获取尾元素
+     * @return 尾元素引用
+     * @throws std::out_of_range 如果链表为空
+     */
+    T& back();
+    const T& back() const;
+
+    /**
+     * @brief 获取首元素节点
+     * @return 首元素节点指针，空表返回nullptr
+     */
+    DLinkNode<T>* frontNode() const;
+
+    /**
+     * @brief 获取尾元素节点
+     * @return 尾元素节点指针，空表返回nullptr
+     */
+    DLinkNode<T>* backNode() const;
+
+    /**
+     * @brief 获取指定位置的元素
+     * @param index 元素索引（0为第一个元素）
+     * @return 指定位置的元素值
+     * @throws std::out_of_range 如果索引越界
+     */
+    T get(int index) const;
+
+    /**
+     * @brief 查找元素首次出现的位置
+     * @param data 要查找的元素值
+     * @return 元素索引，未找到返回-1
+     */
+    int find(const T& data) const;
+
+    /**
+     * @brief 在指定位置插入元素
+     * @param index 插入位置（0为头部，size()为尾部）
+     * @param data 插入的元素值
+     * @throws std::out_of_range 如果索引越界
+     */
+    void insert(int index, const T& data);
+
+    /**
+     * @brief 删除指定位置的元素
+     * @param index 删除位置（0为第一个元素）
+     * @throws std::out_of_range 如果索引越界
+     */
+    void remove(int index);
+
+    /**
+     * @brief 头部插入元素，O(1)
+     * @param data 插入的元素值
+     * @return 新节点指针
+     */
+    DLinkNode<T>* push_front(const T& data);
+
+    /**
+     * @brief 尾部插入元素，O(1)
+     * @param data 插入的元素值
+     * @return 新节点指针
+     */
+    DLinkNode<T>* push_back(const T& data);
+
+    /**
+     * @brief 删除首元素，O(1)
+     * @throws std::out_of_range 如果链表为空
+     */
+    void pop_front();
+
+    /**
+     * @brief 删除尾元素，O(1)
+     * @throws std::out_of_range 如果链表为空
+     */
+    void pop_back();
+
+    /**
+     * @brief 删除指定节点，O(1)
+     * @param node 本链表中的节点
+     */
+    void erase(DLinkNode<T>* node);
+
+    /**
+     * @brief 将指定节点移动到头部，O(1)
+     * @param node 本链表中的节点
+     */
+    void moveToFront(DLinkNode<T>* node);
+
+    /**
+     * @brief 将指定节点移动到尾部，O(1)
+     * @param node 本链表中的节点
+     */
+    void moveToBack(DLinkNode<T>* node);
+
+    /**
+     * @brief 将other的全部节点拼接到本链表尾部，O(1)
+     * @param other 另一个链表，拼接后为空
+     */
+    void splice(DLinkList& other);
+
+    /**
+     * @brief 将other中的单个节点摘下并接到本链表尾部，O(1)，不分配内存
+     * @param node other中的节点
+     * @param other 节点当前所在的链表
+     */
+    void splice(DLinkNode<T>* node, DLinkList& other);
+
+    /**
+     * @brief 遍历链表，对每个元素调用visit函数
+     * @param visit 回调函数，参数为const T&，无返回值
+     */
+    void traverse(void (*visit)(const T&)) const;
+};
+
+// ================== 实现部分 ==================
+
+// 构造函数，头结点自环表示空表
+template<typename T>
+DLinkList<T>::DLinkList()
+    : head(new DLinkNode<T>()), length(0) {
+    head->prev = head;
+    head->next = head;
+}
+
+// 拷贝构造函数，深拷贝链表
+template<typename T>
+DLinkList<T>::DLinkList(const DLinkList& other)
+    : DLinkList() {
+    for (DLinkNode<T>* p = other.head->next; p != other.head; p = p->next)
+        push_back(p->data);
+}
+
+// 赋值操作符重载，深拷贝链表
+template<typename T>
+DLinkList<T>& DLinkList<T>::operator=(const DLinkList& other) {
+    if (this != &other) {
+        clear();
+        for (DLinkNode<T>* p = other.head->next; p != other.head; p = p->next)
+            push_back(p->data);
+    }
+    return *this;
+}
+
+// 析构函数，释放所有节点（包括头结点）
+template<typename T>
+DLinkList<T>::~DLinkList() {
+    clear();
+    delete head;
+}
+
+// 清空链表，释放所有元素节点但保留头结点
+template<typename T>
+void DLinkList<T>::clear() {
+    DLinkNode<T>* p = head->next;
+    while (p != head) {
+        DLinkNode<T>* next = p->next;
+        delete p;
+        p = next;
+    }
+    head->prev = head;
+    head->next = head;
+    length = 0;
+}
+
+// 判断链表是否为空
+template<typename T>
+bool DLinkList<T>::empty() const {
+    return length == 0;
+}
+
+// 获取链表长度
+template<typename T>
+int DLinkList<T>::size() const {
+    return length;
+}
+
+// 获取首元素
+template<typename T>
+T& DLinkList<T>::front() {
+    if (empty())
+        throw std::out_of_range("List is empty");
+    return head->next->data;
+}
+
+template<typename T>
+const T& DLinkList<T>::front() const {
+    if (empty())
+        throw std::out_of_range("List is empty");
+    return head->next->data;
+}
+
+// 获取尾元素
+template<typename T>
+T& DLinkList<T>::back() {
+    if (empty())
+        throw std::out_of_range("List is empty");
+    return head->prev->data;
+}
+
+template<typename T>
+const T& DLinkList<T>::back() const {
+    if (empty())
+        throw std::out_of_range("List is empty");
+    return head->prev->data;
+}
+
+// 获取首元素节点
+template<typename T>
+DLinkNode<T>* DLinkList<T>::frontNode() const {
+    return empty() ? nullptr : head->next;
+}
+
+// 获取尾元素节点
+template<typename T>
+DLinkNode<T>* DLinkList<T>::backNode() const {
+    return empty() ? nullptr : head->prev;
+}
+
+// 获取指定位置的节点指针，index位于后半段时从尾部反向查找
+template<typename T>
+DLinkNode<T>* DLinkList<T>::access(int index) const {
+    if (index < -1 || index > length)
+        return nullptr;
+    if (index == -1 || index == length)
+        return head;
+    DLinkNode<T>* p;
+    if (index < length / 2) {
+        p = head->next;
+        for (int i = 0; i < index; ++i)
+            p = p->next;
+    } else {
+        p = head->prev;
+        for (int i = length - 1; i > index; --i)
+            p = p->prev;
+    }
+    return p;
+}
+
+// 将节点链入pos之前
+template<typename T>
+void DLinkList<T>::linkBefore(DLinkNode<T>* pos, DLinkNode<T>* p) {
+    p->next = pos;
+    p->prev = pos->prev;
+    pos->prev->next = p;
+    pos->prev = p;
+}
+
+// 将节点从链表中摘下
+template<typename T>
+void DLinkList<T>::unlink(DLinkNode<T>* p) {
+    p->prev->next = p->next;
+    p->next->prev = p->prev;
+}
+
+// 获取指定位置的元素值
+template<typename T>
+T DLinkList<T>::get(int index) const {
+    if (index < 0 || index >= length)
+        throw std::out_of_range("Index out of range");
+    return access(index)->data;
+}
+
+// 查找元素首次出现的位置，未找到返回-1
+template<typename T>
+int DLinkList<T>::find(const T& data) const {
+    int index = 0;
+    for (DLinkNode<T>* p = head->next; p != head; p = p->next, ++index) {
+        if (p->data == data)
+            return index;
+    }
+    return -1;
+}
+
+// 在指定位置插入元素，index==size()时插入到尾部
+template<typename T>
+void DLinkList<T>::insert(int index, const T& data) {
+    if (index < 0 || index > length)
+        throw std::out_of_range("Index out of range");
+    DLinkNode<T>* pos = access(index);
+    linkBefore(pos, new DLinkNode<T>(data));
+    ++length;
+}
+
+// 删除指定位置的元素
+template<typename T>
+void DLinkList<T>::remove(int index) {
+    if (index < 0 || index >= length)
+        throw std::out_of_range("Index out of range");
+    erase(access(index));
+}
+
+// 头部插入
+template<typename T>
+DLinkNode<T>* DLinkList<T>::push_front(const T& data) {
+    DLinkNode<T>* p = new DLinkNode<T>(data);
+    linkBefore(head->next, p);
+    ++length;
+    return p;
+}
+
+// 尾部插入
+template<typename T>
+DLinkNode<T>* DLinkList<T>::push_back(const T& data) {
+    DLinkNode<T>* p = new DLinkNode<T>(data);
+    linkBefore(head, p);
+    ++length;
+    return p;
+}
+
+// 删除首元素
+template<typename T>
+void DLinkList<T>::pop_front() {
+    if (empty())
+        throw std::out_of_range("List is empty");
+    erase(head->next);
+}
+
+// 删除尾元素
+template<typename T>
+void DLinkList<T>::pop_back() {
+    if (empty())
+        throw std::out_of_range("List is empty");
+    erase(head->prev);
+}
+
+// 删除指定节点
+template<typename T>
+void DLinkList<T>::erase(DLinkNode<T>* node) {
+    unlink(node);
+    delete node;
+    --length;
+}
+
+// 将指定节点移动到头部
+template<typename T>
+void DLinkList<T>::moveToFront(DLinkNode<T>* node) {
+    if (head->next == node)
+        return;
+    unlink(node);
+    linkBefore(head->next, node);
+}
+
+// 将指定节点移动到尾部
+template<typename T>
+void DLinkList<T>::moveToBack(DLinkNode<T>* node) {
+    if (head->prev == node)
+        return;
+    unlink(node);
+    linkBefore(head, node);
+}
+
+// 拼接：把other的首尾整段接到本链表尾部
+template<typename T>
+void DLinkList<T>::splice(DLinkList& other) {
+    if (this == &other || other.empty())
+        return;
+    DLinkNode<T>* first = other.head->next;
+    DLinkNode<T>* last = other.head->prev;
+    first->prev = head->prev;
+    head->prev->next = first;
+    last->next = head;
+    head->prev = last;
+    length += other.length;
+    other.head->prev = other.head;
+    other.head->next = other.head;
+    other.length = 0;
+}
+
+// 拼接单个节点：从other摘下后链入本链表尾部
+template<typename T>
+void DLinkList<T>::splice(DLinkNode<T>* node, DLinkList& other) {
+    unlink(node);
+    --other.length;
+    linkBefore(head, node);
+    ++length;
+}
+
+// 遍历链表，对每个元素调用visit函数
+template<typename T>
+void DLinkList<T>::traverse(void (*visit)(const T&)) const {
+    for (DLinkNode<T>* p = head->next; p != head; p = p->next)
+        visit(p->data);
+}
@@ -0,0 +1,197 @@
+#pragma once
+#include "bloomFilter.hpp"
+#include "linkList.hpp"
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+
+/**
+ * @brief 带布隆过滤器的单链表模板类
+ *
+ * 在 LinkList 之外维护一个分块布隆过滤器：插入时把元素加入过滤器，
+ * find/contains 先查过滤器，“一定不存在”时 O(1) 返回，只有可能存在时才线性扫描链表。
+ * 适合查询多数落空的场景（去重检查、黑名单等）。
+ *
+ * 删除不会从过滤器中清除位，只计入“过期”计数：过期数超过 当前长度×重建比例 时，
+ * 或过滤器加入的元素数超过其预期容量时，按当前长度重建过滤器，使误判率回到目标值。
+ * 重建为 O(n)，按比例触发，均摊到每次修改为 O(1)。
+ *
+ * @tparam T 元素类型（需可比较相等、可哈希）
+ * @tparam Hash 哈希函数，默认为 std::hash<T>
+ */
+template<typename T, typename Hash = std::hash<T>>
+class FilteredLinkList {
+public:
+    static const int MIN_FILTER_ITEMS = 64;   ///< 过滤器的最小预期容量
+
+private:
+    LinkList<T> items;               ///< 底层链表
+    BloomFilter<T, Hash> filter;     ///< 成员过滤器
+    double targetRate;               ///< 目标误判率
+    double rebuildRatio;             ///< 过期数 / 长度 超过该比例时重建
+    int stale;                       ///< 自上次重建以来删除的元素数
+    std::size_t rebuildTimes;        ///< 累计重建次数
+
+    /**
+     * @brief 过期过多或过滤器超出容量时重建
+     */
+    void maybeRebuild();
+
+public:
+    /**
+     * @brief 构造函数，初始化空链表
+     * @param falsePositiveRate 目标误判率，范围 (0, 1)
+     * @param rebuildRatio 重建比例，过期数超过 长度×该比例 时重建，必须大于0
+     * @throws std::invalid_argument 如果参数不合法
+     */
+    explicit FilteredLinkList(double falsePositiveRate = 0.01, double rebuildRatio = 0.25);
+
+    /**
+     * @brief 清空链表与过滤器
+     */
+    void clear();
+
+    /**
+     * @brief 判断链表是否为空
+     * @return 为空返回true，否则返回false
+     */
+    bool empty() const { return items.empty(); }
+
+    /**
+     * @brief 获取链表长度
+     * @return 元素个数
+     */
+    int size() const { return items.size(); }
+
+    /**
+     * @brief 获取指定位置的元素
+     * @param index 元素索引（0为第一个元素）
+     * @return 元素值
+     * @throws std::out_of_range 如果索引越界
+     */
+    T get(int index) const { return items.get(index); }
+
+    /**
+     * @brief 查找元素首次出现的位置，过滤器判定不存在时 O(1) 返回
+     * @param data 要查找的元素值
+     * @return 元素索引，未找到返回-1
+     */
+    int find(const T& data) const;
+
+    /**
+     * @brief 判断元素是否存在
+     * @param data 元素值
+     * @return 存在返回true，否则返回false
+     */
+    bool contains(const T& data) const { return find(data) >= 0; }
+
+    /**
+     * @brief 在指定位置插入元素，并加入过滤器
+     * @param index 插入位置（0为头部，size()为尾部）
+     * @param data 插入的元素值
+     * @throws std::out_of_range 如果索引越界
+     */
+    void insert(int index, const T& data);
+
+    /**
+     * @brief 删除指定位置的元素，过期数加一，必要时重建过滤器
+     * @param index 删除位置（0为第一个元素）
+     * @throws std::out_of_range 如果索引越界
+     */
+    void remove(int index);
+
+    /**
+     * @brief 按当前元素重建过滤器，清除所有过期位
+     */
+    void rebuild();
+
+    /**
+     * @brief 遍历链表，对每个元素调用可调用对象
+     * @param visit 可调用对象，参数为const T&
+     */
+    template<typename F>
+    void forEach(F visit) const { items.forEach(visit); }
+
+    /**
+     * @brief 自上次重建以来删除的元素数
+     * @return 过期数
+     */
+    int staleCount() const { return stale; }
+
+    /**
+     * @brief 累计重建次数
+     * @return 次数
+     */
+    std::size_t rebuilds() const { return rebuildTimes; }
+
+    /**
+     * @brief 只读访问过滤器（查看大小、填充率等）
+     * @return 过滤器的常量引用
+     */
+    const BloomFilter<T, Hash>& bloom() const { return filter; }
+};
+
+// ================== 实现部分 ==================
+
+template<typename T, typename Hash> const int FilteredLinkList<T, Hash>::MIN_FILTER_ITEMS;
+
+// 构造函数
+template<typename T, typename Hash>
+FilteredLinkList<T, Hash>::FilteredLinkList(double falsePositiveRate, double rebuildRatio)
+    : filter(MIN_FILTER_ITEMS, falsePositiveRate), targetRate(falsePositiveRate),
+      rebuildRatio(rebuildRatio), stale(0), rebuildTimes(0) {
+    if (!(rebuildRatio > 0.0)) {
+        throw std::invalid_argument("Rebuild ratio must be positive");
+    }
+}
+
+// 清空链表与过滤器，过滤器缩回最小容量
+template<typename T, typename Hash>
+void FilteredLinkList<T, Hash>::clear() {
+    items.clear();
+    filter.reset(MIN_FILTER_ITEMS, targetRate);
+    stale = 0;
+}
+
+// 查找：先查过滤器，可能存在时再扫描链表
+template<typename T, typename Hash>
+int FilteredLinkList<T, Hash>::find(const T& data) const {
+    if (!filter.mayContain(data)) return -1;
+    return items.find(data);
+}
+
+// 插入：先插入链表（可能抛出越界异常），再加入过滤器
+template<typename T, typename Hash>
+void FilteredLinkList<T, Hash>::insert(int index, const T& data) {
+    items.insert(index, data);
+    filter.add(data);
+    maybeRebuild();
+}
+
+// 删除：过滤器无法删除，只记过期数
+template<typename T, typename Hash>
+void FilteredLinkList<T, Hash>::remove(int index) {
+    items.remove(index);
+    ++stale;
+    maybeRebuild();
+}
+
+// 按当前长度的两倍分配过滤器并重新加入全部元素
+template<typename T, typename Hash>
+void FilteredLinkList<T, Hash>::rebuild() {
+    std::size_t n = static_cast<std::size_t>(items.size());
+    filter.reset(n * 2 > MIN_FILTER_ITEMS ? n * 2 : MIN_FILTER_ITEMS, targetRate);
+    BloomFilter<T, Hash>& f = filter;
+    items.forEach([&f](const T& x) { f.add(x); });
+    stale = 0;
+    ++rebuildTimes;
+}
+
+// 过期数超过比例（长度过小时按最小容量计），或过滤器加入数超出预期容量时重建
+template<typename T, typename Hash>
+void FilteredLinkList<T, Hash>::maybeRebuild() {
+    int base = items.size() > MIN_FILTER_ITEMS ? items.size() : MIN_FILTER_ITEMS;
+    if (stale > rebuildRatio * base || filter.count() > filter.capacity()) {
+        rebuild();
+    }
+}
@@ -0,0 +1,418 @@
+#pragma once
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+
+/**
+ * @brief 侵入式链表挂钩
+ *
+ * 作为成员嵌入到用户对象中，保存前驱/后继指针。
+ * 一个对象可以包含多个挂钩，从而同时挂在多个 IntrusiveList 上。
+ * 挂钩的拷贝不会复制链接关系，拷贝得到的对象处于未链接状态。
+ */
+struct IntrusiveHook {
+    IntrusiveHook* prev;   ///< 前驱挂钩
+    IntrusiveHook* next;   ///< 后继挂钩
+
+    /**
+     * @brief 构造函数，初始化为未链接状态
+     */
+    IntrusiveHook() : prev(nullptr), next(nullptr) {}
+
+    /**
+     * @brief 拷贝构造函数，不复制链接关系
+     */
+    IntrusiveHook(const IntrusiveHook&) : prev(nullptr), next(nullptr) {}
+
+    /**
+     * @brief 赋值操作符，保持自身链接关系不变
+     * @return 当前对象的引用
+     */
+    IntrusiveHook& operator=(const IntrusiveHook&) { return *this; }
+
+    /**
+     * @brief 判断挂钩是否已链接到某个链表
+     * @return 已链接返回true，否则返回false
+     */
+    bool isLinked() const { return next != nullptr; }
+};
+
+/**
+ * @brief 侵入式双向循环链表模板类
+ *
+ * 不拥有、不拷贝元素：链接指针保存在元素自身的 IntrusiveHook 成员中，
+ * 插入、删除、拼接均为 O(1) 且不分配内存。适合元素已由对象池管理的场景。
+ * 链表析构或清空时只解除链接，不释放元素；元素在链表中时不得被销毁。
+ *
+ * @tparam T 元素类型
+ * @tparam Hook 元素中挂钩成员的成员指针，例如 &Task::readyHook
+ */
+template<typename T, IntrusiveHook T::*Hook>
+class IntrusiveList {
+private:
+    IntrusiveHook sentinel;   ///< 哨兵挂钩，sentinel.next为首元素，sentinel.prev为尾元素
+    int length;               ///< 链表长度（元素个数）
+    const std::ptrdiff_t hookOffset;   ///< 挂钩成员在元素中的字节偏移，构造时取得
+
+    /**
+     * @brief 求挂钩成员在元素中的字节偏移，每个实例化只计算一次
+     * @return 字节偏移
+     */
+    static std::ptrdiff_t offsetOfHook();
+
+    /**
+     * @brief 由元素取得其挂钩
+     * @param elem 元素引用
+     * @return 挂钩指针
+     */
+    static IntrusiveHook* hookOf(T& elem) { return &(elem.*Hook); }
+
+    /**
+     * @brief 由挂钩反推所属元素
+     * @param hook 挂钩指针（不能是哨兵）
+     * @return 元素指针
+     */
+    T* ownerOf(IntrusiveHook* hook) const;
+
+    /**
+     * @brief 将未链接的挂钩链入pos之前
+     * @param pos 位置挂钩
+     * @param hook 待链入挂钩
+     * @throws std::invalid_argument 如果挂钩已在某个链表中
+     */
+    void linkBefore(IntrusiveHook* pos, IntrusiveHook* hook);
+
+    /**
+     * @brief 解除挂钩的链接
+     * @param hook 待解除挂钩
+     */
+    void unlink(IntrusiveHook* hook);
+
+public:
+    /**
+     * @brief 构造函数，初始化空链表
+     */
+    IntrusiveList();
+
+    /**
+     * @brief 析构函数，解除所有元素的链接（不释放元素）
+     */
+    ~IntrusiveList();
+
+    IntrusiveList(const IntrusiveList&) = delete;
+    IntrusiveList& operator=(const IntrusiveList&) = delete;
+
+    /**
+     * @brief 判断链表是否为空
+     * @return 为空返回true，否则返回false
+     */
+    bool empty() const;
+
+    /**
+     * @brief 获取链表长度
+     * @return 链表中元素个数
+     */
+    int size() const;
+
+    /**
+     * @brief 获取首元素
+     * @return 首元素引用
+     * @throws std::out_of_range 如果链表为空
+     */
+    T& front();
+
+    /**
+     * @brief 获取尾元素
+     * @return 尾元素引用
+     * @throws std::out_of_range 如果链表为空
+     */
+    T& back();
+
+    /**
+     * @brief 在头部插入元素，O(1)
+     * @param elem 未链接到本挂钩的元素
+     * @throws std::invalid_argument 如果元素已在链表中
+     */
+    void push_front(T& elem);
+
+    /**
+     * @brief 在尾部插入元素，O(1)
+     * @param elem 未链接到本挂钩的元素
+     * @throws std::invalid_argument 如果元素已在链表中
+     */
+    void push_back(T& elem);
+
+    /**
+     * @brief 在pos之前插入元素，O(1)
+     * @param pos 本链表中的元素
+     * @param elem 未链接到本挂钩的元素
+     * @throws std::invalid_argument 如果pos不在链表中或elem已在链表中
+     */
+    void insertBefore(T& pos, T& elem);
+
+    /**
+     * @brief 在pos之后插入元素，O(1)
+     * @param pos 本链表中的元素
+     * @param elem 未链接到本挂钩的元素
+     * @throws std::invalid_argument 如果pos不在链表中或elem已在链表中
+     */
+    void insertAfter(T& pos, T& elem);
+
+    /**
+     * @brief 移除并返回首元素，O(1)
+     * @return 被移除的元素引用
+     * @throws std::out_of_range 如果链表为空
+     */
+    T& pop_front();
+
+    /**
+     * @brief 移除并返回尾元素，O(1)
+     * @return 被移除的元素引用
+     * @throws std::out_of_range 如果链表为空
+     */
+    T& pop_back();
+
+    /**
+     * @brief 从链表中移除指定元素，O(1)
+     *
+     * 元素必须位于本链表中（无法在 O(1) 内校验属于哪一个链表）。
+     *
+     * @param elem 待移除的元素
+     * @throws std::invalid_argument 如果元素未链接
+     */
+    void remove(T& elem);
+
+    /**
+     * @brief 将other的全部元素拼接到本链表尾部，O(1)
+     * @param other 另一个使用相同挂钩的链表，拼接后为空
+     */
+    void splice(IntrusiveList& other);
+
+    /**
+     * @brief 获取元素的后继
+     * @param elem 本链表中的元素
+     * @return 后继元素指针，elem为尾元素时返回nullptr
+     */
+    T* next(T& elem);
+
+    /**
+     * @brief 获取元素的前驱
+     * @param elem 本链表中的元素
+     * @return 前驱元素指针，elem为首元素时返回nullptr
+     */
+    T* prev(T& elem);
+
+    /**
+     * @brief 清空链表，解除所有元素的链接（不释放元素），O(n)
+     */
+    void clear();
+
+    /**
+     * @brief 遍历链表，对每个元素调用visit函数
+     * @param visit 回调函数，参数为const T&，无返回值
+     */
+    void traverse(void (*visit)(const T&)) const;
+};
+
+// ================== 实现部分 ==================
+
+// 挂钩偏移：成员指针不能用于 offsetof，在一块与 T 同样大小、对齐的栈上缓冲区上量取，
+// 只取地址、不读写成员；局部静态变量保证每个实例化只计算一次
+template<typename T, IntrusiveHook T::*Hook>
+std::ptrdiff_t IntrusiveList<T, Hook>::offsetOfHook() {
+    static const std::ptrdiff_t offset = [] {
+        typename std::aligned_storage<sizeof(T), alignof(T)>::type probe;
+        T* elem = reinterpret_cast<T*>(&probe);
+        return reinterpret_cast<char*>(std::addressof(elem->*Hook)) - reinterpret_cast<char*>(elem);
+    }();
+    return offset;
+}
+
+// 由挂钩反推所属元素
+template<typename T, IntrusiveHook T::*Hook>
+T* IntrusiveList<T, Hook>::ownerOf(IntrusiveHook* hook) const {
+    return reinterpret_cast<T*>(reinterpret_cast<char*>(hook) - hookOffset);
+}
+
+// 将未链接的挂钩链入pos之前
+template<typename T, IntrusiveHook T::*Hook>
+void IntrusiveList<T, Hook>::linkBefore(IntrusiveHook* pos, IntrusiveHook* hook) {
+    if (hook->isLinked())
+        throw std::invalid_argument("Element is already linked");
+    hook->next = pos;
+    hook->prev = pos->prev;
+    pos->prev->next = hook;
+    pos->prev = hook;
+    ++length;
+}
+
+// 解除挂钩的链接
+template<typename T, IntrusiveHook T::*Hook>
+void IntrusiveList<T, Hook>::unlink(IntrusiveHook* hook) {
+    hook->prev->next = hook->next;
+    hook->next->prev = hook->prev;
+    hook->prev = nullptr;
+    hook->next = nullptr;
+    --length;
+}
+
+// 构造函数，哨兵自环表示空表
+template<typename T, IntrusiveHook T::*Hook>
+IntrusiveList<T, Hook>::IntrusiveList() : sentinel(), length(0), hookOffset(offsetOfHook()) {
+    sentinel.prev = &sentinel;
+    sentinel.next = &sentinel;
+}
+
+// 析构函数，解除所有元素的链接
+template<typename T, IntrusiveHook T::*Hook>
+IntrusiveList<T, Hook>::~IntrusiveList() {
+    clear();
+}
+
+// 判断链表是否为空
+template<typename T, IntrusiveHook T::*Hook>
+bool IntrusiveList<T, Hook>::empty() const {
+    return length == 0;
+}
+
+// 获取链表长度
+template<typename T, IntrusiveHook T::*Hook>
+int IntrusiveList<T, Hook>::size() const {
+    return length;
+}
+
+// 获取首元素
+template<typename T, IntrusiveHook T::*Hook>
+T& IntrusiveList<T, Hook>::front() {
+    if (empty())
+        throw std::out_of_range("List is empty");
+    return *ownerOf(sentinel.next);
+}
+
+// 获取尾元素
+template<typename T, IntrusiveHook T::*Hook>
+T& IntrusiveList<T, Hook>::back() {
+    if (empty())
+        throw std::out_of_range("List is empty");
+    return *ownerOf(sentinel.prev);
+}
+
+// 头部插入
+template<typename T, IntrusiveHook T::*Hook>
+void IntrusiveList<T, Hook>::push_front(T& elem) {
+    linkBefore(sentinel.next, hookOf(elem));
+}
+
+// 尾部插入
+template<typename T, IntrusiveHook T::*Hook>
+void IntrusiveList<T, Hook>::push_back(T& elem) {
+    linkBefore(&sentinel, hookOf(elem));
+}
+
+// 在pos之前插入
+template<typename T, IntrusiveHook T::*Hook>
+void IntrusiveList<T, Hook>::insertBefore(T& pos, T& elem) {
+    IntrusiveHook* p = hookOf(pos);
+    if (!p->isLinked())
+        throw std::invalid_argument("Position is not linked");
+    linkBefore(p, hookOf(elem));
+}
+
+// 在pos之后插入
+template<typename T, IntrusiveHook T::*Hook>
+void IntrusiveList<T, Hook>::insertAfter(T& pos, T& elem) {
+    IntrusiveHook* p = hookOf(pos);
+    if (!p->isLinked())
+        throw std::invalid_argument("Position is not linked");
+    linkBefore(p->next, hookOf(elem));
+}
+
+// 移除并返回首元素
+template<typename T, IntrusiveHook T::*Hook>
+T& IntrusiveList<T, Hook>::pop_front() {
+    if (empty())
+        throw std::out_of_range("List is empty");
+    IntrusiveHook* h = sentinel.next;
+    unlink(h);
+    return *ownerOf(h);
+}
+
+// 移除并返回尾元素
+template<typename T, IntrusiveHook T::*Hook>
+T& IntrusiveList<T, Hook>::pop_back() {
+    if (empty())
+        throw std::out_of_range("List is empty");
+    IntrusiveHook* h = sentinel.prev;
+    unlink(h);
+    return *ownerOf(h);
+}
+
+// 移除指定元素
+template<typename T, IntrusiveHook T::*Hook>
+void IntrusiveList<T, Hook>::remove(T& elem) {
+    IntrusiveHook* h = hookOf(elem);
+    if (!h->isLinked())
+        throw std::invalid_argument("Element is not linked");
+    unlink(h);
+}
+
+// 拼接：把other的首尾整段接到本链表尾部
+template<typename T, IntrusiveHook T::*Hook>
+void IntrusiveList<T, Hook>::splice(IntrusiveList& other) {
+    if (this == &other || other.empty())
+        return;
+    IntrusiveHook* first = other.sentinel.next;
+    IntrusiveHook* last = other.sentinel.prev;
+    first->prev = sentinel.prev;
+    sentinel.prev->next = first;
+    last->next = &sentinel;
+    sentinel.prev = last;
+    length += other.length;
+    other.sentinel.prev = &other.sentinel;
+    other.sentinel.next = &other.sentinel;
+    other.length = 0;
+}
+
+// 获取后继元素
+template<typename T, IntrusiveHook T::*Hook>
+T* IntrusiveList<T, Hook>::next(T& elem) {
+    IntrusiveHook* h = hookOf(elem)->next;
+    if (h == nullptr || h == &sentinel)
+        return nullptr;
+    return ownerOf(h);
+}
+
+// 获取前驱元素
+template<typename T, IntrusiveHook T::*Hook>
+T* IntrusiveList<T, Hook>::prev(T& elem) {
+    IntrusiveHook* h = hookOf(elem)->prev;
+    if (h == nullptr || h == &sentinel)
+        return nullptr;
+    return ownerOf(h);
+}
+
+// 清空链表，逐个解除链接以便元素可再次入链
+template<typename T, IntrusiveHook T::*Hook>
+void IntrusiveList<T, Hook>::clear() {
+    IntrusiveHook* p = sentinel.next;
+    while (p != &sentinel) {
+        IntrusiveHook* next = p->next;
+        p->prev = nullptr;
+        p->next = nullptr;
+        p = next;
+    }
+    sentinel.prev = &sentinel;
+    sentinel.next = &sentinel;
+    length = 0;
+}
+
+// 遍历链表，对每个元素调用visit函数
+template<typename T, IntrusiveHook T::*Hook>
+void IntrusiveList<T, Hook>::traverse(void (*visit)(const T&)) const {
+    IntrusiveHook* p = sentinel.next;
+    while (p != &sentinel) {
+        visit(*ownerOf(p));
+        p = p->next;
+    }
+}
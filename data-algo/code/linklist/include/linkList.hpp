@@ -1,4 +1,6 @@
 #pragma once
+#include "../../common/include/dsCheck.hpp"
+#include "../../trace/include/traceHooks.hpp"
 #include <stdexcept>
 
 /**
@@ -113,11 +115,45 @@ public:
      */
     void remove(int index);
 
+    /**
+     * @brief 不抛异常的读取
+     * @param index 元素索引
+     * @param out 成功时写入元素值
+     * @return 索引有效返回true，越界返回false（out不变）
+     */
+    bool try_get(int index, T& out) const;
+
+    /**
+     * @brief 不检查边界的读取，调用者保证 0 <= index < size()
+     * @param index 元素索引
+     * @return 元素的常量引用
+     */
+    const T& unchecked_get(int index) const;
+
+    /**
+     * @brief 不检查边界的删除，调用者保证 0 <= index < size()
+     * @param index 删除位置
+     */
+    void unchecked_remove(int index);
+
+    /**
+     * @brief 将other的全部节点按原顺序接到本链表头部，不分配内存；需要走到other的尾节点，O(other.size())
+     * @param other 另一个链表，拼接后为空
+     */
+    void splice_front(LinkList& other);
+
     /**
      * @brief 遍历链表，对每个元素调用visit函数
      * @param visit 回调函数，参数为const T&，无返回值
      */
     void traverse(void (*visit)(const T&)) const;
+
+    /**
+     * @brief 遍历链表，对每个元素调用可调用对象（可携带状态，如 lambda）
+     * @param visit 可调用对象，参数为const T&
+     */
+    template<typename F>
+    void forEach(F visit) const;
 };
 
 // ================== 实现部分 ==================
@@ -130,6 +166,7 @@ LinkList<T>::LinkList()
 // 清空链表，释放所有元素节点但保留头结点
 template<typename T>
 void LinkList<T>::clear() {
+    DS_TRACE_SCOPE("LinkList::clear");
     LinkNode<T>* p = head->next;
     while (p != nullptr) {
         LinkNode<T>* next = p->next;
@@ -173,15 +210,34 @@ LinkNode<T>* LinkList<T>::access(int index) const {
 // 获取指定位置的元素值
 template<typename T>
 T LinkList<T>::get(int index) const {
+    LinkNode<T>* p = access(index);
+    DS_CHECK(p != nullptr, std::out_of_range, "Index out of range");
+    return p->data;
+}
+
+// 不抛异常的读取
+template<typename T>
+bool LinkList<T>::try_get(int index, T& out) const {
     LinkNode<T>* p = access(index);
     if (p == nullptr)
-        throw std::out_of_range("Index out of range");
+        return false;
+    out = p->data;
+    return true;
+}
+
+// 不检查边界的读取：直接向后走index步
+template<typename T>
+const T& LinkList<T>::unchecked_get(int index) const {
+    LinkNode<T>* p = head->next;
+    for (int i = 0; i < index; ++i)
+        p = p->next;
     return p->data;
 }
 
 // 查找元素首次出现的位置，未找到返回-1
 template<typename T>
 int LinkList<T>::find(const T& data) const {
+    DS_TRACE_SCOPE("LinkList::find");
     int index = 0;
     LinkNode<T>* p = head->next;
     while (p != nullptr && p->data != data) {
@@ -196,9 +252,9 @@ int LinkList<T>::find(const T& data) const {
 // 在指定位置插入元素
 template<typename T>
 void LinkList<T>::insert(int index, const T& data) {
+    DS_TRACE_SCOPE("LinkList::insert");
     LinkNode<T>* prev_p = access(index - 1);
-    if (prev_p == nullptr)
-        throw std::out_of_range("Index out of range");
+    DS_CHECK(prev_p != nullptr, std::out_of_range, "Index out of range");
     LinkNode<T>* p = new LinkNode<T>(data);
     p->next = prev_p->next;
     prev_p->next = p;
@@ -208,15 +264,38 @@ void LinkList<T>::insert(int index, const T& data) {
 // 删除指定位置的元素
 template<typename T>
 void LinkList<T>::remove(int index) {
-    LinkNode<T>* prev_p = access(index - 1);
-    if (prev_p->next == nullptr)
-        throw std::out_of_range("Index out of range");
+    DS_TRACE_SCOPE("LinkList::remove");
+    DS_CHECK(index >= 0 && index < length, std::out_of_range, "Index out of range");
+    unchecked_remove(index);
+}
+
+// 不检查边界的删除：走到前驱后摘下节点
+template<typename T>
+void LinkList<T>::unchecked_remove(int index) {
+    LinkNode<T>* prev_p = head;
+    for (int i = 0; i < index; ++i)
+        prev_p = prev_p->next;
     LinkNode<T>* p = prev_p->next;
     prev_p->next = p->next;
     delete p;
     --length;
 }
 
+// 头部拼接：other的尾节点接到本链表首元素之前，再把other的首元素挂到头结点后
+template<typename T>
+void LinkList<T>::splice_front(LinkList& other) {
+    if (this == &other || other.head->next == nullptr)
+        return;
+    LinkNode<T>* last = other.head->next;
+    while (last->next != nullptr)
+        last = last->next;
+    last->next = head->next;
+    head->next = other.head->next;
+    length += other.length;
+    other.head->next = nullptr;
+    other.length = 0;
+}
+
 // 遍历链表，对每个元素调用visit函数
 template<typename T>
 void LinkList<T>::traverse(void (*visit)(const T&)) const {
@@ -227,6 +306,15 @@ void LinkList<T>::traverse(void (*visit)(const T&)) const {
     }
 }
 
+// 遍历链表，对每个元素调用可调用对象
+template<typename T>
+template<typename F>
+void LinkList<T>::forEach(F visit) const {
+    for (LinkNode<T>* p = head->next; p != nullptr; p = p->next) {
+        visit(p->data);
+    }
+}
+
 // 拷贝构造函数，深拷贝链表
 template<typename T>
 LinkList<T>::LinkList(const LinkList& other)
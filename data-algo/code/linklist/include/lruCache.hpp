@@ -0,0 +1,240 @@
+#pragma once
+#include "dLinkList.hpp"
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+#include <unordered_map>
+
+/**
+ * @brief LRU（最近最少使用）缓存模板类
+ *
+ * 双向循环链表（DLinkList）按访问顺序保存条目，头部为最近使用、尾部为最久未用；
+ * 哈希索引保存键到链表节点的映射，get/put/erase/淘汰均为 O(1)。
+ * 容量可按条目数和/或字节数限制，任一上限被突破时从尾部淘汰。
+ *
+ * @tparam K 键类型（需可哈希、可比较相等、可默认构造）
+ * @tparam V 值类型（需可默认构造）
+ * @tparam Hash 键的哈希函数，默认为 std::hash<K>
+ */
+template<typename K, typename V, typename Hash = std::hash<K>>
+class LruCache {
+private:
+    /**
+     * @brief 缓存条目
+     */
+    struct Entry {
+        K key;              ///< 键
+        V value;            ///< 值
+        std::size_t bytes;  ///< 该条目计入的字节数
+    };
+
+    DLinkList<Entry> order;                                        ///< 按访问顺序排列的条目
+    std::unordered_map<K, DLinkNode<Entry>*, Hash> index;          ///< 键到链表节点的索引
+    int maxEntries;                                                ///< 条目数上限，0表示不限
+    std::size_t maxBytes;                                          ///< 字节数上限，0表示不限
+    std::size_t usedBytes;                                         ///< 当前已用字节数
+
+    /**
+     * @brief 淘汰尾部条目，直到满足容量上限
+     */
+    void shrink();
+
+public:
+    /**
+     * @brief 构造函数
+     * @param maxEntries 条目数上限，0表示不限
+     * @param maxBytes 字节数上限，0表示不限
+     * @throws std::invalid_argument 如果两个上限均为0或条目数上限为负
+     */
+    explicit LruCache(int maxEntries, std::size_t maxBytes = 0);
+
+    /**
+     * @brief 查找键并将其标记为最近使用
+     * @param key 键
+     * @return 指向值的指针，未命中返回nullptr；指针在下一次修改缓存前有效
+     */
+    V* get(const K& key);
+
+    /**
+     * @brief 判断键是否存在，不改变访问顺序
+     * @param key 键
+     * @return 存在返回true，否则返回false
+     */
+    bool contains(const K& key) const;
+
+    /**
+     * @brief 插入或更新条目并标记为最近使用，必要时淘汰最久未用的条目
+     * @param key 键
+     * @param value 值
+     * @param bytes 该条目计入的字节数，默认为 sizeof(K) + sizeof(V)
+     * @throws std::invalid_argument 如果单个条目超过字节数上限
+     */
+    void put(const K& key, const V& value, std::size_t bytes = sizeof(K) + sizeof(V));
+
+    /**
+     * @brief 删除指定键
+     * @param key 键
+     * @return 删除成功返回true，键不存在返回false
+     */
+    bool erase(const K& key);
+
+    /**
+     * @brief 淘汰最久未用的条目
+     * @return 淘汰成功返回true，缓存为空返回false
+     */
+    bool evict();
+
+    /**
+     * @brief 清空缓存
+     */
+    void clear();
+
+    /**
+     * @brief 获取条目数
+     * @return 条目数
+     */
+    int size() const;
+
+    /**
+     * @brief 获取已用字节数
+     * @return 已用字节数
+     */
+    std::size_t bytes() const;
+
+    /**
+     * @brief 判断缓存是否为空
+     * @return 为空返回true，否则返回false
+     */
+    bool empty() const;
+
+    /**
+     * @brief 从最近使用到最久未用遍历，对每个条目调用visit函数
+     * @param visit 回调函数，参数为键和值
+     */
+    void traverse(void (*visit)(const K&, const V&)) const;
+};
+
+// ================== 实现部分 ==================
+
+// 构造函数
+template<typename K, typename V, typename Hash>
+LruCache<K, V, Hash>::LruCache(int maxEntries, std::size_t maxBytes)
+    : order(), index(), maxEntries(maxEntries), maxBytes(maxBytes), usedBytes(0) {
+    if (maxEntries < 0 || (maxEntries == 0 && maxBytes == 0))
+        throw std::invalid_argument("Cache capacity must be positive");
+    if (maxEntries > 0)
+        index.reserve(maxEntries);
+}
+
+// 淘汰尾部条目，直到满足容量上限
+template<typename K, typename V, typename Hash>
+void LruCache<K, V, Hash>::shrink() {
+    while ((maxEntries > 0 && order.size() > maxEntries)
+           || (maxBytes > 0 && usedBytes > maxBytes)) {
+        evict();
+    }
+}
+
+// 查找并标记为最近使用
+template<typename K, typename V, typename Hash>
+V* LruCache<K, V, Hash>::get(const K& key) {
+    typename std::unordered_map<K, DLinkNode<Entry>*, Hash>::iterator it = index.find(key);
+    if (it == index.end())
+        return nullptr;
+    order.moveToFront(it->second);
+    return &it->second->data.value;
+}
+
+// 判断键是否存在
+template<typename K, typename V, typename Hash>
+bool LruCache<K, V, Hash>::contains(const K& key) const {
+    return index.find(key) != index.end();
+}
+
+// 插入或更新条目
+template<typename K, typename V, typename Hash>
+void LruCache<K, V, Hash>::put(const K& key, const V& value, std::size_t bytes) {
+    if (maxBytes > 0 && bytes > maxBytes)
+        throw std::invalid_argument("Entry larger than cache capacity");
+    typename std::unordered_map<K, DLinkNode<Entry>*, Hash>::iterator it = index.find(key);
+    if (it != index.end()) {
+        Entry& e = it->second->data;
+        usedBytes = usedBytes - e.bytes + bytes;
+        e.value = value;
+        e.bytes = bytes;
+        order.moveToFront(it->second);
+    } else {
+        Entry e;
+        e.key = key;
+        e.value = value;
+        e.bytes = bytes;
+        DLinkNode<Entry>* node = order.push_front(e);
+        try {
+            index.emplace(key, node);
+        } catch (...) {
+            order.erase(node);
+            throw;
+        }
+        usedBytes += bytes;
+    }
+    shrink();
+}
+
+// 删除指定键
+template<typename K, typename V, typename Hash>
+bool LruCache<K, V, Hash>::erase(const K& key) {
+    typename std::unordered_map<K, DLinkNode<Entry>*, Hash>::iterator it = index.find(key);
+    if (it == index.end())
+        return false;
+    usedBytes -= it->second->data.bytes;
+    order.erase(it->second);
+    index.erase(it);
+    return true;
+}
+
+// 淘汰最久未用的条目（链表尾部）
+template<typename K, typename V, typename Hash>
+bool LruCache<K, V, Hash>::evict() {
+    DLinkNode<Entry>* victim = order.backNode();
+    if (victim == nullptr)
+        return false;
+    usedBytes -= victim->data.bytes;
+    index.erase(victim->data.key);
+    order.erase(victim);
+    return true;
+}
+
+// 清空缓存
+template<typename K, typename V, typename Hash>
+void LruCache<K, V, Hash>::clear() {
+    order.clear();
+    index.clear();
+    usedBytes = 0;
+}
+
+// 获取条目数
+template<typename K, typename V, typename Hash>
+int LruCache<K, V, Hash>::size() const {
+    return order.size();
+}
+
+// 获取已用字节数
+template<typename K, typename V, typename Hash>
+std::size_t LruCache<K, V, Hash>::bytes() const {
+    return usedBytes;
+}
+
+// 判断缓存是否为空
+template<typename K, typename V, typename Hash>
+bool LruCache<K, V, Hash>::empty() const {
+    return order.empty();
+}
+
+// 从最近使用到最久未用遍历
+template<typename K, typename V, typename Hash>
+void LruCache<K, V, Hash>::traverse(void (*visit)(const K&, const V&)) const {
+    for (DLinkNode<Entry>* p = order.frontNode(); p != nullptr;
+         p = (p == order.backNode() ? nullptr : p->next)) {
+        visit(p->data.key, p->data.value);
+    }
+}
@@ -0,0 +1,353 @@
+#pragma once
+#include <stdexcept>
+
+/**
+ * @brief 持久化链表节点模板结构体
+ *
+ * 在 LinkNode 的基础上增加引用计数，节点一经创建便不再修改，
+ * 多个链表版本可以安全地共享同一段尾部。
+ *
+ * @tparam T 节点存储的数据类型
+ */
+template<typename T>
+struct PersistentNode {
+    const T data;                 ///< 节点存储的数据（只读）
+    PersistentNode<T>* next;      ///< 指向下一个节点的指针
+    int refCount;                 ///< 引用计数（持有该节点的链表版本与前驱节点数）
+
+    /**
+     * @brief 构造函数
+     * @param x 节点数据
+     * @param n 后继节点（调用者已为其增加引用计数）
+     */
+    PersistentNode(const T& x, PersistentNode<T>* n) : data(x), next(n), refCount(1) {}
+};
+
+/**
+ * @brief 持久化（结构共享）单链表模板类
+ *
+ * 所有节点只读并带引用计数，拷贝链表只需复制头指针并增加一次计数，
+ * 在副本上头插/头删也只影响该副本，其余版本保持不变。
+ * 适合需要频繁保存快照（撤销栈、解析器状态等）的场景。
+ *
+ * 注意：引用计数为普通整型，同一组共享节点不可跨线程并发修改。
+ *
+ * @tparam T 链表存储的数据类型
+ */
+template<typename T>
+class PersistentList {
+private:
+    PersistentNode<T>* head;   ///< 首元素节点指针（不带头结点，空表为nullptr）
+    int length;                ///< 链表长度（元素个数）
+
+    /**
+     * @brief 增加节点引用计数
+     * @param p 节点指针，可为nullptr
+     * @return 传入的节点指针
+     */
+    static PersistentNode<T>* acquire(PersistentNode<T>* p);
+
+    /**
+     * @brief 释放一次对节点的引用，计数归零时沿链表逐个回收
+     * @param p 节点指针，可为nullptr
+     */
+    static void release(PersistentNode<T>* p);
+
+    /**
+     * @brief 由已持有引用的节点直接构造链表
+     * @param node 首元素节点（所有权转移给新链表）
+     * @param length 链表长度
+     */
+    PersistentList(PersistentNode<T>* node, int length);
+
+public:
+    /**
+     * @brief 构造函数，初始化空链表
+     */
+    PersistentList();
+
+    /**
+     * @brief 拷贝构造函数，与原链表共享全部节点，O(1)
+     * @param other 被拷贝的链表
+     */
+    PersistentList(const PersistentList& other);
+
+    /**
+     * @brief 移动构造函数，O(1)
+     * @param other 被移动的链表，移动后为空表
+     */
+    PersistentList(PersistentList&& other) noexcept;
+
+    /**
+     * @brief 赋值操作符重载，与原链表共享全部节点，O(1)
+     * @param other 被赋值的链表
+     * @return 当前对象的引用
+     */
+    PersistentList& operator=(const PersistentList& other);
+
+    /**
+     * @brief 移动赋值操作符，O(1)
+     * @param other 被移动的链表，移动后为空表
+     * @return 当前对象的引用
+     */
+    PersistentList& operator=(PersistentList&& other) noexcept;
+
+    /**
+     * @brief 析构函数，释放本版本对节点的引用
+     */
+    ~PersistentList();
+
+    /**
+     * @brief 清空当前版本，不影响共享节点的其他版本
+     */
+    void clear();
+
+    /**
+     * @brief 判断链表是否为空
+     * @return 为空返回true，否则返回false
+     */
+    bool empty() const;
+
+    /**
+     * @brief 获取链表长度
+     * @return 链表中元素个数
+     */
+    int size() const;
+
+    /**
+     * @brief 获取首元素
+     * @return 首元素的常量引用
+     * @throws std::out_of_range 如果链表为空
+     */
+    const T& front() const;
+
+    /**
+     * @brief 获取指定位置的元素
+     * @param index 元素索引（0为第一个元素）
+     * @return 指定位置的元素值
+     * @throws std::out_of_range 如果索引越界
+     */
+    T get(int index) const;
+
+    /**
+     * @brief 查找元素首次出现的位置
+     * @param data 要查找的元素值
+     * @return 元素索引，未找到返回-1
+     */
+    int find(const T& data) const;
+
+    /**
+     * @brief 在当前版本头部插入元素，O(1)
+     * @param data 插入的元素值
+     * @throws std::bad_alloc 内存分配失败
+     */
+    void push_front(const T& data);
+
+    /**
+     * @brief 删除当前版本的首元素，O(1)
+     * @throws std::out_of_range 如果链表为空
+     */
+    void pop_front();
+
+    /**
+     * @brief 生成在头部追加元素后的新版本，当前版本不变，O(1)
+     * @param data 插入的元素值
+     * @return 新版本链表
+     */
+    PersistentList prepend(const T& data) const;
+
+    /**
+     * @brief 生成去掉首元素后的新版本，当前版本不变，O(1)
+     * @return 新版本链表
+     * @throws std::out_of_range 如果链表为空
+     */
+    PersistentList rest() const;
+
+    /**
+     * @brief 判断两个版本是否共享同一个首节点
+     * @param other 另一个版本
+     * @return 共享返回true，否则返回false
+     */
+    bool sharesWith(const PersistentList& other) const;
+
+    /**
+     * @brief 遍历链表，对每个元素调用visit函数
+     * @param visit 回调函数，参数为const T&，无返回值
+     */
+    void traverse(void (*visit)(const T&)) const;
+};
+
+// ================== 实现部分 ==================
+
+// 增加节点引用计数
+template<typename T>
+PersistentNode<T>* PersistentList<T>::acquire(PersistentNode<T>* p) {
+    if (p != nullptr)
+        ++p->refCount;
+    return p;
+}
+
+// 释放引用，计数归零的节点被删除并继续释放其后继（迭代实现，避免长链递归爆栈）
+template<typename T>
+void PersistentList<T>::release(PersistentNode<T>* p) {
+    while (p != nullptr && --p->refCount == 0) {
+        PersistentNode<T>* next = p->next;
+        delete p;
+        p = next;
+    }
+}
+
+// 由已持有引用的节点直接构造链表
+template<typename T>
+PersistentList<T>::PersistentList(PersistentNode<T>* node, int length)
+    : head(node), length(length) {}
+
+// 构造函数，初始化空链表
+template<typename T>
+PersistentList<T>::PersistentList()
+    : head(nullptr), length(0) {}
+
+// 拷贝构造函数，共享节点
+template<typename T>
+PersistentList<T>::PersistentList(const PersistentList& other)
+    : head(acquire(other.head)), length(other.length) {}
+
+// 移动构造函数
+template<typename T>
+PersistentList<T>::PersistentList(PersistentList&& other) noexcept
+    : head(other.head), length(other.length) {
+    other.head = nullptr;
+    other.length = 0;
+}
+
+// 赋值操作符重载，先增加新引用再释放旧引用，自赋值安全
+template<typename T>
+PersistentList<T>& PersistentList<T>::operator=(const PersistentList& other) {
+    PersistentNode<T>* old = head;
+    head = acquire(other.head);
+    length = other.length;
+    release(old);
+    return *this;
+}
+
+// 移动赋值操作符
+template<typename T>
+PersistentList<T>& PersistentList<T>::operator=(PersistentList&& other) noexcept {
+    if (this != &other) {
+        release(head);
+        head = other.head;
+        length = other.length;
+        other.head = nullptr;
+        other.length = 0;
+    }
+    return *this;
+}
+
+// 析构函数，释放引用
+template<typename T>
+PersistentList<T>::~PersistentList() {
+    release(head);
+}
+
+// 清空当前版本
+template<typename T>
+void PersistentList<T>::clear() {
+    release(head);
+    head = nullptr;
+    length = 0;
+}
+
+// 判断链表是否为空
+template<typename T>
+bool PersistentList<T>::empty() const {
+    return length == 0;
+}
+
+// 获取链表长度
+template<typename T>
+int PersistentList<T>::size() const {
+    return length;
+}
+
+// 获取首元素
+template<typename T>
+const T& PersistentList<T>::front() const {
+    if (head == nullptr)
+        throw std::out_of_range("List is empty");
+    return head->data;
+}
+
+// 获取指定位置的元素值
+template<typename T>
+T PersistentList<T>::get(int index) const {
+    if (index < 0 || index >= length)
+        throw std::out_of_range("Index out of range");
+    PersistentNode<T>* p = head;
+    for (int i = 0; i < index; ++i)
+        p = p->next;
+    return p->data;
+}
+
+// 查找元素首次出现的位置，未找到返回-1
+template<typename T>
+int PersistentList<T>::find(const T& data) const {
+    int index = 0;
+    PersistentNode<T>* p = head;
+    while (p != nullptr && p->data != data) {
+        p = p->next;
+        ++index;
+    }
+    if (p == nullptr)
+        return -1;
+    return index;
+}
+
+// 头部插入，新节点接管当前版本对旧首节点的引用
+template<typename T>
+void PersistentList<T>::push_front(const T& data) {
+    head = new PersistentNode<T>(data, head);
+    ++length;
+}
+
+// 删除首元素，只释放当前版本的引用，共享的节点仍由其他版本持有
+template<typename T>
+void PersistentList<T>::pop_front() {
+    if (head == nullptr)
+        throw std::out_of_range("List is empty");
+    PersistentNode<T>* old = head;
+    head = acquire(old->next);
+    --length;
+    release(old);
+}
+
+// 生成头部追加元素后的新版本：节点构造成功后才为共享的尾部增加引用，T 的拷贝构造抛出异常时不泄漏
+template<typename T>
+PersistentList<T> PersistentList<T>::prepend(const T& data) const {
+    PersistentNode<T>* node = new PersistentNode<T>(data, head);
+    acquire(head);
+    return PersistentList(node, length + 1);
+}
+
+// 生成去掉首元素后的新版本
+template<typename T>
+PersistentList<T> PersistentList<T>::rest() const {
+    if (head == nullptr)
+        throw std::out_of_range("List is empty");
+    return PersistentList(acquire(head->next), length - 1);
+}
+
+// 判断两个版本是否共享同一个首节点
+template<typename T>
+bool PersistentList<T>::sharesWith(const PersistentList& other) const {
+    return head != nullptr && head == other.head;
+}
+
+// 遍历链表，对每个元素调用visit函数
+template<typename T>
+void PersistentList<T>::traverse(void (*visit)(const T&)) const {
+    PersistentNode<T>* p = head;
+    while (p != nullptr) {
+        visit(p->data);
+        p = p->next;
+    }
+}
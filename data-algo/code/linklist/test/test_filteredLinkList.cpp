@@ -0,0 +1,195 @@
+#include "../include/filteredLinkList.hpp"
+#include "../include/linkList.hpp"
+#include <chrono>
+#include <iostream>
+#include <limits>
+#include <string>
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+void printMenu() {
+    std::cout << "\n====== 带布隆过滤器的单链表交互测试菜单 ======\n";
+    std::cout << "命令列表：\n";
+    std::cout << "  insert <位置> <值>       : 在指定位置插入元素\n";
+    std::cout << "  push <值>                : 在尾部插入元素\n";
+    std::cout << "  remove <位置>            : 删除指定位置的元素\n";
+    std::cout << "  find <值>                : 查找元素位置（先查过滤器）\n";
+    std::cout << "  print                    : 打印链表（最多前200个）\n";
+    std::cout << "  stats                    : 长度、过期数、重建次数与过滤器状态\n";
+    std::cout << "  rebuild                  : 立即重建过滤器\n";
+    std::cout << "  clear                    : 清空链表\n";
+    std::cout << "  fpr <元素数> <误判率>     : 按参数构造 BloomFilter，实测误判率\n";
+    std::cout << "  bench <元素数> <查询数>   : 查询多数落空时与 LinkList::find 对比\n";
+    std::cout << "  help                     : 显示菜单\n";
+    std::cout << "  exit / 0                 : 退出程序\n";
+    std::cout << "-----------------------------------\n";
+    std::cout << "请输入命令: ";
+}
+
+void clearInput() {
+    std::cin.clear();
+    std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+}
+
+// 计时工具：执行f并返回耗时（毫秒）
+template<typename F>
+double timeIt(F f) {
+    auto start = std::chrono::steady_clock::now();
+    f();
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+void printStats(const FilteredLinkList<int>& list) {
+    const BloomFilter<int>& f = list.bloom();
+    std::cout << "长度: " << list.size() << "，过期数: " << list.staleCount() << "，重建次数: " << list.rebuilds()
+              << "\n过滤器: 预期容量 " << f.capacity() << "，已加入 " << f.count() << "，" << f.bytes()
+              << " 字节，k=" << f.hashes() << "，填充率 " << f.fillRatio() << "\n";
+}
+
+// 加入 0..n-1 的偶数，再查询奇数（必然不存在），统计误判比例
+void measureFpr(int n, double rate) {
+    BloomFilter<int> f(n, rate);
+    for (int i = 0; i < n; ++i) f.add(2 * i);
+    int missed = 0, falsePositive = 0;
+    for (int i = 0; i < n; ++i) {
+        if (!f.mayContain(2 * i)) ++missed;
+    }
+    const int probes = 1000000;
+    for (int i = 0; i < probes; ++i) {
+        if (f.mayContain(2 * i + 1)) ++falsePositive;
+    }
+    std::cout << "  " << n << " 个元素，目标误判率 " << rate << "，" << f.bytes() << " 字节，k=" << f.hashes()
+              << "\n  实测误判率 " << static_cast<double>(falsePositive) / probes << "，漏判 " << missed
+              << " 个（应为0）\n";
+}
+
+// 链表中放 n 个偶数，查询 q 次：九成查奇数（落空），一成查存在的偶数
+void bench(int n, int q) {
+    LinkList<int> plain;
+    FilteredLinkList<int> filtered;
+    for (int i = 0; i < n; ++i) {
+        plain.insert(0, 2 * i);
+        filtered.insert(0, 2 * i);
+    }
+    long long s1 = 0, s2 = 0;
+    unsigned seed = 12345;
+    double tPlain = timeIt([&]() {
+        unsigned x = seed;
+        for (int i = 0; i < q; ++i) {
+            x = x * 1103515245u + 12345u;
+            int v = static_cast<int>((x >> 8) % static_cast<unsigned>(n)) * 2 + (i % 10 != 0 ? 1 : 0);
+            s1 += plain.find(v);
+        }
+    });
+    double tFiltered = timeIt([&]() {
+        unsigned x = seed;
+        for (int i = 0; i < q; ++i) {
+            x = x * 1103515245u + 12345u;
+            int v = static_cast<int>((x >> 8) % static_cast<unsigned>(n)) * 2 + (i % 10 != 0 ? 1 : 0);
+            s2 += filtered.find(v);
+        }
+    });
+    std::cout << "  " << n << " 个元素，" << q << " 次查询（90% 落空）\n";
+    std::cout << "  LinkList::find: " << tPlain << " ms，FilteredLinkList::find: " << tFiltered << " ms"
+              << (s1 == s2 ? "" : "（结果不一致！）") << "\n";
+    std::cout << "  过滤器占用 " << filtered.bloom().bytes() << " 字节\n";
+}
+
+int main() {
+#ifdef _WIN32
+    SetConsoleOutputCP(CP_UTF8);
+    SetConsoleCP(CP_UTF8);
+#endif
+    FilteredLinkList<int> list;
+    std::string cmd;
+    printMenu();
+    while (true) {
+        std::cout << "> ";
+        if (!(std::cin >> cmd)) break;
+        try {
+            if (cmd == "insert") {
+                int index, v;
+                if (!(std::cin >> index >> v)) {
+                    std::cout << "输入有误。用法: insert <位置> <值>\n";
+                    clearInput();
+                    continue;
+                }
+                list.insert(index, v);
+                std::cout << "已在位置 " << index << " 插入 " << v << "。\n";
+            } else if (cmd == "push") {
+                int v;
+                if (!(std::cin >> v)) {
+                    std::cout << "输入有误。用法: push <值>\n";
+                    clearInput();
+                    continue;
+                }
+                list.insert(list.size(), v);
+                std::cout << "已在尾部插入 " << v << "。\n";
+            } else if (cmd == "remove") {
+                int index;
+                if (!(std::cin >> index)) {
+                    std::cout << "输入有误。用法: remove <位置>\n";
+                    clearInput();
+                    continue;
+                }
+                list.remove(index);
+                std::cout << "已删除位置 " << index << " 的元素，过期数: " << list.staleCount() << "\n";
+            } else if (cmd == "find") {
+                int v;
+                if (!(std::cin >> v)) {
+                    std::cout << "输入有误。用法: find <值>\n";
+                    clearInput();
+                    continue;
+                }
+                bool maybe = list.bloom().mayContain(v);
+                int index = list.find(v);
+                std::cout << "过滤器: " << (maybe ? "可能存在" : "一定不存在") << "，"
+                          << (index >= 0 ? "位置 " + std::to_string(index) : std::string("未找到")) << "\n";
+            } else if (cmd == "print") {
+                int shown = 0;
+                list.forEach([&](const int& v) {
+                    if (shown++ < 200) std::cout << v << " ";
+                });
+                std::cout << (list.size() > 200 ? "...\n" : "\n");
+            } else if (cmd == "stats") {
+                printStats(list);
+            } else if (cmd == "rebuild") {
+                list.rebuild();
+                printStats(list);
+            } else if (cmd == "clear") {
+                list.clear();
+                std::cout << "已清空。\n";
+            } else if (cmd == "fpr") {
+                int n;
+                double rate;
+                if (!(std::cin >> n >> rate) || n <= 0) {
+                    std::cout << "输入有误。用法: fpr <元素数> <误判率>\n";
+                    clearInput();
+                    continue;
+                }
+                measureFpr(n, rate);
+            } else if (cmd == "bench") {
+                int n, q;
+                if (!(std::cin >> n >> q) || n <= 0 || q < 0) {
+                    std::cout << "输入有误。用法: bench <元素数> <查询数>\n";
+                    clearInput();
+                    continue;
+                }
+                bench(n, q);
+            } else if (cmd == "help") {
+                printMenu();
+            } else if (cmd == "exit" || cmd == "0") {
+                std::cout << "程序结束，再见！\n";
+                break;
+            } else {
+                std::cout << "未知命令。输入 help 查看菜单。\n";
+            }
+        } catch (const std::exception& e) {
+            std::cout << "错误: " << e.what() << "\n";
+        }
+        clearInput();
+    }
+    return 0;
+}
@@ -0,0 +1,137 @@
+#include "../include/intrusiveList.hpp"
+#include <iostream>
+#include <string>
+#include <limits>
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+// 对象池中的元素：hook 用于链表 A/B，tagHook 用于标记链表 T，同一元素可同时在 A(或B) 与 T 中
+struct Item {
+    int id;
+    IntrusiveHook hook;
+    IntrusiveHook tagHook;
+};
+
+typedef IntrusiveList<Item, &Item::hook> ItemList;
+typedef IntrusiveList<Item, &Item::tagHook> TagList;
+
+const int POOL_SIZE = 10;
+
+void printMenu() {
+    std::cout << "\n====== 侵入式链表交互测试菜单 ======\n";
+    std::cout << "对象池中共有 " << POOL_SIZE << " 个元素，编号 0~" << POOL_SIZE - 1 << "。\n";
+    std::cout << "链表 A、B 共用同一个挂钩，链表 T 使用另一个挂钩。\n";
+    std::cout << "命令列表：\n";
+    std::cout << "  pushfront <表> <编号>  : 在表头插入元素（表为 A/B/T）\n";
+    std::cout << "  pushback <表> <编号>   : 在表尾插入元素\n";
+    std::cout << "  popfront <表>          : 移除表头元素\n";
+    std::cout << "  popback <表>           : 移除表尾元素\n";
+    std::cout << "  remove <表> <编号>     : 移除指定元素（O(1)）\n";
+    std::cout << "  splice                 : 将 B 整体拼接到 A 尾部（O(1)）\n";
+    std::cout << "  clear <表>             : 清空链表\n";
+    std::cout << "  print                  : 打印所有链表\n";
+    std::cout << "  help                   : 显示菜单\n";
+    std::cout << "  exit / 0               : 退出程序\n";
+    std::cout << "-----------------------------------\n";
+    std::cout << "请输入命令: ";
+}
+
+template<typename List>
+void printList(const char* name, const List& list) {
+    std::cout << "链表 " << name << "（" << list.size() << " 个）: ";
+    auto printElem = [](const Item& x) { std::cout << x.id << " "; };
+    list.traverse(printElem);
+    std::cout << std::endl;
+}
+
+// 对指定链表执行一条命令，A/B/T 类型不同，因此写成模板
+template<typename List>
+void apply(const std::string& cmd, List& list, Item* pool, int id) {
+    if (cmd == "pushfront") {
+        list.push_front(pool[id]);
+        std::cout << "已在表头插入元素 " << id << "。\n";
+    } else if (cmd == "pushback") {
+        list.push_back(pool[id]);
+        std::cout << "已在表尾插入元素 " << id << "。\n";
+    } else if (cmd == "popfront") {
+        std::cout << "已移除表头元素 " << list.pop_front().id << "。\n";
+    } else if (cmd == "popback") {
+        std::cout << "已移除表尾元素 " << list.pop_back().id << "。\n";
+    } else if (cmd == "remove") {
+        list.remove(pool[id]);
+        std::cout << "已移除元素 " << id << "。\n";
+    } else if (cmd == "clear") {
+        list.clear();
+        std::cout << "链表已清空。\n";
+    }
+}
+
+void clearInput() {
+    std::cin.clear();
+    std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+}
+
+int main() {
+#ifdef _WIN32
+    // 设置 Windows 控制台为 UTF-8，防止中文输出乱码
+    SetConsoleOutputCP(CP_UTF8);
+    SetConsoleCP(CP_UTF8);
+#endif
+    Item pool[POOL_SIZE];
+    for (int i = 0; i < POOL_SIZE; ++i)
+        pool[i].id = i;
+    ItemList a, b;
+    TagList t;
+
+    std::string cmd;
+    printMenu();
+    while (true) {
+        std::cout << "> ";
+        if (!(std::cin >> cmd)) break;
+        if (cmd == "pushfront" || cmd == "pushback" || cmd == "remove"
+            || cmd == "popfront" || cmd == "popback" || cmd == "clear") {
+            std::string name;
+            int id = 0;
+            bool needId = (cmd == "pushfront" || cmd == "pushback" || cmd == "remove");
+            if (!(std::cin >> name) || (needId && !(std::cin >> id))) {
+                std::cout << "输入有误。用法: " << cmd << (needId ? " <表> <编号>\n" : " <表>\n");
+                clearInput();
+                continue;
+            }
+            if (id < 0 || id >= POOL_SIZE) {
+                std::cout << "错误: 元素编号越界。\n";
+                clearInput();
+                continue;
+            }
+            try {
+                if (name == "A")
+                    apply(cmd, a, pool, id);
+                else if (name == "B")
+                    apply(cmd, b, pool, id);
+                else if (name == "T")
+                    apply(cmd, t, pool, id);
+                else
+                    std::cout << "错误: 链表名只能是 A、B 或 T。\n";
+            } catch (const std::exception& e) {
+                std::cout << "错误: " << e.what() << "\n";
+            }
+        } else if (cmd == "splice") {
+            a.splice(b);
+            std::cout << "已将 B 拼接到 A 尾部。\n";
+        } else if (cmd == "print") {
+            printList("A", a);
+            printList("B", b);
+            printList("T", t);
+        } else if (cmd == "help") {
+            printMenu();
+        } else if (cmd == "exit" || cmd == "0") {
+            std::cout << "程序结束，再见！\n";
+            break;
+        } else {
+            std::cout << "未知命令。输入 help 查看菜单。\n";
+        }
+        clearInput();
+    }
+    return 0;
+}
@@ -12,6 +12,7 @@ void printMenu() {
     std::cout << "  insert <下标> <值>   : 在下标插入值\n";
     std::cout << "  remove <下标>        : 删除指定下标的元素\n";
     std::cout << "  get <下标>           : 获取指定下标的值\n";
+    std::cout << "  tryget <下标>        : 不抛异常的读取（try_get）\n";
     std::cout << "  find <值>            : 查找值，返回下标\n";
     std::cout << "  clear                : 清空链表\n";
     std::cout << "  size                 : 当前元素个数\n";
@@ -88,6 +89,18 @@ int main() {
             } catch (const std::exception& e) {
                 std::cout << "错误: " << e.what() << "\n";
             }
+        } else if (cmd == "tryget") {
+            int idx;
+            if (!(std::cin >> idx)) {
+                std::cout << "输入有误。用法: tryget <下标>\n";
+                clearInput();
+                continue;
+            }
+            int val = 0;
+            if (list.try_get(idx, val))
+                std::cout << "下标 " << idx << " 的值为: " << val << "\n";
+            else
+                std::cout << "下标 " << idx << " 越界，try_get 返回 false。\n";
         } else if (cmd == "find") {
             int val;
             if (!(std::cin >> val)) {
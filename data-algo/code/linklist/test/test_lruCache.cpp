@@ -0,0 +1,118 @@
+#include "../include/lruCache.hpp"
+#include <iostream>
+#include <string>
+#include <limits>
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+void printMenu() {
+    std::cout << "\n====== LRU 缓存交互测试菜单 ======\n";
+    std::cout << "命令列表：\n";
+    std::cout << "  put <键> <值> [字节数] : 插入或更新条目\n";
+    std::cout << "  get <键>               : 查询条目（命中后移到最近使用）\n";
+    std::cout << "  erase <键>             : 删除条目\n";
+    std::cout << "  evict                  : 淘汰最久未用的条目\n";
+    std::cout << "  clear                  : 清空缓存\n";
+    std::cout << "  size                   : 条目数与已用字节数\n";
+    std::cout << "  print                  : 从最近到最久打印缓存\n";
+    std::cout << "  help                   : 显示菜单\n";
+    std::cout << "  exit / 0               : 退出程序\n";
+    std::cout << "-----------------------------------\n";
+    std::cout << "请输入命令: ";
+}
+
+void clearInput() {
+    std::cin.clear();
+    std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+}
+
+int main() {
+#ifdef _WIN32
+    // 设置 Windows 控制台为 UTF-8，防止中文输出乱码
+    SetConsoleOutputCP(CP_UTF8);
+    SetConsoleCP(CP_UTF8);
+#endif
+    int maxEntries;
+    std::cout << "请输入条目数上限（0表示不限）: ";
+    while (!(std::cin >> maxEntries) || maxEntries < 0) {
+        std::cout << "输入无效，请输入非负整数: ";
+        clearInput();
+    }
+    long long maxBytes;
+    std::cout << "请输入字节数上限（0表示不限）: ";
+    while (!(std::cin >> maxBytes) || maxBytes < 0 || (maxBytes == 0 && maxEntries == 0)) {
+        std::cout << "输入无效，两个上限不能同时为0: ";
+        clearInput();
+    }
+    LruCache<int, std::string> cache(maxEntries, static_cast<std::size_t>(maxBytes));
+
+    std::string cmd;
+    printMenu();
+    while (true) {
+        std::cout << "> ";
+        if (!(std::cin >> cmd)) break;
+        if (cmd == "put") {
+            int key;
+            std::string val;
+            if (!(std::cin >> key >> val)) {
+                std::cout << "输入有误。用法: put <键> <值> [字节数]\n";
+                clearInput();
+                continue;
+            }
+            std::size_t bytes = val.size();
+            std::string rest;
+            std::getline(std::cin, rest);
+            if (rest.find_first_not_of(" \t\r") != std::string::npos)
+                bytes = static_cast<std::size_t>(std::stoull(rest));
+            try {
+                cache.put(key, val, bytes);
+                std::cout << "已写入 " << key << " -> " << val << "（" << bytes << " 字节）。\n";
+            } catch (const std::exception& e) {
+                std::cout << "错误: " << e.what() << "\n";
+            }
+            continue;
+        } else if (cmd == "get") {
+            int key;
+            if (!(std::cin >> key)) {
+                std::cout << "输入有误。用法: get <键>\n";
+                clearInput();
+                continue;
+            }
+            std::string* val = cache.get(key);
+            if (val == nullptr)
+                std::cout << "未命中键 " << key << "。\n";
+            else
+                std::cout << "命中 " << key << " -> " << *val << "\n";
+        } else if (cmd == "erase") {
+            int key;
+            if (!(std::cin >> key)) {
+                std::cout << "输入有误。用法: erase <键>\n";
+                clearInput();
+                continue;
+            }
+            std::cout << (cache.erase(key) ? "已删除。" : "键不存在。") << "\n";
+        } else if (cmd == "evict") {
+            std::cout << (cache.evict() ? "已淘汰最久未用的条目。" : "缓存为空。") << "\n";
+        } else if (cmd == "clear") {
+            cache.clear();
+            std::cout << "缓存已清空。\n";
+        } else if (cmd == "size") {
+            std::cout << "条目数: " << cache.size() << "，已用字节数: " << cache.bytes() << "\n";
+        } else if (cmd == "print") {
+            std::cout << "缓存内容（最近 -> 最久）: ";
+            auto printEntry = [](const int& k, const std::string& v) { std::cout << k << ":" << v << " "; };
+            cache.traverse(printEntry);
+            std::cout << std::endl;
+        } else if (cmd == "help") {
+            printMenu();
+        } else if (cmd == "exit" || cmd == "0") {
+            std::cout << "程序结束，再见！\n";
+            break;
+        } else {
+            std::cout << "未知命令。输入 help 查看菜单。\n";
+        }
+        clearInput();
+    }
+    return 0;
+}
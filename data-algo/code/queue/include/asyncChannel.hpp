@@ -0,0 +1,230 @@
+#pragma once
+#include "queue.hpp"
+#include "executor.hpp"
+#include <coroutine>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+
+/**
+ * @brief 有界异步通道，连接以 C++20 协程编写的流水线各级
+ *
+ * 缓冲区、等待发送者与等待接收者都基于 Queue 实现，按 FIFO 顺序服务。
+ * - `co_await ch.send(x)`：缓冲区未满时立即返回，否则挂起，直到有接收者取走数据
+ * - `co_await ch.recv()`：有数据时立即返回，否则挂起，直到有发送者写入或通道关闭
+ * 被唤醒的协程交给构造时指定的执行器恢复，不会在唤醒方的调用栈上运行，也不轮询。
+ *
+ * 关闭语义：close() 之后 send 立即返回 false，数据被丢弃；
+ * recv 先取完缓冲区中剩余的数据，之后返回空的 std::optional 表示 EOF。
+ * 关闭时所有挂起的发送者和接收者都会被唤醒。
+ *
+ * 通道对象本身线程安全，可供线程池执行器上的多个协程同时使用。
+ *
+ * @tparam T 元素类型（需可默认构造、可拷贝）
+ */
+template<typename T>
+class AsyncChannel {
+public:
+    class SendAwaiter;
+    class RecvAwaiter;
+
+private:
+    Executor& executor;                 ///< 恢复等待协程的执行器
+    int cap;                            ///< 缓冲区容量，0 表示无缓冲（发送与接收直接交接）
+    Queue<T> buffer;                    ///< 已发送、尚未接收的数据
+    Queue<SendAwaiter*> senders;        ///< 因缓冲区已满而挂起的发送者
+    Queue<RecvAwaiter*> receivers;      ///< 因无数据而挂起的接收者
+    bool closed;                        ///< 是否已关闭
+    mutable std::mutex mutex;           ///< 保护以上状态
+
+public:
+    /**
+     * @brief 发送操作的等待体，由 send() 返回，co_await 结果为是否发送成功
+     */
+    class SendAwaiter {
+    public:
+        bool await_ready() const noexcept { return false; }
+        bool await_suspend(std::coroutine_handle<> h);
+        bool await_resume() const noexcept { return sent; }
+
+    private:
+        friend class AsyncChannel;
+        SendAwaiter(AsyncChannel& ch, const T& v) : channel(ch), value(v), sent(false) {}
+
+        AsyncChannel& channel;
+        T value;                            ///< 待发送的数据
+        bool sent;                          ///< 是否已被通道接收
+        std::coroutine_handle<> handle;     ///< 挂起的发送协程
+    };
+
+    /**
+     * @brief 接收操作的等待体，由 recv() 返回，co_await 结果为数据，EOF 时为空
+     */
+    class RecvAwaiter {
+    public:
+        bool await_ready() const noexcept { return false; }
+        bool await_suspend(std::coroutine_handle<> h);
+        std::optional<T> await_resume() { return std::move(result); }
+
+    private:
+        friend class AsyncChannel;
+        explicit RecvAwaiter(AsyncChannel& ch) : channel(ch) {}
+
+        AsyncChannel& channel;
+        std::optional<T> result;            ///< 接收到的数据
+        std::coroutine_handle<> handle;     ///< 挂起的接收协程
+    };
+
+    /**
+     * @brief 构造函数
+     * @param executor 恢复等待协程的执行器，生命周期需长于通道
+     * @param capacity 缓冲区容量，0 表示无缓冲通道
+     * @throws std::invalid_argument 如果容量为负
+     */
+    AsyncChannel(Executor& executor, int capacity);
+
+    /**
+     * @brief 析构函数。销毁前应先关闭通道并让等待的协程运行结束
+     */
+    ~AsyncChannel();
+
+    AsyncChannel(const AsyncChannel&) = delete;
+    AsyncChannel& operator=(const AsyncChannel&) = delete;
+
+    /**
+     * @brief 发送数据，用法 `bool ok = co_await ch.send(x);`
+     * @param value 数据
+     * @return 等待体，结果为 true 表示已发送，false 表示通道已关闭
+     */
+    SendAwaiter send(const T& value) { return SendAwaiter(*this, value); }
+
+    /**
+     * @brief 接收数据，用法 `std::optional<T> v = co_await ch.recv();`
+     * @return 等待体，结果为空表示通道已关闭且缓冲区已取完
+     */
+    RecvAwaiter recv() { return RecvAwaiter(*this); }
+
+    /**
+     * @brief 关闭通道并唤醒所有等待者，重复关闭无副作用
+     */
+    void close();
+
+    /**
+     * @brief 判断通道是否已关闭
+     * @return 已关闭返回true
+     */
+    bool isClosed() const;
+
+    /**
+     * @brief 获取缓冲区中的数据个数
+     * @return 数据个数
+     */
+    int size() const;
+
+    /**
+     * @brief 获取缓冲区容量
+     * @return 容量
+     */
+    int capacity() const { return cap; }
+};
+
+// ================== 实现部分 ==================
+
+// 构造函数，检查容量
+template<typename T>
+AsyncChannel<T>::AsyncChannel(Executor& executor, int capacity)
+    : executor(executor), cap(capacity), closed(false) {
+    if (capacity < 0)
+        throw std::invalid_argument("AsyncChannel capacity must be non-negative");
+}
+
+// 析构函数，等待者由协程帧持有，这里无需释放
+template<typename T>
+AsyncChannel<T>::~AsyncChannel() {}
+
+// 发送：优先直接交给等待的接收者，其次写入缓冲区，都不行时挂起排队
+template<typename T>
+bool AsyncChannel<T>::SendAwaiter::await_suspend(std::coroutine_handle<> h) {
+    std::lock_guard<std::mutex> lock(channel.mutex);
+    if (channel.closed)
+        return false;
+    if (!channel.receivers.empty()) {
+        // 有接收者在等，缓冲区必为空，直接交接
+        RecvAwaiter* receiver = channel.receivers.peek();
+        channel.receivers.pop();
+        receiver->result = value;
+        sent = true;
+        channel.executor.post(receiver->handle);
+        return false;
+    }
+    if (channel.buffer.size() < channel.cap) {
+        channel.buffer.push(value);
+        sent = true;
+        return false;
+    }
+    handle = h;
+    channel.senders.push(this);
+    return true;
+}
+
+// 接收：优先取缓冲区，并把一个等待的发送者补进缓冲区；无缓冲时直接从发送者取
+template<typename T>
+bool AsyncChannel<T>::RecvAwaiter::await_suspend(std::coroutine_handle<> h) {
+    std::lock_guard<std::mutex> lock(channel.mutex);
+    if (!channel.buffer.empty()) {
+        result = channel.buffer.peek();
+        channel.buffer.pop();
+        if (!channel.senders.empty()) {
+            SendAwaiter* sender = channel.senders.peek();
+            channel.senders.pop();
+            channel.buffer.push(sender->value);
+            sender->sent = true;
+            channel.executor.post(sender->handle);
+        }
+        return false;
+    }
+    if (!channel.senders.empty()) {
+        SendAwaiter* sender = channel.senders.peek();
+        channel.senders.pop();
+        result = sender->value;
+        sender->sent = true;
+        channel.executor.post(sender->handle);
+        return false;
+    }
+    if (channel.closed)
+        return false;
+    handle = h;
+    channel.receivers.push(this);
+    return true;
+}
+
+// 关闭：挂起的发送者以失败返回，挂起的接收者收到 EOF
+template<typename T>
+void AsyncChannel<T>::close() {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (closed)
+        return;
+    closed = true;
+    while (!senders.empty()) {
+        executor.post(senders.peek()->handle);
+        senders.pop();
+    }
+    while (!receivers.empty()) {
+        executor.post(receivers.peek()->handle);
+        receivers.pop();
+    }
+}
+
+// 判断是否已关闭
+template<typename T>
+bool AsyncChannel<T>::isClosed() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return closed;
+}
+
+// 缓冲区中的数据个数
+template<typename T>
+int AsyncChannel<T>::size() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return buffer.size();
+}
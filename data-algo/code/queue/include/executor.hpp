@@ -0,0 +1,241 @@
+#pragma once
+#include "queue.hpp"
+#include <coroutine>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief 协程执行器接口
+ *
+ * 等待中的协程被唤醒时不会在唤醒方的调用栈上直接恢复，而是交给执行器排队，
+ * 由执行器的线程依次恢复。需要 C++20（-std=c++20）。
+ */
+class Executor {
+public:
+    virtual ~Executor() {}
+
+    /**
+     * @brief 提交一个待恢复的协程，线程安全
+     * @param handle 协程句柄
+     */
+    virtual void post(std::coroutine_handle<> handle) = 0;
+};
+
+/**
+ * @brief 单线程执行器
+ *
+ * 就绪协程保存在 Queue 中，由调用 run() 的线程按提交顺序逐个恢复，
+ * 适合把整条流水线放在一个线程内协作运行。
+ */
+class SingleThreadExecutor : public Executor {
+private:
+    Queue<std::coroutine_handle<>> ready;   ///< 就绪协程队列
+    std::mutex mutex;                       ///< 保护就绪队列，允许其他线程提交
+
+public:
+    /**
+     * @brief 提交一个待恢复的协程
+     * @param handle 协程句柄
+     */
+    void post(std::coroutine_handle<> handle) override;
+
+    /**
+     * @brief 在当前线程恢复就绪协程，直到就绪队列为空
+     * @return 本次恢复的协程次数
+     */
+    int run();
+};
+
+/**
+ * @brief 线程池执行器
+ *
+ * 固定数量的工作线程从共享的就绪队列中取出协程并恢复，空闲时在条件变量上休眠，
+ * 不忙等。析构时等待当前任务结束并回收线程，未恢复的协程不会被执行。
+ */
+class ThreadPoolExecutor : public Executor {
+private:
+    Queue<std::coroutine_handle<>> ready;   ///< 就绪协程队列
+    std::vector<std::thread> workers;       ///< 工作线程
+    std::mutex mutex;                       ///< 保护就绪队列与状态
+    std::condition_variable hasWork;        ///< 有新任务或停止时通知工作线程
+    std::condition_variable idle;           ///< 全部空闲时通知 waitIdle()
+    int running;                            ///< 正在恢复协程的工作线程数
+    bool stopping;                          ///< 是否正在停止
+
+    void workerLoop();
+
+public:
+    /**
+     * @brief 构造函数，启动工作线程
+     * @param threads 线程数，不大于0时取硬件并发数
+     */
+    explicit ThreadPoolExecutor(int threads = 0);
+
+    /**
+     * @brief 析构函数，停止并回收所有工作线程
+     */
+    ~ThreadPoolExecutor() override;
+
+    ThreadPoolExecutor(const ThreadPoolExecutor&) = delete;
+    ThreadPoolExecutor& operator=(const ThreadPoolExecutor&) = delete;
+
+    /**
+     * @brief 提交一个待恢复的协程，唤醒一个空闲线程
+     * @param handle 协程句柄
+     */
+    void post(std::coroutine_handle<> handle) override;
+
+    /**
+     * @brief 阻塞直到就绪队列为空且没有线程在恢复协程
+     *
+     * 此时所有协程要么已结束，要么挂起在通道上等待。
+     */
+    void waitIdle();
+
+    /**
+     * @brief 获取工作线程数
+     * @return 线程数
+     */
+    int threadCount() const { return static_cast<int>(workers.size()); }
+};
+
+/**
+ * @brief 分离式协程任务
+ *
+ * 作为协程的返回类型使用。协程创建后先挂起，调用 start() 交给执行器后开始运行，
+ * 运行结束时自动销毁协程帧。协程体内未捕获的异常会调用 std::terminate()，
+ * 与 std::thread 中逸出的异常一致。
+ */
+class AsyncTask {
+public:
+    struct promise_type {
+        AsyncTask get_return_object() {
+            return AsyncTask(std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+        std::suspend_always initial_suspend() noexcept { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void return_void() {}
+        void unhandled_exception() { std::terminate(); }
+    };
+
+    AsyncTask(AsyncTask&& other) noexcept : handle(other.handle) { other.handle = nullptr; }
+    AsyncTask(const AsyncTask&) = delete;
+    AsyncTask& operator=(const AsyncTask&) = delete;
+
+    /**
+     * @brief 析构函数，未启动的协程在此销毁
+     */
+    ~AsyncTask();
+
+    /**
+     * @brief 把协程交给执行器开始运行，之后协程自行管理生命周期
+     * @param executor 执行器
+     * @throws std::logic_error 如果已经启动过
+     */
+    void start(Executor& executor);
+
+private:
+    std::coroutine_handle<promise_type> handle;   ///< 尚未启动的协程，启动后置空
+
+    explicit AsyncTask(std::coroutine_handle<promise_type> h) : handle(h) {}
+};
+
+// ================== 实现部分 ==================
+
+// 提交协程到就绪队列
+inline void SingleThreadExecutor::post(std::coroutine_handle<> handle) {
+    std::lock_guard<std::mutex> lock(mutex);
+    ready.push(handle);
+}
+
+// 逐个取出就绪协程并恢复；恢复过程中新提交的协程也会在本次运行
+inline int SingleThreadExecutor::run() {
+    int resumed = 0;
+    while (true) {
+        std::coroutine_handle<> handle;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (ready.empty())
+                return resumed;
+            handle = ready.peek();
+            ready.pop();
+        }
+        handle.resume();
+        ++resumed;
+    }
+}
+
+// 启动工作线程
+inline ThreadPoolExecutor::ThreadPoolExecutor(int threads) : running(0), stopping(false) {
+    if (threads <= 0)
+        threads = static_cast<int>(std::thread::hardware_concurrency());
+    if (threads <= 0)
+        threads = 1;
+    workers.reserve(threads);
+    for (int i = 0; i < threads; ++i)
+        workers.push_back(std::thread(&ThreadPoolExecutor::workerLoop, this));
+}
+
+// 通知停止并回收线程
+inline ThreadPoolExecutor::~ThreadPoolExecutor() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    hasWork.notify_all();
+    for (size_t i = 0; i < workers.size(); ++i)
+        workers[i].join();
+}
+
+// 提交协程并唤醒一个工作线程
+inline void ThreadPoolExecutor::post(std::coroutine_handle<> handle) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        ready.push(handle);
+    }
+    hasWork.notify_one();
+}
+
+// 等待就绪队列清空且所有工作线程空闲
+inline void ThreadPoolExecutor::waitIdle() {
+    std::unique_lock<std::mutex> lock(mutex);
+    idle.wait(lock, [this]() { return ready.empty() && running == 0; });
+}
+
+// 工作线程主循环：无任务时休眠，有任务时取出恢复
+inline void ThreadPoolExecutor::workerLoop() {
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+        hasWork.wait(lock, [this]() { return stopping || !ready.empty(); });
+        if (stopping)
+            return;
+        std::coroutine_handle<> handle = ready.peek();
+        ready.pop();
+        ++running;
+        lock.unlock();
+        handle.resume();
+        lock.lock();
+        --running;
+        if (running == 0 && ready.empty())
+            idle.notify_all();
+    }
+}
+
+// 未启动的协程随任务对象一起销毁
+inline AsyncTask::~AsyncTask() {
+    if (handle)
+        handle.destroy();
+}
+
+// 交出协程句柄，由执行器恢复
+inline void AsyncTask::start(Executor& executor) {
+    if (!handle)
+        throw std::logic_error("AsyncTask already started");
+    std::coroutine_handle<promise_type> h = handle;
+    handle = nullptr;
+    executor.post(h);
+}
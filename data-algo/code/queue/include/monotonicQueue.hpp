@@ -0,0 +1,486 @@
+#pragma once
+#include "../../common/include/dsCheck.hpp"
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+/**
+ * @brief 连续存储的环形缓冲区
+ *
+ * 容量为2的幂，下标用掩码取模；两端插入删除 O(1)，满时容量翻倍并把元素按顺序搬到新缓冲区。
+ * 只供本文件中的单调队列与滑动窗口使用，不做越界检查。
+ *
+ * @tparam T 元素类型（需可默认构造、可赋值）
+ */
+template<typename T>
+class RingBuffer {
+private:
+    std::vector<T> slots;   ///< 存储，大小为2的幂
+    std::size_t head;       ///< 首元素下标
+    std::size_t count;      ///< 元素个数
+
+    void grow();
+
+public:
+    RingBuffer() : slots(16), head(0), count(0) {}
+
+    bool empty() const { return count == 0; }
+    std::size_t size() const { return count; }
+
+    T& front() { return slots[head]; }
+    const T& front() const { return slots[head]; }
+    T& back() { return slots[(head + count - 1) & (slots.size() - 1)]; }
+    const T& back() const { return slots[(head + count - 1) & (slots.size() - 1)]; }
+
+    void push_back(const T& value) {
+        if (count == slots.size()) grow();
+        slots[(head + count) & (slots.size() - 1)] = value;
+        ++count;
+    }
+    void pop_front() {
+        head = (head + 1) & (slots.size() - 1);
+        --count;
+    }
+    void pop_back() { --count; }
+    void clear() {
+        head = 0;
+        count = 0;
+    }
+
+    /**
+     * @brief 预留至少n个元素的空间
+     * @param n 元素个数
+     */
+    void reserve(std::size_t n);
+};
+
+/**
+ * @brief 单调队列模板类
+ *
+ * 先进先出的队列，额外支持 O(1) 查询当前队列中的“最优”元素（Compare 为 std::less 时为最小值，
+ * std::greater 时为最大值）。内部只保留可能成为最优的元素：入队时从尾部弹出所有不优于新元素的旧元素，
+ * 保留的元素按 Compare 严格单调，队首即最优。每个元素最多入、出内部缓冲区各一次，push/pop 均摊 O(1)。
+ *
+ * 被弹出的元素不再保存，因此 pop 只能丢弃队首而不能返回它的值。
+ *
+ * @tparam T 元素类型（需可默认构造、可赋值）
+ * @tparam Compare 比较器，comp(a, b) 为 true 表示 a 优于 b，默认 std::less<T>
+ */
+template<typename T, typename Compare = std::less<T>>
+class MonotonicQueue {
+private:
+    /**
+     * @brief 保留的元素及其入队序号
+     */
+    struct Entry {
+        T value;                    ///< 元素值
+        unsigned long long seq;     ///< 入队序号
+    };
+
+    RingBuffer<Entry> entries;      ///< 单调保留的元素
+    unsigned long long head;        ///< 队首（最早未出队）元素的序号
+    unsigned long long tail;        ///< 下一个入队元素的序号
+    Compare comp;                   ///< 比较器
+
+public:
+    /**
+     * @brief 构造空队列
+     * @param comp 比较器
+     */
+    explicit MonotonicQueue(const Compare& comp = Compare()) : head(0), tail(0), comp(comp) {}
+
+    /**
+     * @brief 入队，均摊 O(1)
+     * @param value 元素值
+     */
+    void push(const T& value);
+
+    /**
+     * @brief 批量入队，按区间顺序依次入队
+     * @param first 区间起始迭代器
+     * @param last 区间尾后迭代器
+     */
+    template<typename InputIt>
+    void push_n(InputIt first, InputIt last);
+
+    /**
+     * @brief 出队（丢弃最早入队的元素），O(1)
+     * @throws std::out_of_range 如果队列为空
+     */
+    void pop();
+
+    /**
+     * @brief 一次丢弃最早入队的 n 个元素，O(被移除的保留元素数)
+     * @param n 个数，超过 size() 时清空
+     */
+    void pop_n(std::size_t n);
+
+    /**
+     * @brief 最优元素，O(1)
+     * @return 最优元素的常量引用
+     * @throws std::out_of_range 如果队列为空
+     */
+    const T& top() const;
+
+    /**
+     * @brief 不抛异常的出队
+     * @return 队列非空返回true，为空返回false
+     */
+    bool try_pop();
+
+    /**
+     * @brief 不抛异常的最优元素查询
+     * @param out 成功时写入最优元素
+     * @return 队列非空返回true，为空返回false（out不变）
+     */
+    bool try_top(T& out) const;
+
+    /**
+     * @brief 队列中的元素个数（含已被淘汰、不再保存的元素）
+     * @return 个数
+     */
+    std::size_t size() const { return static_cast<std::size_t>(tail - head); }
+
+    /**
+     * @brief 判断队列是否为空
+     * @return 为空返回true
+     */
+    bool empty() const { return tail == head; }
+
+    /**
+     * @brief 内部实际保留的元素个数，不超过 size()
+     * @return 个数
+     */
+    std::size_t retained() const { return entries.size(); }
+
+    /**
+     * @brief 预留内部缓冲区
+     * @param n 元素个数
+     */
+    void reserve(std::size_t n) { entries.reserve(n); }
+
+    /**
+     * @brief 清空队列
+     */
+    void clear();
+};
+
+/**
+ * @brief 滑动窗口最小值/最大值
+ *
+ * 按个数或按时间维护最近的一段样本，add、过期、min/max 查询均摊 O(1)。
+ * 内部为一个最小值单调队列和一个最大值单调队列；按时间的窗口另用环形缓冲区保存窗口内各样本的时间戳，
+ * 以便知道每次过期多少个样本。
+ *
+ * - COUNT：保留最近 length 个样本
+ * - TIME：保留时间戳大于 now - length 的样本，now 为最近一次 add 或 advance 的时间；时间戳必须单调不减
+ *
+ * @tparam T 样本类型（需可默认构造、可赋值、可用 < 比较）
+ */
+template<typename T>
+class SlidingWindow {
+public:
+    /**
+     * @brief 窗口类型
+     */
+    enum Kind {
+        COUNT,   ///< 按样本个数
+        TIME     ///< 按时间跨度
+    };
+
+private:
+    Kind kind;                                   ///< 窗口类型
+    long long length;                            ///< 窗口长度（个数或时间跨度）
+    MonotonicQueue<T, std::less<T>> minQueue;    ///< 最小值
+    MonotonicQueue<T, std::greater<T>> maxQueue; ///< 最大值
+    RingBuffer<long long> times;                 ///< 窗口内样本的时间戳（仅 TIME）
+    long long now;                               ///< 当前时间（仅 TIME），尚无样本时为最小值
+
+    /**
+     * @brief 丢弃最早的 n 个样本
+     * @param n 个数
+     */
+    void expire(std::size_t n);
+
+public:
+    /**
+     * @brief 构造空窗口
+     * @param kind 窗口类型
+     * @param length 窗口长度：COUNT 为样本个数，TIME 为时间跨度，均须为正
+     * @throws std::invalid_argument 如果 length 不为正
+     */
+    SlidingWindow(Kind kind, long long length);
+
+    /**
+     * @brief 加入一个样本，并按窗口长度过期旧样本
+     * @param value 样本值
+     * @param timestamp 时间戳，COUNT 窗口忽略
+     * @throws std::invalid_argument 如果 TIME 窗口的时间戳小于当前时间
+     */
+    void add(const T& value, long long timestamp = 0);
+
+    /**
+     * @brief 批量加入 COUNT 窗口的样本；批量不少于窗口长度时只处理最后 length 个
+     * @param values 样本数组
+     * @param n 个数
+     * @throws std::logic_error 如果窗口不是 COUNT 类型
+     */
+    void add_n(const T* values, std::size_t n);
+
+    /**
+     * @brief 批量加入 TIME 窗口的样本，时间戳须单调不减
+     * @param values 样本数组
+     * @param timestamps 时间戳数组
+     * @param n 个数
+     * @throws std::invalid_argument 如果时间戳小于当前时间或前一个样本
+     */
+    void add_n(const T* values, const long long* timestamps, std::size_t n);
+
+    /**
+     * @brief 推进 TIME 窗口的当前时间并过期旧样本（COUNT 窗口无操作）
+     * @param timestamp 新的当前时间，小于当前时间时忽略
+     */
+    void advance(long long timestamp);
+
+    /**
+     * @brief 窗口内最小值，O(1)
+     * @return 最小值
+     * @throws std::out_of_range 如果窗口为空
+     */
+    const T& min() const { return minQueue.top(); }
+
+    /**
+     * @brief 窗口内最大值，O(1)
+     * @return 最大值
+     * @throws std::out_of_range 如果窗口为空
+     */
+    const T& max() const { return maxQueue.top(); }
+
+    /**
+     * @brief 不抛异常的最小值查询
+     * @param out 成功时写入最小值
+     * @return 窗口非空返回true
+     */
+    bool try_min(T& out) const { return minQueue.try_top(out); }
+
+    /**
+     * @brief 不抛异常的最大值查询
+     * @param out 成功时写入最大值
+     * @return 窗口非空返回true
+     */
+    bool try_max(T& out) const { return maxQueue.try_top(out); }
+
+    /**
+     * @brief 窗口内样本个数
+     * @return 个数
+     */
+    std::size_t size() const { return minQueue.size(); }
+
+    /**
+     * @brief 判断窗口是否为空
+     * @return 为空返回true
+     */
+    bool empty() const { return minQueue.empty(); }
+
+    /**
+     * @brief 两个单调队列实际保留的元素总数
+     * @return 个数
+     */
+    std::size_t retained() const { return minQueue.retained() + maxQueue.retained(); }
+
+    /**
+     * @brief 当前时间（仅 TIME 窗口有意义）
+     * @return 时间
+     */
+    long long currentTime() const { return now; }
+
+    /**
+     * @brief 清空窗口，TIME 窗口的当前时间保持不变
+     */
+    void clear();
+};
+
+// ================== 实现部分 ==================
+
+// 容量翻倍，按逻辑顺序搬到新缓冲区的开头
+template<typename T>
+void RingBuffer<T>::grow() {
+    std::vector<T> bigger(slots.size() * 2);
+    for (std::size_t i = 0; i < count; ++i) {
+        bigger[i] = slots[(head + i) & (slots.size() - 1)];
+    }
+    slots.swap(bigger);
+    head = 0;
+}
+
+// 预留空间：容量不足时一次扩到不小于n的2的幂
+template<typename T>
+void RingBuffer<T>::reserve(std::size_t n) {
+    while (slots.size() < n) grow();
+}
+
+// 入队：弹出尾部所有不优于新元素的保留元素，它们在新元素出队前都不可能成为最优
+template<typename T, typename Compare>
+void MonotonicQueue<T, Compare>::push(const T& value) {
+    while (!entries.empty() && !comp(entries.back().value, value)) {
+        entries.pop_back();
+    }
+    Entry e;
+    e.value = value;
+    e.seq = tail++;
+    entries.push_back(e);
+}
+
+// 批量入队
+template<typename T, typename Compare>
+template<typename InputIt>
+void MonotonicQueue<T, Compare>::push_n(InputIt first, InputIt last) {
+    for (; first != last; ++first) push(*first);
+}
+
+// 出队：队首元素若仍被保留，必然位于保留序列的最前面
+template<typename T, typename Compare>
+void MonotonicQueue<T, Compare>::pop() {
+    DS_CHECK(!empty(), std::out_of_range, "Queue is empty");
+    if (entries.front().seq == head) entries.pop_front();
+    ++head;
+}
+
+// 批量出队：序号小于新队首的保留元素全部移除
+template<typename T, typename Compare>
+void MonotonicQueue<T, Compare>::pop_n(std::size_t n) {
+    head = n >= size() ? tail : head + n;
+    while (!entries.empty() && entries.front().seq < head) {
+        entries.pop_front();
+    }
+}
+
+// 最优元素即保留序列的队首
+template<typename T, typename Compare>
+const T& MonotonicQueue<T, Compare>::top() const {
+    DS_CHECK(!empty(), std::out_of_range, "Queue is empty");
+    return entries.front().value;
+}
+
+// 不抛异常的出队
+template<typename T, typename Compare>
+bool MonotonicQueue<T, Compare>::try_pop() {
+    if (empty()) return false;
+    if (entries.front().seq == head) entries.pop_front();
+    ++head;
+    return true;
+}
+
+// 不抛异常的最优元素查询
+template<typename T, typename Compare>
+bool MonotonicQueue<T, Compare>::try_top(T& out) const {
+    if (empty()) return false;
+    out = entries.front().value;
+    return true;
+}
+
+// 清空队列，序号继续递增
+template<typename T, typename Compare>
+void MonotonicQueue<T, Compare>::clear() {
+    entries.clear();
+    head = tail;
+}
+
+// 构造空窗口
+template<typename T>
+SlidingWindow<T>::SlidingWindow(Kind kind, long long length)
+    : kind(kind), length(length), now(std::numeric_limits<long long>::min()) {
+    if (length <= 0) {
+        throw std::invalid_argument("Window length must be positive");
+    }
+}
+
+// 丢弃最早的n个样本
+template<typename T>
+void SlidingWindow<T>::expire(std::size_t n) {
+    minQueue.pop_n(n);
+    maxQueue.pop_n(n);
+}
+
+// 加入一个样本
+template<typename T>
+void SlidingWindow<T>::add(const T& value, long long timestamp) {
+    if (kind == TIME) {
+        if (timestamp < now) {
+            throw std::invalid_argument("Timestamps must be non-decreasing");
+        }
+        times.push_back(timestamp);
+        minQueue.push(value);
+        maxQueue.push(value);
+        advance(timestamp);
+        return;
+    }
+    minQueue.push(value);
+    maxQueue.push(value);
+    if (minQueue.size() > static_cast<std::size_t>(length)) expire(1);
+}
+
+// 批量加入 COUNT 窗口：比窗口更早的样本加入后也会立即过期，直接跳过
+template<typename T>
+void SlidingWindow<T>::add_n(const T* values, std::size_t n) {
+    if (kind != COUNT) {
+        throw std::logic_error("add_n without timestamps requires a COUNT window");
+    }
+    std::size_t len = static_cast<std::size_t>(length);
+    if (n >= len) {
+        expire(minQueue.size());
+        values += n - len;
+        n = len;
+    }
+    for (std::size_t i = 0; i < n; ++i) {
+        minQueue.push(values[i]);
+        maxQueue.push(values[i]);
+    }
+    if (minQueue.size() > len) expire(minQueue.size() - len);
+}
+
+// 批量加入 TIME 窗口：先整体检查时间戳，全部入队后只推进一次时间
+template<typename T>
+void SlidingWindow<T>::add_n(const T* values, const long long* timestamps, std::size_t n) {
+    if (kind == COUNT) {
+        add_n(values, n);
+        return;
+    }
+    if (n == 0) return;
+    long long prev = now;
+    for (std::size_t i = 0; i < n; ++i) {
+        if (timestamps[i] < prev) {
+            throw std::invalid_argument("Timestamps must be non-decreasing");
+        }
+        prev = timestamps[i];
+    }
+    for (std::size_t i = 0; i < n; ++i) {
+        times.push_back(timestamps[i]);
+        minQueue.push(values[i]);
+        maxQueue.push(values[i]);
+    }
+    advance(timestamps[n - 1]);
+}
+
+// 推进时间：数出时间戳不大于 now - length 的样本个数，一次过期（用差值比较，避免 now - length 溢出）
+template<typename T>
+void SlidingWindow<T>::advance(long long timestamp) {
+    if (kind != TIME) return;
+    if (timestamp > now) now = timestamp;
+    std::size_t n = 0;
+    while (!times.empty() && now - times.front() >= length) {
+        times.pop_front();
+        ++n;
+    }
+    if (n > 0) expire(n);
+}
+
+// 清空窗口
+template<typename T>
+void SlidingWindow<T>::clear() {
+    minQueue.clear();
+    maxQueue.clear();
+    times.clear();
+}
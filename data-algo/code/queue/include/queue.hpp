@@ -1,10 +1,20 @@
 #pragma once
-#include "../../linklist/include/linkList.hpp"
+#include "../../linklist/include/dLinkList.hpp"
+#include "../../common/include/dsCheck.hpp"
+#include "../../trace/include/traceHooks.hpp"
+#include <type_traits>
 
 template<typename T>
 class Queue {
 private:
-    LinkList<T> list;
+    DLinkList<T> list;
+    DLinkList<T> spare;   // 出队后回收的节点，入队时优先复用，避免逐个分配
+
+    // 回收的节点仍保存着出队的值，直到复用时才被覆盖；只为可平凡析构的类型缓存节点，
+    // 否则出队的 shared_ptr、string 等持有的资源会一直存活
+    static const int NODE_CACHE_LIMIT = std::is_trivially_destructible<T>::value ? 1024 : 0;
+
+    void recycleFront();
 
 public:
     Queue();
@@ -14,8 +24,21 @@ public:
     bool empty() const;
     T peek() const;
     void push(const T& value);
+    template<typename ForwardIt>
+    void push_n(ForwardIt first, ForwardIt last);
     void pop();
+    int pop_n(T* out, int max);
+    template<typename F>
+    int drain(F consume);
     void clear();
+
+    // 不抛异常的版本：队列为空时返回 false，out 不变
+    bool try_peek(T& out) const;
+    bool try_pop(T& out);
+
+    // 不检查的版本：调用者保证队列非空
+    const T& unchecked_peek() const;
+    void unchecked_pop();
 };
 
 template<typename T>
@@ -36,26 +59,112 @@ bool Queue<T>::empty() const {
 
 template<typename T>
 T Queue<T>::peek() const {
-    if (empty()) {
-        throw std::out_of_range("Queue is empty");
-    }
-    return list.get(list.size() - 1);   // 时间复杂度为O(n)，list增加尾指针或者改成循环链表则降为O(1)
+    DS_CHECK(!empty(), std::out_of_range, "Queue is empty");
+    return list.frontNode()->data;   // 双向循环链表，队首即首元素，O(1)
 }
 
+// 入队：有回收节点时直接复用，否则分配新节点
 template<typename T>
 void Queue<T>::push(const T& value) {
-    list.insert(0, value);
+    DS_TRACE_SCOPE("Queue::push");
+    if (spare.empty()) {
+        list.push_back(value);
+        return;
+    }
+    DLinkNode<T>* node = spare.backNode();
+    node->data = value;
+    list.splice(node, spare);
+}
+
+// 批量入队：先在临时链表中建好整段节点，再一次拼接到队尾；
+// 中途分配失败时队列保持不变
+template<typename T>
+template<typename ForwardIt>
+void Queue<T>::push_n(ForwardIt first, ForwardIt last) {
+    DLinkList<T> batch;
+    for (; first != last; ++first) {
+        if (spare.empty()) {
+            batch.push_back(*first);
+        } else {
+            DLinkNode<T>* node = spare.backNode();
+            node->data = *first;
+            batch.splice(node, spare);
+        }
+    }
+    list.splice(batch);
 }
 
 template<typename T>
 void Queue<T>::pop() {
-    if (empty()) {
-        throw std::out_of_range("Queue is empty");
+    DS_TRACE_SCOPE("Queue::pop");
+    DS_CHECK(!empty(), std::out_of_range, "Queue is empty");
+    recycleFront();
+}
+
+template<typename T>
+bool Queue<T>::try_peek(T& out) const {
+    if (list.empty())
+        return false;
+    out = list.frontNode()->data;
+    return true;
+}
+
+// 不抛异常的出队：先取值再回收节点
+template<typename T>
+bool Queue<T>::try_pop(T& out) {
+    if (list.empty())
+        return false;
+    out = list.frontNode()->data;
+    recycleFront();
+    return true;
+}
+
+template<typename T>
+const T& Queue<T>::unchecked_peek() const {
+    return list.frontNode()->data;
+}
+
+template<typename T>
+void Queue<T>::unchecked_pop() {
+    recycleFront();
+}
+
+// 批量出队，按出队顺序写入连续缓冲区，返回实际出队个数
+template<typename T>
+int Queue<T>::pop_n(T* out, int max) {
+    int n = 0;
+    while (n < max && !list.empty()) {
+        out[n++] = list.frontNode()->data;
+        recycleFront();
+    }
+    return n;
+}
+
+// 按出队顺序把所有元素交给consume处理并清空队列，返回处理个数
+template<typename T>
+template<typename F>
+int Queue<T>::drain(F consume) {
+    int n = 0;
+    while (!list.empty()) {
+        consume(list.frontNode()->data);
+        recycleFront();
+        ++n;
     }
-    list.remove(list.size() - 1);
+    return n;
 }
 
 template<typename T>
 void Queue<T>::clear() {
+    DS_TRACE_SCOPE("Queue::clear");
     list.clear();
+    spare.clear();
+}
+
+// 摘下队首节点：回收池未满时留作复用，否则释放
+template<typename T>
+void Queue<T>::recycleFront() {
+    if (spare.size() < NODE_CACHE_LIMIT)
+        spare.splice(list.frontNode(), list);
+    else
+        list.pop_front();
 }
@@ -0,0 +1,373 @@
+#pragma once
+#include <algorithm>
+#include <cstdio>
+#include <deque>
+#include <future>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief 内存预算受限、可溢出到磁盘的队列
+ *
+ * 元素按固定字节数分段存放：队首段（正在出队）和队尾段（正在入队）始终在内存中；
+ * 写满的队尾段进入中间段序列，内存预算允许时留在内存，否则整段顺序写入一个段文件。
+ * 紧接队首段的一段在磁盘上时，后台线程在消费者读完队首段期间把它读回内存（预读一段），
+ * 出队时通常不必等待磁盘。
+ *
+ * - 内存占用不超过预算：队首段 + 队尾段 + 预读段 + 留在内存中的中间段
+ * - 段文件读回后立即删除，析构时删除所有剩余段文件
+ * - 与 Queue 一样不是线程安全的；内部只有预读线程访问自己的段文件
+ *
+ * @tparam T 元素类型，必须可平凡复制（按字节写入文件）
+ */
+template<typename T>
+class SpillQueue {
+    static_assert(std::is_trivially_copyable<T>::value, "SpillQueue requires a trivially copyable element type");
+
+private:
+    /// 中间段：在内存中时 data 有效，溢出到磁盘时 path 有效
+    struct Segment {
+        std::vector<T> data;
+        std::string path;
+        size_t count;
+        bool onDisk;
+    };
+
+    std::vector<T> head;             ///< 队首段
+    size_t headPos;                  ///< 队首段中下一个出队元素的位置
+    std::vector<T> tail;             ///< 队尾段
+    std::deque<Segment> middle;      ///< 中间段，按入队顺序排列
+    size_t segmentCapacity;          ///< 每段元素个数
+    size_t segmentLimit;             ///< 内存预算能容纳的段数（至少3：队首、队尾、预读）
+    size_t residentMiddle;           ///< 留在内存中的中间段个数
+    size_t spilledCount;             ///< 当前在磁盘上的段数
+    size_t length;                   ///< 元素总数
+    std::string filePrefix;          ///< 段文件路径前缀：目录 + 本队列的随机标识
+    unsigned long long fileSeq;      ///< 段文件序号
+    Segment* prefetchTarget;         ///< 正在预读的段，nullptr 表示没有
+    std::future<std::vector<T> > prefetch;   ///< 预读结果
+    unsigned long long bytesWritten; ///< 累计写入磁盘的字节数
+    unsigned long long bytesRead;    ///< 累计从磁盘读回的字节数
+
+    static void writeFile(const std::string& path, const std::vector<T>& data);
+    static std::vector<T> readFile(const std::string& path, size_t count);
+
+    void sealTail();
+    void refillHead();
+    void startPrefetch();
+
+public:
+    /**
+     * @brief 构造函数
+     * @param memoryBudget 内存预算（字节），至少能容纳3段
+     * @param spillDirectory 段文件目录，需已存在且可写
+     * @param segmentBytes 每段字节数，决定一次顺序读写的大小
+     * @throws std::invalid_argument 如果预算不足3段
+     */
+    explicit SpillQueue(size_t memoryBudget, const std::string& spillDirectory = ".",
+                        size_t segmentBytes = 1 << 20);
+
+    /**
+     * @brief 析构函数，等待预读完成并删除所有段文件
+     */
+    ~SpillQueue();
+
+    SpillQueue(const SpillQueue&) = delete;
+    SpillQueue& operator=(const SpillQueue&) = delete;
+
+    /**
+     * @brief 入队，队尾段已满时先按预算把它留在内存或写入磁盘
+     * @param value 元素值
+     * @throws std::runtime_error 如果段文件写入失败；此时 value 未入队，队列内容不变，下次入队重新尝试写出
+     */
+    void push(const T& value);
+
+    /**
+     * @brief 批量入队 [first, last)
+     * @param first 起始迭代器
+     * @param last 结束迭代器
+     * @throws std::runtime_error 如果段文件写入失败；此前的元素已入队，当前及之后的元素未入队
+     */
+    template<typename ForwardIt>
+    void push_n(ForwardIt first, ForwardIt last);
+
+    /**
+     * @brief 出队
+     * @throws std::out_of_range 如果队列为空
+     * @throws std::runtime_error 如果段文件读取失败
+     */
+    void pop();
+
+    /**
+     * @brief 批量出队，最多取出 max 个元素写入 out
+     * @param out 输出缓冲区
+     * @param max 最多取出的个数
+     * @return 实际取出的个数；已取出部分元素后读段失败时提前返回
+     * @throws std::runtime_error 如果一个元素都未取出时段文件读取失败
+     */
+    size_t pop_n(T* out, size_t max);
+
+    /**
+     * @brief 查看队首元素
+     * @return 队首元素
+     * @throws std::out_of_range 如果队列为空
+     */
+    T peek();
+
+    /**
+     * @brief 获取元素个数
+     * @return 元素个数
+     */
+    size_t size() const { return length; }
+
+    /**
+     * @brief 判断是否为空
+     * @return 为空返回true
+     */
+    bool empty() const { return length == 0; }
+
+    /**
+     * @brief 清空队列并删除所有段文件
+     */
+    void clear();
+
+    /**
+     * @brief 每段元素个数
+     * @return 段容量
+     */
+    size_t segmentSize() const { return segmentCapacity; }
+
+    /**
+     * @brief 当前在磁盘上的段数
+     * @return 段数
+     */
+    size_t spilledSegments() const { return spilledCount; }
+
+    /**
+     * @brief 当前占用的元素内存（字节），包括队首、队尾、预读与内存中的中间段
+     * @return 字节数
+     */
+    size_t memoryBytes() const;
+
+    /**
+     * @brief 累计写入磁盘的字节数
+     * @return 字节数
+     */
+    unsigned long long totalBytesWritten() const { return bytesWritten; }
+
+    /**
+     * @brief 累计从磁盘读回的字节数
+     * @return 字节数
+     */
+    unsigned long long totalBytesRead() const { return bytesRead; }
+};
+
+// ================== 实现部分 ==================
+
+// 构造函数：按预算计算可驻留的段数
+template<typename T>
+SpillQueue<T>::SpillQueue(size_t memoryBudget, const std::string& spillDirectory, size_t segmentBytes)
+    : headPos(0), segmentCapacity(segmentBytes / sizeof(T) > 0 ? segmentBytes / sizeof(T) : 1),
+      segmentLimit(0), residentMiddle(0), spilledCount(0), length(0), fileSeq(0), prefetchTarget(nullptr),
+      bytesWritten(0), bytesRead(0) {
+    segmentLimit = memoryBudget / (segmentCapacity * sizeof(T));
+    if (segmentLimit < 3) {
+        throw std::invalid_argument("SpillQueue memory budget must hold at least 3 segments");
+    }
+    // 随机标识避免多个队列（包括其他进程中的）共用目录时文件名冲突
+    std::random_device rd;
+    filePrefix = spillDirectory + "/spill_" + std::to_string(rd()) + "_" + std::to_string(rd()) + "_";
+    tail.reserve(segmentCapacity);
+}
+
+// 析构函数：预读线程可能仍在读文件，先等待它结束再删除文件
+template<typename T>
+SpillQueue<T>::~SpillQueue() {
+    if (prefetch.valid()) prefetch.wait();
+    for (size_t i = 0; i < middle.size(); ++i) {
+        if (middle[i].onDisk) std::remove(middle[i].path.c_str());
+    }
+}
+
+// 把一段元素整段顺序写入文件
+template<typename T>
+void SpillQueue<T>::writeFile(const std::string& path, const std::vector<T>& data) {
+    std::FILE* file = std::fopen(path.c_str(), "wb");
+    if (file == nullptr) {
+        throw std::runtime_error("SpillQueue: cannot create segment file " + path);
+    }
+    size_t written = std::fwrite(data.data(), sizeof(T), data.size(), file);
+    bool ok = std::fclose(file) == 0 && written == data.size();
+    if (!ok) {
+        std::remove(path.c_str());
+        throw std::runtime_error("SpillQueue: cannot write segment file " + path);
+    }
+}
+
+// 整段读回并删除文件（在预读线程中执行）
+template<typename T>
+std::vector<T> SpillQueue<T>::readFile(const std::string& path, size_t count) {
+    std::vector<T> data(count);
+    std::FILE* file = std::fopen(path.c_str(), "rb");
+    if (file == nullptr) {
+        throw std::runtime_error("SpillQueue: cannot open segment file " + path);
+    }
+    size_t got = std::fread(data.data(), sizeof(T), count, file);
+    std::fclose(file);
+    if (got != count) {
+        throw std::runtime_error("SpillQueue: segment file truncated " + path);
+    }
+    std::remove(path.c_str());
+    return data;
+}
+
+// 队尾段写满：预算内（保留队首、队尾与预读三段）留在内存，否则写入段文件
+template<typename T>
+void SpillQueue<T>::sealTail() {
+    Segment seg;
+    seg.count = tail.size();
+    if (residentMiddle + 1 <= segmentLimit - 3) {
+        seg.onDisk = false;
+        seg.data.swap(tail);
+        middle.push_back(std::move(seg));
+        ++residentMiddle;
+    } else {
+        seg.onDisk = true;
+        seg.path = filePrefix + std::to_string(fileSeq++) + ".seg";
+        writeFile(seg.path, tail);
+        bytesWritten += seg.count * sizeof(T);
+        middle.push_back(std::move(seg));
+        ++spilledCount;
+        tail.clear();
+        startPrefetch();
+    }
+    tail.reserve(segmentCapacity);
+}
+
+// 紧接队首段之后的一段在磁盘上时启动预读：消费者读完队首段期间，后台线程把它读回内存。
+// 每次只预读一段，占用预算中保留的那一段
+template<typename T>
+void SpillQueue<T>::startPrefetch() {
+    if (prefetchTarget != nullptr || middle.empty() || !middle.front().onDisk) return;
+    prefetchTarget = &middle.front();
+    prefetch = std::async(std::launch::async, &SpillQueue::readFile, prefetchTarget->path, prefetchTarget->count);
+}
+
+// 队首段取空：依次从中间段或队尾段补充。磁盘段优先使用预读结果
+template<typename T>
+void SpillQueue<T>::refillHead() {
+    headPos = 0;
+    head.clear();
+    if (middle.empty()) {
+        head.swap(tail);
+        tail.reserve(segmentCapacity);
+        return;
+    }
+    Segment& seg = middle.front();
+    if (seg.onDisk) {
+        // 预读目标总是紧接队首段的一段，即此处的 seg；没有预读（上次读取失败后重试）时同步读取
+        if (prefetchTarget == nullptr) {
+            prefetch = std::async(std::launch::deferred, &SpillQueue::readFile, seg.path, seg.count);
+        }
+        prefetchTarget = nullptr;
+        std::vector<T> data = prefetch.get();   // 读取失败时异常在此抛出，段保持在磁盘上
+        bytesRead += data.size() * sizeof(T);
+        head.swap(data);
+        --spilledCount;
+    } else {
+        head.swap(seg.data);
+        --residentMiddle;
+    }
+    middle.pop_front();
+    startPrefetch();
+}
+
+// 入队：队尾段已满时先写出再追加。写出失败时 value 未入队，队尾段保持已满，下次入队重试写出，
+// 内存占用不会超出预算
+template<typename T>
+void SpillQueue<T>::push(const T& value) {
+    if (tail.size() >= segmentCapacity) sealTail();
+    tail.push_back(value);
+    ++length;
+}
+
+// 批量入队：逐段填满队尾
+template<typename T>
+template<typename ForwardIt>
+void SpillQueue<T>::push_n(ForwardIt first, ForwardIt last) {
+    for (; first != last; ++first) push(*first);
+}
+
+// 出队
+template<typename T>
+void SpillQueue<T>::pop() {
+    if (empty()) {
+        throw std::out_of_range("Queue is empty");
+    }
+    if (headPos == head.size()) refillHead();
+    ++headPos;
+    --length;
+}
+
+// 批量出队：按段整块复制。已取出部分元素后读段失败时返回已取出的个数，
+// 失败的段留在磁盘上，下次出队时重试
+template<typename T>
+size_t SpillQueue<T>::pop_n(T* out, size_t max) {
+    size_t taken = 0;
+    while (taken < max && length > 0) {
+        if (headPos == head.size()) {
+            try {
+                refillHead();
+            } catch (...) {
+                if (taken == 0) throw;
+                return taken;
+            }
+        }
+        size_t n = head.size() - headPos;
+        if (n > max - taken) n = max - taken;
+        std::copy(head.begin() + headPos, head.begin() + headPos + n, out + taken);
+        headPos += n;
+        taken += n;
+        length -= n;
+    }
+    return taken;
+}
+
+// 查看队首元素
+template<typename T>
+T SpillQueue<T>::peek() {
+    if (empty()) {
+        throw std::out_of_range("Queue is empty");
+    }
+    if (headPos == head.size()) refillHead();
+    return head[headPos];
+}
+
+// 清空队列并删除所有段文件
+template<typename T>
+void SpillQueue<T>::clear() {
+    if (prefetch.valid()) prefetch.wait();
+    prefetch = std::future<std::vector<T> >();
+    prefetchTarget = nullptr;
+    for (size_t i = 0; i < middle.size(); ++i) {
+        if (middle[i].onDisk) std::remove(middle[i].path.c_str());
+    }
+    middle.clear();
+    head.clear();
+    tail.clear();
+    headPos = 0;
+    residentMiddle = 0;
+    spilledCount = 0;
+    length = 0;
+}
+
+// 当前占用的元素内存
+template<typename T>
+size_t SpillQueue<T>::memoryBytes() const {
+    size_t segments = residentMiddle + (prefetchTarget != nullptr ? 1 : 0);
+    return (head.capacity() + tail.capacity() + segments * segmentCapacity) * sizeof(T);
+}
@@ -0,0 +1,163 @@
+#include "../include/asyncChannel.hpp"
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <limits>
+#include <string>
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+void printMenu() {
+    std::cout << "\n====== 异步通道（协程）交互测试菜单 ======\n";
+    std::cout << "命令列表：\n";
+    std::cout << "  pipeline <个数> <容量> <线程数>          : 生产 -> 平方 -> 求和 三级流水线\n";
+    std::cout << "  fanin <生产者数> <每个个数> <容量> <线程数> : 多个生产者写入同一通道\n";
+    std::cout << "  eof <个数> <容量>                        : 演示关闭后先取完剩余数据再收到 EOF\n";
+    std::cout << "  （线程数为 0 时使用单线程执行器）\n";
+    std::cout << "  help                                     : 显示菜单\n";
+    std::cout << "  exit / 0                                 : 退出程序\n";
+    std::cout << "-----------------------------------\n";
+    std::cout << "请输入命令: ";
+}
+
+void clearInput() {
+    std::cin.clear();
+    std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+}
+
+// 依次发送 [first, first + count)，发送完毕后按需关闭通道
+AsyncTask produce(AsyncChannel<long long>& out, long long first, int count,
+                  std::atomic<int>* remaining) {
+    for (int i = 0; i < count; ++i) {
+        if (!co_await out.send(first + i))
+            break;
+    }
+    // 最后一个结束的生产者负责关闭通道
+    if (remaining == nullptr || --*remaining == 0)
+        out.close();
+}
+
+// 中间级：读入数据，平方后转发，上游 EOF 时关闭下游
+AsyncTask square(AsyncChannel<long long>& in, AsyncChannel<long long>& out) {
+    while (std::optional<long long> v = co_await in.recv()) {
+        if (!co_await out.send(*v * *v))
+            break;
+    }
+    out.close();
+}
+
+// 末级：累加所有数据直到 EOF
+AsyncTask consume(AsyncChannel<long long>& in, long long* sum, int* received) {
+    while (std::optional<long long> v = co_await in.recv()) {
+        *sum += *v;
+        ++*received;
+    }
+}
+
+// 运行执行器，直到所有协程结束或挂起在通道上
+void runAll(SingleThreadExecutor& executor) { executor.run(); }
+void runAll(ThreadPoolExecutor& executor) { executor.waitIdle(); }
+
+// 按线程数选择执行器，在其上执行 body(executor)，并打印耗时
+template<typename F>
+void withExecutor(int threads, F body) {
+    auto start = std::chrono::steady_clock::now();
+    if (threads == 0) {
+        SingleThreadExecutor executor;
+        body(executor);
+    } else {
+        ThreadPoolExecutor executor(threads);
+        body(executor);
+    }
+    auto end = std::chrono::steady_clock::now();
+    std::cout << "耗时 " << std::chrono::duration<double, std::milli>(end - start).count() << " ms（"
+              << (threads == 0 ? std::string("单线程执行器") : std::to_string(threads) + " 线程池")
+              << "）\n";
+}
+
+int main() {
+#ifdef _WIN32
+    SetConsoleOutputCP(CP_UTF8);
+    SetConsoleCP(CP_UTF8);
+#endif
+    std::string cmd;
+    printMenu();
+    while (true) {
+        std::cout << "> ";
+        if (!(std::cin >> cmd)) break;
+        try {
+            if (cmd == "pipeline") {
+                int n, capacity, threads;
+                if (!(std::cin >> n >> capacity >> threads) || n < 0 || threads < 0) {
+                    std::cout << "输入有误。用法: pipeline <个数> <容量> <线程数>\n";
+                    clearInput();
+                    continue;
+                }
+                long long sum = 0;
+                int received = 0;
+                withExecutor(threads, [&](auto& executor) {
+                    AsyncChannel<long long> a(executor, capacity), b(executor, capacity);
+                    consume(b, &sum, &received).start(executor);
+                    square(a, b).start(executor);
+                    produce(a, 1, n, nullptr).start(executor);
+                    runAll(executor);
+                });
+                long long expect = 0;
+                for (long long i = 1; i <= n; ++i) expect += i * i;
+                std::cout << "收到 " << received << " 个，平方和 " << sum
+                          << (sum == expect ? "（正确）" : "（错误！）") << "\n";
+            } else if (cmd == "fanin") {
+                int producers, n, capacity, threads;
+                if (!(std::cin >> producers >> n >> capacity >> threads) || producers <= 0 || n < 0 ||
+                    threads < 0) {
+                    std::cout << "输入有误。用法: fanin <生产者数> <每个个数> <容量> <线程数>\n";
+                    clearInput();
+                    continue;
+                }
+                long long sum = 0;
+                int received = 0;
+                std::atomic<int> remaining(producers);
+                withExecutor(threads, [&](auto& executor) {
+                    AsyncChannel<long long> ch(executor, capacity);
+                    consume(ch, &sum, &received).start(executor);
+                    for (int p = 0; p < producers; ++p)
+                        produce(ch, 1, n, &remaining).start(executor);
+                    runAll(executor);
+                });
+                long long expect = static_cast<long long>(producers) * n * (n + 1) / 2;
+                std::cout << "收到 " << received << " 个，总和 " << sum
+                          << (sum == expect ? "（正确）" : "（错误！）") << "\n";
+            } else if (cmd == "eof") {
+                int n, capacity;
+                if (!(std::cin >> n >> capacity) || n < 0) {
+                    std::cout << "输入有误。用法: eof <个数> <容量>\n";
+                    clearInput();
+                    continue;
+                }
+                SingleThreadExecutor executor;
+                AsyncChannel<long long> ch(executor, capacity);
+                produce(ch, 1, n, nullptr).start(executor);
+                executor.run();
+                std::cout << "执行器空闲，通道" << (ch.isClosed() ? "已关闭" : "未关闭")
+                          << "，缓冲区剩余 " << ch.size() << " 个\n";
+                long long sum = 0;
+                int received = 0;
+                consume(ch, &sum, &received).start(executor);
+                executor.run();
+                std::cout << "消费者收到 " << received << " 个后遇到 EOF\n";
+            } else if (cmd == "help") {
+                printMenu();
+            } else if (cmd == "exit" || cmd == "0") {
+                std::cout << "程序结束，再见！\n";
+                break;
+            } else {
+                std::cout << "未知命令。输入 help 查看菜单。\n";
+            }
+        } catch (const std::exception& e) {
+            std::cout << "错误: " << e.what() << "\n";
+        }
+        clearInput();
+    }
+    return 0;
+}
@@ -0,0 +1,240 @@
+#include "../include/monotonicQueue.hpp"
+#include "../../deque/include/deque.hpp"
+#include <chrono>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <vector>
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+void printMenu() {
+    std::cout << "\n====== 单调队列与滑动窗口交互测试菜单 ======\n";
+    std::cout << "命令列表：\n";
+    std::cout << "  push <值>               : 单调队列入队（队首为最小值）\n";
+    std::cout << "  pushn <k> <值...>       : 单调队列批量入队k个值\n";
+    std::cout << "  pop                     : 单调队列出队（丢弃最早的元素）\n";
+    std::cout << "  popn <k>                : 单调队列出队至多k个\n";
+    std::cout << "  top                     : 单调队列当前最小值\n";
+    std::cout << "  trytop                  : 不抛异常的最小值查询（try_top）\n";
+    std::cout << "  size                    : 单调队列元素个数与实际保留个数\n";
+    std::cout << "  clear                   : 清空单调队列\n";
+    std::cout << "  window count|time <长度> : 重新创建按个数/按时间的滑动窗口\n";
+    std::cout << "  add <值> [时间]         : 向滑动窗口加入样本（按时间的窗口需给出时间）\n";
+    std::cout << "  addn <k> <值...>        : 向按个数的窗口批量加入k个样本\n";
+    std::cout << "  advance <时间>          : 推进按时间窗口的当前时间\n";
+    std::cout << "  minmax                  : 滑动窗口的最小值、最大值与样本数\n";
+    std::cout << "  bench <样本数> <窗口>    : 滚动最值与逐次扫描窗口对比\n";
+    std::cout << "  help                    : 显示菜单\n";
+    std::cout << "  exit / 0                : 退出程序\n";
+    std::cout << "-----------------------------------\n";
+    std::cout << "请输入命令: ";
+}
+
+void clearInput() {
+    std::cin.clear();
+    std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+}
+
+// 计时工具：执行f并返回耗时（毫秒）
+template<typename F>
+double timeIt(F f) {
+    auto start = std::chrono::steady_clock::now();
+    f();
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+void printWindow(const SlidingWindow<int>& w) {
+    int lo, hi;
+    if (!w.try_min(lo) || !w.try_max(hi)) {
+        std::cout << "窗口为空。\n";
+        return;
+    }
+    std::cout << "最小值: " << lo << "，最大值: " << hi << "，样本数: " << w.size() << "，保留: " << w.retained()
+              << "\n";
+}
+
+// 对 n 个伪随机样本计算每个长度为 w 的窗口的最小值与最大值：
+// 逐次扫描 Deque 中的窗口为 O(w)，SlidingWindow 为均摊 O(1)，add_n 批量版本一并对比
+void bench(int n, int w) {
+    std::vector<int> data(n);
+    unsigned x = 12345;
+    for (int i = 0; i < n; ++i) {
+        x = x * 1103515245u + 12345u;
+        data[i] = static_cast<int>((x >> 8) % 1000000u);
+    }
+    long long s1 = 0, s2 = 0, s3 = 0;
+    double tScan = timeIt([&]() {
+        Deque<int> d;
+        for (int i = 0; i < n; ++i) {
+            d.push_back(data[i]);
+            if (d.size() > w) d.pop_front();
+            int lo = d.at(0), hi = d.at(0);
+            for (int j = 1; j < d.size(); ++j) {
+                int v = d.at(j);
+                if (v < lo) lo = v;
+                if (v > hi) hi = v;
+            }
+            s1 += lo + hi;
+        }
+    });
+    double tWindow = timeIt([&]() {
+        SlidingWindow<int> sw(SlidingWindow<int>::COUNT, w);
+        for (int i = 0; i < n; ++i) {
+            sw.add(data[i]);
+            s2 += sw.min() + sw.max();
+        }
+    });
+    // 每批 w 个样本，批末查询一次：只处理每批最后 w 个
+    double tBatch = timeIt([&]() {
+        SlidingWindow<int> sw(SlidingWindow<int>::COUNT, w);
+        for (int i = 0; i < n; i += w) {
+            int k = n - i < w ? n - i : w;
+            sw.add_n(&data[i], static_cast<std::size_t>(k));
+            s3 += sw.min() + sw.max();
+        }
+    });
+    long long s4 = 0;
+    {
+        SlidingWindow<int> sw(SlidingWindow<int>::COUNT, w);
+        for (int i = 0; i < n; ++i) {
+            sw.add(data[i]);
+            if ((i + 1) % w == 0 || i == n - 1) s4 += sw.min() + sw.max();
+        }
+    }
+    std::cout << "  " << n << " 个样本，窗口 " << w << "\n";
+    std::cout << "  逐次扫描: " << tScan << " ms，SlidingWindow::add: " << tWindow << " ms"
+              << (s1 == s2 ? "" : "（结果不一致！）") << "\n";
+    std::cout << "  每 " << w << " 个样本查询一次，add_n: " << tBatch << " ms"
+              << (s3 == s4 ? "" : "（结果不一致！）") << "\n";
+}
+
+int main() {
+#ifdef _WIN32
+    SetConsoleOutputCP(CP_UTF8);
+    SetConsoleCP(CP_UTF8);
+#endif
+    MonotonicQueue<int> mq;
+    SlidingWindow<int> window(SlidingWindow<int>::COUNT, 5);
+    std::string cmd;
+    printMenu();
+    while (true) {
+        std::cout << "> ";
+        if (!(std::cin >> cmd)) break;
+        try {
+            if (cmd == "push") {
+                int v;
+                if (!(std::cin >> v)) {
+                    std::cout << "输入有误。用法: push <值>\n";
+                    clearInput();
+                    continue;
+                }
+                mq.push(v);
+                std::cout << "已入队，最小值: " << mq.top() << "\n";
+            } else if (cmd == "pushn" || cmd == "addn") {
+                int k;
+                if (!(std::cin >> k) || k < 0) {
+                    std::cout << "输入有误。用法: " << cmd << " <k> <值...>\n";
+                    clearInput();
+                    continue;
+                }
+                std::vector<int> vals(k);
+                bool ok = true;
+                for (int i = 0; i < k && ok; ++i) ok = static_cast<bool>(std::cin >> vals[i]);
+                if (!ok) {
+                    std::cout << "输入有误。需要 " << k << " 个整数\n";
+                    clearInput();
+                    continue;
+                }
+                if (cmd == "pushn") {
+                    mq.push_n(vals.begin(), vals.end());
+                    std::cout << "已入队 " << k << " 个，元素数: " << mq.size() << "\n";
+                } else {
+                    window.add_n(vals.data(), vals.size());
+                    printWindow(window);
+                }
+            } else if (cmd == "pop") {
+                mq.pop();
+                std::cout << "已出队，剩余: " << mq.size() << "\n";
+            } else if (cmd == "popn") {
+                int k;
+                if (!(std::cin >> k) || k < 0) {
+                    std::cout << "输入有误。用法: popn <k>\n";
+                    clearInput();
+                    continue;
+                }
+                mq.pop_n(static_cast<std::size_t>(k));
+                std::cout << "剩余: " << mq.size() << "\n";
+            } else if (cmd == "top") {
+                std::cout << "最小值: " << mq.top() << "\n";
+            } else if (cmd == "trytop") {
+                int v;
+                if (mq.try_top(v)) std::cout << "最小值: " << v << "\n";
+                else std::cout << "队列为空。\n";
+            } else if (cmd == "size") {
+                std::cout << "元素个数: " << mq.size() << "，实际保留: " << mq.retained() << "\n";
+            } else if (cmd == "clear") {
+                mq.clear();
+                std::cout << "已清空。\n";
+            } else if (cmd == "window") {
+                std::string kind;
+                long long len;
+                if (!(std::cin >> kind >> len) || (kind != "count" && kind != "time")) {
+                    std::cout << "输入有误。用法: window count|time <长度>\n";
+                    clearInput();
+                    continue;
+                }
+                window = SlidingWindow<int>(kind == "count" ? SlidingWindow<int>::COUNT : SlidingWindow<int>::TIME,
+                                            len);
+                std::cout << "已创建" << (kind == "count" ? "按个数" : "按时间") << "的窗口，长度 " << len << "\n";
+            } else if (cmd == "add") {
+                int v;
+                if (!(std::cin >> v)) {
+                    std::cout << "输入有误。用法: add <值> [时间]\n";
+                    clearInput();
+                    continue;
+                }
+                long long t = 0;
+                if (std::cin.peek() != '\n' && !(std::cin >> t)) {
+                    std::cout << "输入有误。用法: add <值> [时间]\n";
+                    clearInput();
+                    continue;
+                }
+                window.add(v, t);
+                printWindow(window);
+            } else if (cmd == "advance") {
+                long long t;
+                if (!(std::cin >> t)) {
+                    std::cout << "输入有误。用法: advance <时间>\n";
+                    clearInput();
+                    continue;
+                }
+                window.advance(t);
+                printWindow(window);
+            } else if (cmd == "minmax") {
+                printWindow(window);
+            } else if (cmd == "bench") {
+                int n, w;
+                if (!(std::cin >> n >> w) || n <= 0 || w <= 0) {
+                    std::cout << "输入有误。用法: bench <样本数> <窗口>\n";
+                    clearInput();
+                    continue;
+                }
+                bench(n, w);
+            } else if (cmd == "help") {
+                printMenu();
+            } else if (cmd == "exit" || cmd == "0") {
+                std::cout << "程序结束，再见！\n";
+                break;
+            } else {
+                std::cout << "未知命令。输入 help 查看菜单。\n";
+            }
+        } catch (const std::exception& e) {
+            std::cout << "错误: " << e.what() << "\n";
+        }
+        clearInput();
+    }
+    return 0;
+}
@@ -2,6 +2,8 @@
 #include <iostream>
 #include <string>
 #include <limits>
+#include <chrono>
+#include <vector>
 #ifdef _WIN32
 #include <windows.h>
 #endif
@@ -11,7 +13,13 @@ void printMenu() {
     std::cout << "命令列表：\n";
     std::cout << "  push <值>      : 入队\n";
     std::cout << "  pop            : 出队\n";
+    std::cout << "  pushn <k> <值...> : 批量入队k个值\n";
+    std::cout << "  popn <k>       : 批量出队至多k个\n";
+    std::cout << "  drain          : 依次取出全部元素\n";
+    std::cout << "  bench <次数>   : 对比逐个与批量入队出队耗时\n";
     std::cout << "  peek           : 查看队首元素\n";
+    std::cout << "  trypop         : 不抛异常的出队（try_pop）\n";
+    std::cout << "  trypeek        : 不抛异常的查看队首（try_peek）\n";
     std::cout << "  size           : 队列元素个数\n";
     std::cout << "  empty          : 判断队列是否为空\n";
     std::cout << "  clear          : 清空队列\n";
@@ -43,6 +51,29 @@ void printQueue(Queue<T>& q) {
     std::cout << "]\n";
 }
 
+// 逐个入队出队 n 个元素与按 batch 个一批入队出队的耗时（毫秒）
+void benchQueue(int n, int batch) {
+    std::vector<int> in(batch), out(batch);
+    for (int i = 0; i < batch; ++i) in[i] = i;
+    Queue<int> q1, q2;
+    long long sum1 = 0, sum2 = 0;
+    auto t0 = std::chrono::steady_clock::now();
+    for (int done = 0; done < n; done += batch) {
+        for (int i = 0; i < batch; ++i) q1.push(in[i]);
+        for (int i = 0; i < batch; ++i) { sum1 += q1.peek(); q1.pop(); }
+    }
+    auto t1 = std::chrono::steady_clock::now();
+    for (int done = 0; done < n; done += batch) {
+        q2.push_n(in.begin(), in.end());
+        int got = q2.pop_n(&out[0], batch);
+        for (int i = 0; i < got; ++i) sum2 += out[i];
+    }
+    auto t2 = std::chrono::steady_clock::now();
+    std::cout << "  逐个: " << std::chrono::duration<double, std::milli>(t1 - t0).count() << " ms\n";
+    std::cout << "  批量: " << std::chrono::duration<double, std::milli>(t2 - t1).count() << " ms"
+              << (sum1 == sum2 ? "" : "（结果不一致！）") << "\n";
+}
+
 void clearInput() {
     std::cin.clear();
     std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
@@ -82,6 +113,13 @@ int main() {
             } catch (const std::exception& e) {
                 std::cout << "错误: " << e.what() << "\n";
             }
+        } else if (cmd == "trypop" || cmd == "trypeek") {
+            int val = 0;
+            bool ok = cmd == "trypop" ? q.try_pop(val) : q.try_peek(val);
+            if (ok)
+                std::cout << (cmd == "trypop" ? "已出队: " : "队首元素为: ") << val << "\n";
+            else
+                std::cout << "队列为空，" << cmd << " 返回 false。\n";
         } else if (cmd == "size") {
             std::cout << "队列元素个数: " << q.size() << "\n";
         } else if (cmd == "empty") {
@@ -92,6 +130,49 @@ int main() {
         } else if (cmd == "print") {
             std::cout << "队列内容: ";
             printQueue(q);
+        } else if (cmd == "pushn") {
+            int k;
+            if (!(std::cin >> k) || k < 0) {
+                std::cout << "输入有误。用法: pushn <k> <值...>\n";
+                clearInput();
+                continue;
+            }
+            std::vector<int> vals(k);
+            bool ok = true;
+            for (int i = 0; i < k && ok; ++i)
+                ok = static_cast<bool>(std::cin >> vals[i]);
+            if (!ok) {
+                std::cout << "输入有误。用法: pushn <k> <值...>\n";
+                clearInput();
+                continue;
+            }
+            q.push_n(vals.begin(), vals.end());
+            std::cout << "已批量入队 " << k << " 个元素。\n";
+        } else if (cmd == "popn") {
+            int k;
+            if (!(std::cin >> k) || k < 0) {
+                std::cout << "输入有误。用法: popn <k>\n";
+                clearInput();
+                continue;
+            }
+            std::vector<int> out(k > 0 ? k : 1);
+            int got = q.pop_n(&out[0], k);
+            std::cout << "已批量出队 " << got << " 个元素: ";
+            for (int i = 0; i < got; ++i) std::cout << out[i] << " ";
+            std::cout << "\n";
+        } else if (cmd == "drain") {
+            std::cout << "取出: ";
+            int got = q.drain([](const int& x) { std::cout << x << " "; });
+            std::cout << "\n共 " << got << " 个元素。\n";
+        } else if (cmd == "bench") {
+            int n;
+            if (!(std::cin >> n) || n <= 0) {
+                std::cout << "输入有误。用法: bench <次数>\n";
+                clearInput();
+                continue;
+            }
+            std::cout << "入队出队 " << n << " 个元素，批大小 256：\n";
+            benchQueue(n, 256);
         } else if (cmd == "help") {
             printMenu();
         } else if (cmd == "exit" || cmd == "0") {
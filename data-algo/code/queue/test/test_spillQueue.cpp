@@ -0,0 +1,185 @@
+#include "../include/queue.hpp"
+#include "../include/spillQueue.hpp"
+#include <chrono>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+void printMenu() {
+    std::cout << "\n====== 磁盘溢出队列交互测试菜单 ======\n";
+    std::cout << "（默认每段8个int、内存预算4段，段文件写入当前目录）\n";
+    std::cout << "命令列表：\n";
+    std::cout << "  push <值>                    : 入队\n";
+    std::cout << "  pushn <个数>                 : 依次入队若干个递增的值\n";
+    std::cout << "  pop                          : 出队\n";
+    std::cout << "  popn <个数>                  : 批量出队并打印\n";
+    std::cout << "  peek                         : 查看队首\n";
+    std::cout << "  stats                        : 元素个数、内存占用、磁盘段数与读写字节数\n";
+    std::cout << "  config <预算字节> <段字节>    : 按新配置重建队列\n";
+    std::cout << "  clear                        : 清空并删除段文件\n";
+    std::cout << "  bench <元素数> <预算KB> <段KB> : 持续积压场景下与 Queue 对比吞吐\n";
+    std::cout << "  help                         : 显示菜单\n";
+    std::cout << "  exit / 0                     : 退出程序\n";
+    std::cout << "-----------------------------------\n";
+    std::cout << "请输入命令: ";
+}
+
+void clearInput() {
+    std::cin.clear();
+    std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+}
+
+template<typename T>
+void printStats(const SpillQueue<T>& q) {
+    std::cout << "元素个数: " << q.size() << "，每段 " << q.segmentSize() << " 个，内存占用: " << q.memoryBytes()
+              << " 字节，磁盘段: " << q.spilledSegments() << "，累计写入 " << q.totalBytesWritten()
+              << " 字节，读回 " << q.totalBytesRead() << " 字节\n";
+}
+
+// 计时工具：执行f并返回耗时（毫秒）
+template<typename F>
+double timeIt(F f) {
+    auto start = std::chrono::steady_clock::now();
+    f();
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+// 一条 64 字节的消息记录
+struct Record {
+    long long id;
+    long long payload[7];
+};
+
+// 持续积压：生产速度是消费速度的两倍，直到全部入队，然后排空。
+// 返回校验和，同时记录积压峰值
+template<typename Q>
+long long runBacklog(Q& q, long long n, long long& peak) {
+    long long produced = 0, checksum = 0;
+    peak = 0;
+    Record r = Record();
+    while (produced < n || !q.empty()) {
+        for (int k = 0; k < 2 && produced < n; ++k) {
+            r.id = produced++;
+            q.push(r);
+        }
+        if (static_cast<long long>(q.size()) > peak) peak = static_cast<long long>(q.size());
+        if (!q.empty()) {
+            checksum += q.peek().id;
+            q.pop();
+        }
+    }
+    return checksum;
+}
+
+void bench(long long n, size_t budgetKB, size_t segmentKB) {
+    long long peakMem = 0, peakSpill = 0, c1 = 0, c2 = 0;
+    double tMem = timeIt([&]() {
+        Queue<Record> q;
+        c1 = runBacklog(q, n, peakMem);
+    });
+    unsigned long long written = 0, read = 0;
+    double tSpill = timeIt([&]() {
+        SpillQueue<Record> q(budgetKB * 1024, ".", segmentKB * 1024);
+        c2 = runBacklog(q, n, peakSpill);
+        written = q.totalBytesWritten();
+        read = q.totalBytesRead();
+    });
+    double mb = static_cast<double>(n) * sizeof(Record) / (1024.0 * 1024.0);
+    std::cout << "  " << n << " 条 64 字节记录（" << mb << " MB），积压峰值 " << peakMem << " 条（"
+              << peakMem * static_cast<double>(sizeof(Record)) / (1024.0 * 1024.0) << " MB）\n";
+    std::cout << "  Queue（全部在内存）: " << tMem << " ms，" << mb / tMem * 1000.0 << " MB/s\n";
+    std::cout << "  SpillQueue（预算 " << budgetKB << " KB，段 " << segmentKB << " KB）: " << tSpill << " ms，"
+              << mb / tSpill * 1000.0 << " MB/s，写盘 " << written / (1024.0 * 1024.0) << " MB，读回 "
+              << read / (1024.0 * 1024.0) << " MB" << (c1 == c2 && peakMem == peakSpill ? "" : "（结果不一致！）") << "\n";
+}
+
+int main() {
+#ifdef _WIN32
+    SetConsoleOutputCP(CP_UTF8);
+    SetConsoleCP(CP_UTF8);
+#endif
+    std::unique_ptr<SpillQueue<int> > q(new SpillQueue<int>(4 * 8 * sizeof(int), ".", 8 * sizeof(int)));
+    int nextValue = 0;
+    std::string cmd;
+    printMenu();
+    while (true) {
+        std::cout << "> ";
+        if (!(std::cin >> cmd)) break;
+        try {
+            if (cmd == "push") {
+                int v;
+                if (!(std::cin >> v)) {
+                    std::cout << "输入有误。用法: push <值>\n";
+                    clearInput();
+                    continue;
+                }
+                q->push(v);
+                std::cout << "已入队 " << v << "，磁盘段: " << q->spilledSegments() << "\n";
+            } else if (cmd == "pushn" || cmd == "popn") {
+                int n;
+                if (!(std::cin >> n) || n < 0) {
+                    std::cout << "输入有误。用法: " << cmd << " <个数>\n";
+                    clearInput();
+                    continue;
+                }
+                if (cmd == "pushn") {
+                    for (int i = 0; i < n; ++i) q->push(nextValue++);
+                    std::cout << "已入队 " << n << " 个，";
+                    printStats(*q);
+                } else {
+                    std::vector<int> out(n);
+                    size_t got = q->pop_n(out.data(), out.size());
+                    for (size_t i = 0; i < got; ++i) std::cout << out[i] << " ";
+                    std::cout << "\n共出队 " << got << " 个。\n";
+                }
+            } else if (cmd == "pop") {
+                int v = q->peek();
+                q->pop();
+                std::cout << "出队: " << v << "\n";
+            } else if (cmd == "peek") {
+                std::cout << "队首: " << q->peek() << "\n";
+            } else if (cmd == "stats") {
+                printStats(*q);
+            } else if (cmd == "config") {
+                size_t budget, segment;
+                if (!(std::cin >> budget >> segment) || segment == 0) {
+                    std::cout << "输入有误。用法: config <预算字节> <段字节>\n";
+                    clearInput();
+                    continue;
+                }
+                q.reset(new SpillQueue<int>(budget, ".", segment));
+                nextValue = 0;
+                std::cout << "已重建队列，每段 " << q->segmentSize() << " 个。\n";
+            } else if (cmd == "clear") {
+                q->clear();
+                std::cout << "已清空。\n";
+            } else if (cmd == "bench") {
+                long long n;
+                size_t budgetKB, segmentKB;
+                if (!(std::cin >> n >> budgetKB >> segmentKB) || n <= 0 || segmentKB == 0) {
+                    std::cout << "输入有误。用法: bench <元素数> <预算KB> <段KB>\n";
+                    clearInput();
+                    continue;
+                }
+                bench(n, budgetKB, segmentKB);
+            } else if (cmd == "help") {
+                printMenu();
+            } else if (cmd == "exit" || cmd == "0") {
+                std::cout << "程序结束，再见！\n";
+                break;
+            } else {
+                std::cout << "未知命令。输入 help 查看菜单。\n";
+            }
+        } catch (const std::exception& e) {
+            std::cout << "错误: " << e.what() << "\n";
+        }
+        clearInput();
+    }
+    return 0;
+}
@@ -0,0 +1,367 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <new>
+#include <vector>
+
+/**
+ * @brief 并发跳表节点，塔指针为原子指针
+ *
+ * 键和值在节点发布后不再修改，读者可以不加锁读取。
+ *
+ * @tparam K 键类型
+ * @tparam V 值类型
+ */
+template<typename K, typename V>
+struct ConcurrentSkipNode {
+    const K key;                              ///< 键
+    const V value;                            ///< 值（发布后只读）
+    const int level;                          ///< 塔高
+    std::atomic<ConcurrentSkipNode*>* next;   ///< 各层后继，指向节点尾部的原子指针数组
+
+    static ConcurrentSkipNode* create(const K& key, const V& value, int level);
+    static void destroy(ConcurrentSkipNode* node);
+
+private:
+    ConcurrentSkipNode(const K& k, const V& v, int lv) : key(k), value(v), level(lv), next(nullptr) {}
+};
+
+/**
+ * @brief 读无锁的并发跳表
+ *
+ * - 写者（insert/erase/clear）之间用一把互斥锁串行化
+ * - 读者（find/contains/range）不加锁，只用 acquire 读取塔指针；
+ *   新节点先填好自身各层后继，再自底向上以 release 写入前驱，读者看到的总是完整节点
+ * - 删除的节点从各层摘下后按纪元进入待回收列表。读者进入时登记在当前纪元的计数上；
+ *   写者发现上一纪元的读者都已离开时推进纪元，并释放再早一个纪元摘下的节点。
+ *   正在遍历的读者不会访问到已释放的内存，读者持续不断时回收也只推迟一到两个纪元
+ *
+ * 值在插入后只读，要修改某个键的值需先 erase 再 insert。
+ *
+ * @tparam K 键类型
+ * @tparam V 值类型
+ * @tparam Compare 键的严格弱序比较器
+ */
+template<typename K, typename V, typename Compare = std::less<K>>
+class ConcurrentSkipList {
+public:
+    typedef ConcurrentSkipNode<K, V> Node;
+
+    static const int MAX_LEVEL = 32;   ///< 最大塔高
+
+private:
+    Node* head;                          ///< 头结点，塔高为 MAX_LEVEL
+    std::atomic<int> level;              ///< 当前最高层数
+    std::atomic<int> length;             ///< 元素个数
+    std::atomic<unsigned> epoch;         ///< 当前纪元
+    mutable std::atomic<int> readers[2]; ///< 按纪元奇偶登记的活跃读者数
+    std::mutex writeMutex;               ///< 串行化写者
+    std::vector<Node*> retired[2];       ///< 按纪元奇偶存放已摘下、等待回收的节点（受 writeMutex 保护）
+    uint64_t seed;                       ///< 随机层数生成器状态（受 writeMutex 保护）
+    Compare less;                        ///< 键比较器
+
+    /// 读者登记：在当前纪元的计数上加一，登记后纪元已变化则重试，离开时减一
+    struct ReadGuard {
+        const ConcurrentSkipList& list;
+        unsigned slot;
+        explicit ReadGuard(const ConcurrentSkipList& l) : list(l) {
+            while (true) {
+                unsigned e = list.epoch.load(std::memory_order_acquire);
+                slot = e & 1;
+                list.readers[slot].fetch_add(1);
+                std::atomic_thread_fence(std::memory_order_seq_cst);   // 与 reclaim() 中的栅栏配对
+                if (list.epoch.load(std::memory_order_acquire) == e)
+                    return;
+                list.readers[slot].fetch_sub(1, std::memory_order_release);
+            }
+        }
+        ~ReadGuard() { list.readers[slot].fetch_sub(1, std::memory_order_release); }
+    };
+
+    int randomLevel();
+    Node* findGreaterOrEqual(const K& key, Node** update) const;
+    bool equal(const K& a, const K& b) const { return !less(a, b) && !less(b, a); }
+    void reclaim();
+
+public:
+    /**
+     * @brief 构造函数，初始化空跳表
+     * @param compare 比较器
+     */
+    explicit ConcurrentSkipList(const Compare& compare = Compare());
+
+    /**
+     * @brief 析构函数，释放所有节点。调用时不得有其他线程访问
+     */
+    ~ConcurrentSkipList();
+
+    ConcurrentSkipList(const ConcurrentSkipList&) = delete;
+    ConcurrentSkipList& operator=(const ConcurrentSkipList&) = delete;
+
+    /**
+     * @brief 插入键值对，键已存在时不修改，期望 O(log n)
+     * @param key 键
+     * @param value 值
+     * @return 插入成功返回true，键已存在返回false
+     */
+    bool insert(const K& key, const V& value);
+
+    /**
+     * @brief 删除键，期望 O(log n)
+     * @param key 键
+     * @return 删除成功返回true，键不存在返回false
+     */
+    bool erase(const K& key);
+
+    /**
+     * @brief 删除所有元素
+     */
+    void clear();
+
+    /**
+     * @brief 无锁查找
+     * @param key 键
+     * @param out 找到时写入值的拷贝
+     * @return 找到返回true
+     */
+    bool find(const K& key, V& out) const;
+
+    /**
+     * @brief 无锁判断键是否存在
+     * @param key 键
+     * @return 存在返回true
+     */
+    bool contains(const K& key) const;
+
+    /**
+     * @brief 无锁按键升序访问 [lo, hi) 内的元素。并发写入时看到的是扫描过程中逐步变化的状态
+     * @param lo 下界（含）
+     * @param hi 上界（不含）
+     * @param visit 回调 visit(key, value)
+     * @return 访问的元素个数
+     */
+    template<typename F>
+    int range(const K& lo, const K& hi, F visit) const;
+
+    /**
+     * @brief 获取元素个数
+     * @return 元素个数
+     */
+    int size() const { return length.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief 判断是否为空
+     * @return 为空返回true
+     */
+    bool empty() const { return size() == 0; }
+
+    /**
+     * @brief 等待回收的节点数
+     * @return 节点数
+     */
+    int retiredCount();
+};
+
+// ================== 实现部分 ==================
+
+// 节点与原子指针数组一次分配
+template<typename K, typename V>
+ConcurrentSkipNode<K, V>* ConcurrentSkipNode<K, V>::create(const K& key, const V& value, int level) {
+    void* raw = ::operator new(sizeof(ConcurrentSkipNode) + sizeof(std::atomic<ConcurrentSkipNode*>) * level);
+    ConcurrentSkipNode* node;
+    try {
+        node = ::new (raw) ConcurrentSkipNode(key, value, level);
+    } catch (...) {
+        ::operator delete(raw);
+        throw;
+    }
+    std::atomic<ConcurrentSkipNode*>* links = reinterpret_cast<std::atomic<ConcurrentSkipNode*>*>(
+        reinterpret_cast<char*>(raw) + sizeof(ConcurrentSkipNode));
+    for (int i = 0; i < level; ++i)
+        ::new (static_cast<void*>(links + i)) std::atomic<ConcurrentSkipNode*>(nullptr);
+    node->next = links;
+    return node;
+}
+
+// 析构节点并释放整块内存（原子指针可平凡析构）
+template<typename K, typename V>
+void ConcurrentSkipNode<K, V>::destroy(ConcurrentSkipNode* node) {
+    node->~ConcurrentSkipNode();
+    ::operator delete(node);
+}
+
+// 构造函数
+template<typename K, typename V, typename Compare>
+ConcurrentSkipList<K, V, Compare>::ConcurrentSkipList(const Compare& compare)
+    : head(Node::create(K(), V(), MAX_LEVEL)), level(1), length(0), epoch(0),
+      seed(0x9E3779B97F4A7C15ULL), less(compare) {
+    readers[0].store(0);
+    readers[1].store(0);
+}
+
+// 析构函数：释放链上节点、待回收节点与头结点
+template<typename K, typename V, typename Compare>
+ConcurrentSkipList<K, V, Compare>::~ConcurrentSkipList() {
+    Node* p = head->next[0].load(std::memory_order_relaxed);
+    while (p != nullptr) {
+        Node* next = p->next[0].load(std::memory_order_relaxed);
+        Node::destroy(p);
+        p = next;
+    }
+    for (int k = 0; k < 2; ++k) {
+        for (size_t i = 0; i < retired[k].size(); ++i)
+            Node::destroy(retired[k][i]);
+    }
+    Node::destroy(head);
+}
+
+// 随机层数，与 SkipList 相同的 1/4 几何分布
+template<typename K, typename V, typename Compare>
+int ConcurrentSkipList<K, V, Compare>::randomLevel() {
+    seed ^= seed << 13;
+    seed ^= seed >> 7;
+    seed ^= seed << 17;
+    uint64_t bits = seed;
+    int lv = 1;
+    while (lv < MAX_LEVEL && (bits & 3) == 0) {
+        ++lv;
+        bits >>= 2;
+    }
+    return lv;
+}
+
+// 自顶向下查找，读者与写者共用；所有塔指针均以 acquire 读取
+template<typename K, typename V, typename Compare>
+typename ConcurrentSkipList<K, V, Compare>::Node*
+ConcurrentSkipList<K, V, Compare>::findGreaterOrEqual(const K& key, Node** update) const {
+    Node* p = head;
+    for (int i = level.load(std::memory_order_acquire) - 1; i >= 0; --i) {
+        Node* next = p->next[i].load(std::memory_order_acquire);
+        while (next != nullptr && less(next->key, key)) {
+            p = next;
+            next = p->next[i].load(std::memory_order_acquire);
+        }
+        if (update != nullptr)
+            update[i] = p;
+    }
+    return p->next[0].load(std::memory_order_acquire);
+}
+
+// 插入：先写好新节点的各层后继，再自底向上发布
+template<typename K, typename V, typename Compare>
+bool ConcurrentSkipList<K, V, Compare>::insert(const K& key, const V& value) {
+    std::lock_guard<std::mutex> lock(writeMutex);
+    Node* update[MAX_LEVEL];
+    Node* found = findGreaterOrEqual(key, update);
+    if (found != nullptr && equal(found->key, key))
+        return false;
+    int lv = randomLevel();
+    int top = level.load(std::memory_order_relaxed);
+    for (int i = top; i < lv; ++i)
+        update[i] = head;
+    Node* node = Node::create(key, value, lv);
+    for (int i = 0; i < lv; ++i)
+        node->next[i].store(update[i]->next[i].load(std::memory_order_relaxed), std::memory_order_relaxed);
+    for (int i = 0; i < lv; ++i)
+        update[i]->next[i].store(node, std::memory_order_release);
+    if (lv > top)
+        level.store(lv, std::memory_order_release);
+    length.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+// 删除：自顶向下摘除，节点本身的后继保持不变，正在其上的读者仍可继续前进
+template<typename K, typename V, typename Compare>
+bool ConcurrentSkipList<K, V, Compare>::erase(const K& key) {
+    std::lock_guard<std::mutex> lock(writeMutex);
+    Node* update[MAX_LEVEL];
+    Node* node = findGreaterOrEqual(key, update);
+    if (node == nullptr || !equal(node->key, key))
+        return false;
+    for (int i = node->level - 1; i >= 0; --i)
+        update[i]->next[i].store(node->next[i].load(std::memory_order_relaxed), std::memory_order_release);
+    int top = level.load(std::memory_order_relaxed);
+    while (top > 1 && head->next[top - 1].load(std::memory_order_relaxed) == nullptr)
+        --top;
+    level.store(top, std::memory_order_release);
+    length.fetch_sub(1, std::memory_order_relaxed);
+    retired[epoch.load(std::memory_order_relaxed) & 1].push_back(node);
+    reclaim();
+    return true;
+}
+
+// 清空：头结点各层置空后，所有节点进入待回收列表
+template<typename K, typename V, typename Compare>
+void ConcurrentSkipList<K, V, Compare>::clear() {
+    std::lock_guard<std::mutex> lock(writeMutex);
+    Node* p = head->next[0].load(std::memory_order_relaxed);
+    for (int i = MAX_LEVEL - 1; i >= 0; --i)
+        head->next[i].store(nullptr, std::memory_order_release);
+    level.store(1, std::memory_order_release);
+    length.store(0, std::memory_order_relaxed);
+    std::vector<Node*>& bucket = retired[epoch.load(std::memory_order_relaxed) & 1];
+    while (p != nullptr) {
+        bucket.push_back(p);
+        p = p->next[0].load(std::memory_order_relaxed);
+    }
+    reclaim();
+}
+
+// 尝试推进纪元 E -> E+1：需要纪元 E-1（与 E+1 同奇偶）登记的读者都已离开。
+// 纪元 E-1 中摘下的节点在推进到 E 之前就已不可达，E 及之后进入的读者看不到它们，
+// 此时可以释放，该奇偶的列表随即留给纪元 E+1 使用。
+// 全序栅栏与读者登记后的栅栏配对，保证不会漏看刚进入的读者
+template<typename K, typename V, typename Compare>
+void ConcurrentSkipList<K, V, Compare>::reclaim() {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    unsigned e = epoch.load(std::memory_order_relaxed);
+    unsigned old = (e + 1) & 1;
+    if (readers[old].load(std::memory_order_acquire) != 0)
+        return;
+    for (size_t i = 0; i < retired[old].size(); ++i)
+        Node::destroy(retired[old][i]);
+    retired[old].clear();
+    epoch.store(e + 1, std::memory_order_release);
+}
+
+// 无锁查找
+template<typename K, typename V, typename Compare>
+bool ConcurrentSkipList<K, V, Compare>::find(const K& key, V& out) const {
+    ReadGuard guard(*this);
+    Node* node = findGreaterOrEqual(key, nullptr);
+    if (node == nullptr || !equal(node->key, key))
+        return false;
+    out = node->value;
+    return true;
+}
+
+// 无锁判断存在
+template<typename K, typename V, typename Compare>
+bool ConcurrentSkipList<K, V, Compare>::contains(const K& key) const {
+    ReadGuard guard(*this);
+    Node* node = findGreaterOrEqual(key, nullptr);
+    return node != nullptr && equal(node->key, key);
+}
+
+// 无锁区间扫描
+template<typename K, typename V, typename Compare>
+template<typename F>
+int ConcurrentSkipList<K, V, Compare>::range(const K& lo, const K& hi, F visit) const {
+    ReadGuard guard(*this);
+    int n = 0;
+    for (Node* p = findGreaterOrEqual(lo, nullptr); p != nullptr && less(p->key, hi);
+         p = p->next[0].load(std::memory_order_acquire)) {
+        visit(p->key, p->value);
+        ++n;
+    }
+    return n;
+}
+
+// 等待回收的节点数
+template<typename K, typename V, typename Compare>
+int ConcurrentSkipList<K, V, Compare>::retiredCount() {
+    std::lock_guard<std::mutex> lock(writeMutex);
+    return static_cast<int>(retired[0].size() + retired[1].size());
+}
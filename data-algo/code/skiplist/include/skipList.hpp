@@ -0,0 +1,427 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+/**
+ * @brief 跳表节点模板结构体
+ *
+ * 在单链表节点（LinkNode）的基础上，把单个 next 指针扩展为一列“塔”指针：
+ * next[0] 串起全部节点，next[i] 只串起层数大于 i 的节点。
+ * 指针数组紧跟在节点之后一次分配，塔高由 level 记录。
+ *
+ * @tparam K 键类型
+ * @tparam V 值类型
+ */
+template<typename K, typename V>
+struct SkipNode {
+    K key;                  ///< 键
+    V value;                ///< 值
+    int level;              ///< 塔高（指针个数）
+    SkipNode** next;        ///< 各层后继指针，指向节点尾部的指针数组
+
+    /**
+     * @brief 分配并构造一个塔高为 level 的节点，各层后继为空
+     * @param key 键
+     * @param value 值
+     * @param level 塔高
+     * @return 新节点
+     */
+    static SkipNode* create(const K& key, const V& value, int level);
+
+    /**
+     * @brief 析构并释放 create 分配的节点
+     * @param node 节点
+     */
+    static void destroy(SkipNode* node);
+
+private:
+    SkipNode(const K& k, const V& v, int lv) : key(k), value(v), level(lv), next(nullptr) {}
+};
+
+/**
+ * @brief 跳表（有序映射）模板类
+ *
+ * 每个节点以 1/4 的概率多长一层，期望塔高 4/3，查找、插入、删除期望 O(log n)。
+ * 最底层即按键有序的单链表，可从任意位置开始顺序扫描。
+ *
+ * @tparam K 键类型
+ * @tparam V 值类型
+ * @tparam Compare 键的严格弱序比较器，默认 std::less<K>
+ */
+template<typename K, typename V, typename Compare = std::less<K>>
+class SkipList {
+public:
+    typedef SkipNode<K, V> Node;
+
+    static const int MAX_LEVEL = 32;   ///< 最大塔高，足以支撑 4^32 个元素
+
+    /**
+     * @brief 顺序迭代器，沿最底层前进
+     */
+    class Iterator {
+    public:
+        Iterator() : node(nullptr) {}
+        const K& key() const { return node->key; }
+        V& value() const { return node->value; }
+        int level() const { return node->level; }   ///< 当前节点的塔高
+        Iterator& operator++() { node = node->next[0]; return *this; }
+        bool operator==(const Iterator& other) const { return node == other.node; }
+        bool operator!=(const Iterator& other) const { return node != other.node; }
+
+    private:
+        friend class SkipList;
+        explicit Iterator(Node* n) : node(n) {}
+        Node* node;
+    };
+
+private:
+    Node* head;            ///< 头结点（哨兵），塔高为 MAX_LEVEL
+    int level;             ///< 当前最高层数
+    int length;            ///< 元素个数
+    uint64_t seed;         ///< 随机层数生成器状态
+    Compare less;          ///< 键比较器
+
+    int randomLevel();
+    Node* findGreaterOrEqual(const K& key, Node** update) const;
+    bool equal(const K& a, const K& b) const { return !less(a, b) && !less(b, a); }
+
+public:
+    /**
+     * @brief 构造函数，初始化空跳表
+     * @param compare 比较器
+     */
+    explicit SkipList(const Compare& compare = Compare());
+
+    /**
+     * @brief 拷贝构造函数，按顺序逐个追加，O(n)
+     * @param other 被拷贝的跳表
+     */
+    SkipList(const SkipList& other);
+
+    /**
+     * @brief 移动构造函数，与一个新的空表交换，O(1)
+     * @param other 被移动的跳表，之后为空表
+     */
+    SkipList(SkipList&& other);
+
+    /**
+     * @brief 赋值操作符（拷贝并交换）
+     * @param other 被赋值的跳表
+     * @return 当前对象的引用
+     */
+    SkipList& operator=(SkipList other) noexcept;
+
+    /**
+     * @brief 析构函数，释放所有节点
+     */
+    ~SkipList();
+
+    /**
+     * @brief 插入键值对，键已存在时更新值，期望 O(log n)
+     * @param key 键
+     * @param value 值
+     * @return 新插入返回true，更新返回false
+     */
+    bool insert(const K& key, const V& value);
+
+    /**
+     * @brief 查找键，期望 O(log n)
+     * @param key 键
+     * @return 指向值的指针，不存在返回nullptr
+     */
+    V* find(const K& key);
+    const V* find(const K& key) const;
+
+    /**
+     * @brief 判断键是否存在
+     * @param key 键
+     * @return 存在返回true
+     */
+    bool contains(const K& key) const { return find(key) != nullptr; }
+
+    /**
+     * @brief 获取键对应的值
+     * @param key 键
+     * @return 值的引用
+     * @throws std::out_of_range 如果键不存在
+     */
+    V& at(const K& key);
+
+    /**
+     * @brief 删除键，期望 O(log n)
+     * @param key 键
+     * @return 删除成功返回true，键不存在返回false
+     */
+    bool erase(const K& key);
+
+    /**
+     * @brief 清空跳表
+     */
+    void clear();
+
+    /**
+     * @brief 获取元素个数
+     * @return 元素个数
+     */
+    int size() const { return length; }
+
+    /**
+     * @brief 判断是否为空
+     * @return 为空返回true
+     */
+    bool empty() const { return length == 0; }
+
+    /**
+     * @brief 当前最高层数
+     * @return 层数
+     */
+    int height() const { return level; }
+
+    /**
+     * @brief 第一个键不小于 key 的位置，期望 O(log n)
+     * @param key 键
+     * @return 迭代器，不存在时等于 end()
+     */
+    Iterator lowerBound(const K& key) const;
+
+    Iterator begin() const { return Iterator(head->next[0]); }
+    Iterator end() const { return Iterator(nullptr); }
+
+    /**
+     * @brief 按键升序访问 [lo, hi) 内的元素
+     * @param lo 下界（含）
+     * @param hi 上界（不含）
+     * @param visit 回调 visit(key, value)
+     * @return 访问的元素个数
+     */
+    template<typename F>
+    int range(const K& lo, const K& hi, F visit) const;
+
+    /**
+     * @brief 按键升序遍历全部元素
+     * @param visit 访问函数
+     */
+    void traverse(void (*visit)(const K&, const V&)) const;
+
+    /**
+     * @brief 交换两个跳表
+     * @param other 另一个跳表
+     */
+    void swap(SkipList& other) noexcept;
+};
+
+// ================== 实现部分 ==================
+
+// 节点与其塔指针数组一次分配，指针数组紧随节点之后
+template<typename K, typename V>
+SkipNode<K, V>* SkipNode<K, V>::create(const K& key, const V& value, int level) {
+    void* raw = ::operator new(sizeof(SkipNode) + sizeof(SkipNode*) * level);
+    SkipNode* node;
+    try {
+        node = ::new (raw) SkipNode(key, value, level);
+    } catch (...) {
+        ::operator delete(raw);
+        throw;
+    }
+    node->next = reinterpret_cast<SkipNode**>(reinterpret_cast<char*>(raw) + sizeof(SkipNode));
+    for (int i = 0; i < level; ++i)
+        node->next[i] = nullptr;
+    return node;
+}
+
+// 析构节点并释放整块内存
+template<typename K, typename V>
+void SkipNode<K, V>::destroy(SkipNode* node) {
+    node->~SkipNode();
+    ::operator delete(node);
+}
+
+// 构造函数，头结点占满所有层
+template<typename K, typename V, typename Compare>
+SkipList<K, V, Compare>::SkipList(const Compare& compare)
+    : head(Node::create(K(), V(), MAX_LEVEL)), level(1), length(0),
+      seed(0x9E3779B97F4A7C15ULL), less(compare) {}
+
+// 拷贝构造：源表已有序，逐个接到各层尾部，不需要查找
+template<typename K, typename V, typename Compare>
+SkipList<K, V, Compare>::SkipList(const SkipList& other) : SkipList(other.less) {
+    Node* tail[MAX_LEVEL];
+    for (int i = 0; i < MAX_LEVEL; ++i)
+        tail[i] = head;
+    for (Node* p = other.head->next[0]; p != nullptr; p = p->next[0]) {
+        Node* node = Node::create(p->key, p->value, p->level);
+        for (int i = 0; i < p->level; ++i) {
+            tail[i]->next[i] = node;
+            tail[i] = node;
+        }
+        ++length;
+    }
+    level = other.level;
+}
+
+// 移动构造：先建空表再交换，源表保留一个可继续使用的空头结点
+template<typename K, typename V, typename Compare>
+SkipList<K, V, Compare>::SkipList(SkipList&& other) : SkipList(other.less) {
+    swap(other);
+}
+
+// 赋值：参数按值传入后交换
+template<typename K, typename V, typename Compare>
+SkipList<K, V, Compare>& SkipList<K, V, Compare>::operator=(SkipList other) noexcept {
+    swap(other);
+    return *this;
+}
+
+// 析构函数，释放所有节点与头结点
+template<typename K, typename V, typename Compare>
+SkipList<K, V, Compare>::~SkipList() {
+    clear();
+    Node::destroy(head);
+}
+
+// 随机层数：xorshift 生成随机数，每两位为0的概率为1/4时多长一层
+template<typename K, typename V, typename Compare>
+int SkipList<K, V, Compare>::randomLevel() {
+    seed ^= seed << 13;
+    seed ^= seed >> 7;
+    seed ^= seed << 17;
+    uint64_t bits = seed;
+    int lv = 1;
+    while (lv < MAX_LEVEL && (bits & 3) == 0) {
+        ++lv;
+        bits >>= 2;
+    }
+    return lv;
+}
+
+// 自顶向下查找，update[i] 记录第 i 层最后一个小于 key 的节点
+template<typename K, typename V, typename Compare>
+typename SkipList<K, V, Compare>::Node*
+SkipList<K, V, Compare>::findGreaterOrEqual(const K& key, Node** update) const {
+    Node* p = head;
+    for (int i = level - 1; i >= 0; --i) {
+        while (p->next[i] != nullptr && less(p->next[i]->key, key))
+            p = p->next[i];
+        if (update != nullptr)
+            update[i] = p;
+    }
+    return p->next[0];
+}
+
+// 插入或更新
+template<typename K, typename V, typename Compare>
+bool SkipList<K, V, Compare>::insert(const K& key, const V& value) {
+    Node* update[MAX_LEVEL];
+    Node* found = findGreaterOrEqual(key, update);
+    if (found != nullptr && equal(found->key, key)) {
+        found->value = value;
+        return false;
+    }
+    int lv = randomLevel();
+    if (lv > level) {
+        for (int i = level; i < lv; ++i)
+            update[i] = head;
+    }
+    Node* node = Node::create(key, value, lv);
+    if (lv > level)
+        level = lv;
+    for (int i = 0; i < lv; ++i) {
+        node->next[i] = update[i]->next[i];
+        update[i]->next[i] = node;
+    }
+    ++length;
+    return true;
+}
+
+// 查找
+template<typename K, typename V, typename Compare>
+V* SkipList<K, V, Compare>::find(const K& key) {
+    Node* node = findGreaterOrEqual(key, nullptr);
+    return (node != nullptr && equal(node->key, key)) ? &node->value : nullptr;
+}
+
+// 查找（只读）
+template<typename K, typename V, typename Compare>
+const V* SkipList<K, V, Compare>::find(const K& key) const {
+    Node* node = findGreaterOrEqual(key, nullptr);
+    return (node != nullptr && equal(node->key, key)) ? &node->value : nullptr;
+}
+
+// 获取值，不存在时抛出异常
+template<typename K, typename V, typename Compare>
+V& SkipList<K, V, Compare>::at(const K& key) {
+    V* value = find(key);
+    if (value == nullptr)
+        throw std::out_of_range("Key not found");
+    return *value;
+}
+
+// 删除：在各层把前驱接到被删节点的后继上，并降低空出的层
+template<typename K, typename V, typename Compare>
+bool SkipList<K, V, Compare>::erase(const K& key) {
+    Node* update[MAX_LEVEL];
+    Node* node = findGreaterOrEqual(key, update);
+    if (node == nullptr || !equal(node->key, key))
+        return false;
+    for (int i = 0; i < node->level; ++i)
+        update[i]->next[i] = node->next[i];
+    Node::destroy(node);
+    while (level > 1 && head->next[level - 1] == nullptr)
+        --level;
+    --length;
+    return true;
+}
+
+// 清空：沿最底层逐个释放
+template<typename K, typename V, typename Compare>
+void SkipList<K, V, Compare>::clear() {
+    Node* p = head->next[0];
+    while (p != nullptr) {
+        Node* next = p->next[0];
+        Node::destroy(p);
+        p = next;
+    }
+    for (int i = 0; i < MAX_LEVEL; ++i)
+        head->next[i] = nullptr;
+    level = 1;
+    length = 0;
+}
+
+// 第一个不小于 key 的位置
+template<typename K, typename V, typename Compare>
+typename SkipList<K, V, Compare>::Iterator SkipList<K, V, Compare>::lowerBound(const K& key) const {
+    return Iterator(findGreaterOrEqual(key, nullptr));
+}
+
+// 区间扫描：定位下界后沿最底层前进
+template<typename K, typename V, typename Compare>
+template<typename F>
+int SkipList<K, V, Compare>::range(const K& lo, const K& hi, F visit) const {
+    int n = 0;
+    for (Node* p = findGreaterOrEqual(lo, nullptr); p != nullptr && less(p->key, hi); p = p->next[0]) {
+        visit(p->key, p->value);
+        ++n;
+    }
+    return n;
+}
+
+// 按键升序遍历
+template<typename K, typename V, typename Compare>
+void SkipList<K, V, Compare>::traverse(void (*visit)(const K&, const V&)) const {
+    for (Node* p = head->next[0]; p != nullptr; p = p->next[0])
+        visit(p->key, p->value);
+}
+
+// 交换两个跳表
+template<typename K, typename V, typename Compare>
+void SkipList<K, V, Compare>::swap(SkipList& other) noexcept {
+    std::swap(head, other.head);
+    std::swap(level, other.level);
+    std::swap(length, other.length);
+    std::swap(seed, other.seed);
+    std::swap(less, other.less);
+}
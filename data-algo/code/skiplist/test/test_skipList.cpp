@@ -0,0 +1,261 @@
+#include "../include/skipList.hpp"
+#include "../include/concurrentSkipList.hpp"
+#include "../../linklist/include/linkList.hpp"
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+void printMenu() {
+    std::cout << "\n====== 跳表交互测试菜单 ======\n";
+    std::cout << "命令列表：\n";
+    std::cout << "  insert <键> <值>          : 插入或更新\n";
+    std::cout << "  find <键>                 : 查找\n";
+    std::cout << "  erase <键>                : 删除\n";
+    std::cout << "  range <下界> <上界>       : 按序列出 [下界,上界) 内的元素\n";
+    std::cout << "  lower <键>                : 第一个不小于键的元素\n";
+    std::cout << "  random <个数> <键上界>    : 插入随机键\n";
+    std::cout << "  print                     : 按序打印全部元素\n";
+    std::cout << "  levels                    : 按层打印塔结构（最多64个元素）\n";
+    std::cout << "  size                      : 元素个数与层数\n";
+    std::cout << "  clear                     : 清空\n";
+    std::cout << "  bench <个数>              : 与 std::map、LinkList 对比查找耗时\n";
+    std::cout << "  concurrent <读线程数> <写操作数> : 并发跳表读写压力测试\n";
+    std::cout << "  help                      : 显示菜单\n";
+    std::cout << "  exit / 0                  : 退出程序\n";
+    std::cout << "-----------------------------------\n";
+    std::cout << "请输入命令: ";
+}
+
+void clearInput() {
+    std::cin.clear();
+    std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+}
+
+void printPair(const int& key, const int& value) {
+    std::cout << key << ":" << value << " ";
+}
+
+// 逐层打印：第 i 层只列出塔高大于 i 的节点
+void printLevels(const SkipList<int, int>& list) {
+    std::vector<std::pair<int, int> > nodes;   // (键, 塔高)
+    for (SkipList<int, int>::Iterator it = list.begin(); it != list.end() && nodes.size() < 64; ++it)
+        nodes.push_back(std::make_pair(it.key(), it.level()));
+    for (int lv = list.height() - 1; lv >= 0; --lv) {
+        std::cout << "L" << lv << ": head";
+        for (size_t i = 0; i < nodes.size(); ++i) {
+            if (nodes[i].second > lv) std::cout << " -> " << nodes[i].first;
+        }
+        std::cout << (list.size() > 64 ? " ...\n" : "\n");
+    }
+}
+
+// 计时工具：执行f并返回耗时（毫秒）
+template<typename F>
+double timeIt(F f) {
+    auto start = std::chrono::steady_clock::now();
+    f();
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+void bench(int n) {
+    std::mt19937 rng(42);
+    std::vector<int> keys(n);
+    for (int i = 0; i < n; ++i) keys[i] = static_cast<int>(rng());
+    SkipList<int, int> skip;
+    std::map<int, int> tree;
+    double tSkipInsert = timeIt([&]() {
+        for (int i = 0; i < n; ++i) skip.insert(keys[i], i);
+    });
+    double tMapInsert = timeIt([&]() {
+        for (int i = 0; i < n; ++i) tree[keys[i]] = i;
+    });
+    long long s1 = 0, s2 = 0;
+    double tSkipFind = timeIt([&]() {
+        for (int i = 0; i < n; ++i) s1 += *skip.find(keys[i]);
+    });
+    double tMapFind = timeIt([&]() {
+        for (int i = 0; i < n; ++i) s2 += tree.find(keys[i])->second;
+    });
+    std::cout << "  插入 " << n << " 个: SkipList " << tSkipInsert << " ms，std::map " << tMapInsert << " ms\n";
+    std::cout << "  查找 " << n << " 次: SkipList " << tSkipFind << " ms，std::map " << tMapFind << " ms"
+              << (s1 == s2 ? "" : "（结果不一致！）") << "\n";
+    // 单链表查找为 O(n)，只取少量元素对比
+    int m = n < 5000 ? n : 5000;
+    LinkList<int> list;
+    for (int i = 0; i < m; ++i) list.insert(0, keys[i]);
+    int probes = 1000;
+    long long found = 0;
+    double tList = timeIt([&]() {
+        for (int i = 0; i < probes; ++i) found += list.find(keys[i % m]) >= 0;
+    });
+    SkipList<int, int> small;
+    for (int i = 0; i < m; ++i) small.insert(keys[i], i);
+    double tSmall = timeIt([&]() {
+        for (int i = 0; i < probes; ++i) found += small.contains(keys[i % m]);
+    });
+    std::cout << "  " << m << " 个元素中查找 " << probes << " 次: LinkList " << tList << " ms，SkipList "
+              << tSmall << " ms\n";
+}
+
+// 一个写线程交替插入/删除，若干读线程无锁查找与区间扫描，检查扫描结果始终有序
+void concurrentTest(int readerCount, int ops) {
+    ConcurrentSkipList<int, int> list;
+    const int keySpace = 4096;
+    std::atomic<bool> done(false);
+    std::atomic<long long> reads(0);
+    std::atomic<bool> ok(true);
+    std::vector<std::thread> readers;
+    for (int r = 0; r < readerCount; ++r) {
+        readers.push_back(std::thread([&, r]() {
+            std::mt19937 rng(r + 1);
+            long long local = 0;
+            while (!done.load()) {
+                int key = static_cast<int>(rng() % keySpace);
+                int value;
+                if (list.find(key, value) && value != key * 2) ok = false;
+                int prev = -1;
+                list.range(key, key + 64, [&](const int& k, const int& v) {
+                    if (k <= prev || v != k * 2) ok = false;
+                    prev = k;
+                });
+                ++local;
+            }
+            reads += local;
+        }));
+    }
+    std::mt19937 rng(99);
+    int inserted = 0, erased = 0;
+    double t = timeIt([&]() {
+        for (int i = 0; i < ops; ++i) {
+            int key = static_cast<int>(rng() % keySpace);
+            if (rng() % 2) inserted += list.insert(key, key * 2);
+            else erased += list.erase(key);
+        }
+    });
+    done = true;
+    for (size_t i = 0; i < readers.size(); ++i) readers[i].join();
+    int count = 0, prev = -1;
+    bool sorted = true;
+    list.range(0, keySpace, [&](const int& k, const int&) {
+        if (k <= prev) sorted = false;
+        prev = k;
+        ++count;
+    });
+    std::cout << "  写操作 " << ops << " 次（插入 " << inserted << "，删除 " << erased << "）耗时 " << t << " ms\n";
+    std::cout << "  读线程共完成 " << reads.load() << " 次查找+扫描，结果" << (ok.load() ? "正确" : "错误！") << "\n";
+    std::cout << "  最终元素 " << list.size() << " 个，扫描得到 " << count << " 个，"
+              << (sorted && count == list.size() ? "有序且一致" : "不一致！")
+              << "，待回收节点 " << list.retiredCount() << " 个\n";
+}
+
+int main() {
+#ifdef _WIN32
+    SetConsoleOutputCP(CP_UTF8);
+    SetConsoleCP(CP_UTF8);
+#endif
+    SkipList<int, int> list;
+    std::mt19937 rng(2024);
+    std::string cmd;
+    printMenu();
+    while (true) {
+        std::cout << "> ";
+        if (!(std::cin >> cmd)) break;
+        try {
+            if (cmd == "insert") {
+                int key, value;
+                if (!(std::cin >> key >> value)) {
+                    std::cout << "输入有误。用法: insert <键> <值>\n";
+                    clearInput();
+                    continue;
+                }
+                std::cout << (list.insert(key, value) ? "已插入。" : "键已存在，已更新值。") << "\n";
+            } else if (cmd == "find" || cmd == "erase" || cmd == "lower") {
+                int key;
+                if (!(std::cin >> key)) {
+                    std::cout << "输入有误。用法: " << cmd << " <键>\n";
+                    clearInput();
+                    continue;
+                }
+                if (cmd == "find") {
+                    const int* value = list.find(key);
+                    if (value) std::cout << "键 " << key << " 的值为: " << *value << "\n";
+                    else std::cout << "未找到键 " << key << "。\n";
+                } else if (cmd == "erase") {
+                    std::cout << (list.erase(key) ? "已删除。" : "键不存在。") << "\n";
+                } else {
+                    SkipList<int, int>::Iterator it = list.lowerBound(key);
+                    if (it == list.end()) std::cout << "没有不小于 " << key << " 的键。\n";
+                    else std::cout << "第一个不小于 " << key << " 的元素: " << it.key() << ":" << it.value() << "\n";
+                }
+            } else if (cmd == "range") {
+                int lo, hi;
+                if (!(std::cin >> lo >> hi)) {
+                    std::cout << "输入有误。用法: range <下界> <上界>\n";
+                    clearInput();
+                    continue;
+                }
+                int n = list.range(lo, hi, printPair);
+                std::cout << "\n共 " << n << " 个。\n";
+            } else if (cmd == "random") {
+                int n, bound;
+                if (!(std::cin >> n >> bound) || n < 0 || bound <= 0) {
+                    std::cout << "输入有误。用法: random <个数> <键上界>\n";
+                    clearInput();
+                    continue;
+                }
+                for (int i = 0; i < n; ++i) {
+                    int key = static_cast<int>(rng() % bound);
+                    list.insert(key, key * 10);
+                }
+                std::cout << "当前共 " << list.size() << " 个元素。\n";
+            } else if (cmd == "print") {
+                list.traverse(printPair);
+                std::cout << "\n";
+            } else if (cmd == "levels") {
+                printLevels(list);
+            } else if (cmd == "size") {
+                std::cout << "元素个数: " << list.size() << "，层数: " << list.height() << "\n";
+            } else if (cmd == "clear") {
+                list.clear();
+                std::cout << "已清空。\n";
+            } else if (cmd == "bench") {
+                int n;
+                if (!(std::cin >> n) || n <= 0) {
+                    std::cout << "输入有误。用法: bench <个数>\n";
+                    clearInput();
+                    continue;
+                }
+                bench(n);
+            } else if (cmd == "concurrent") {
+                int readerCount, ops;
+                if (!(std::cin >> readerCount >> ops) || readerCount < 0 || ops < 0) {
+                    std::cout << "输入有误。用法: concurrent <读线程数> <写操作数>\n";
+                    clearInput();
+                    continue;
+                }
+                concurrentTest(readerCount, ops);
+            } else if (cmd == "help") {
+                printMenu();
+            } else if (cmd == "exit" || cmd == "0") {
+                std::cout << "程序结束，再见！\n";
+                break;
+            } else {
+                std::cout << "未知命令。输入 help 查看菜单。\n";
+            }
+        } catch (const std::exception& e) {
+            std::cout << "错误: " << e.what() << "\n";
+        }
+        clearInput();
+    }
+    return 0;
+}
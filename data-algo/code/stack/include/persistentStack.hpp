@@ -0,0 +1,151 @@
+#pragma once
+#include "../../linklist/include/persistentList.hpp"
+
+/**
+ * @brief 持久化栈模板类
+ *
+ * 基于持久化链表（PersistentList）实现，接口与 Stack 一致，
+ * 但拷贝与赋值只共享节点而不复制元素，时间复杂度为 O(1)。
+ * 在快照上继续入栈/出栈不会影响其他快照，适合撤销栈、回溯状态等场景。
+ *
+ * @tparam T 栈元素类型
+ */
+template<typename T>
+class PersistentStack {
+private:
+    PersistentList<T> list; ///< 底层持久化链表实现
+
+public:
+    /**
+     * @brief 构造函数，初始化空栈
+     */
+    PersistentStack();
+
+    /**
+     * @brief 拷贝构造函数，与原栈共享节点，O(1)
+     * @param other 被拷贝的栈
+     */
+    PersistentStack(const PersistentStack& other);
+
+    /**
+     * @brief 赋值操作符重载，与原栈共享节点，O(1)
+     * @param other 被赋值的栈
+     * @return 当前对象的引用
+     */
+    PersistentStack& operator=(const PersistentStack& other);
+
+    /**
+     * @brief 析构函数
+     */
+    ~PersistentStack();
+
+    /**
+     * @brief 入栈
+     * @param value 入栈元素
+     * @throws std::bad_alloc 内存分配失败
+     */
+    void push(const T& value);
+
+    /**
+     * @brief 出栈
+     * @throws std::out_of_range 栈为空
+     */
+    void pop();
+
+    /**
+     * @brief 获取栈顶元素
+     * @return 栈顶元素的值
+     * @throws std::out_of_range 栈为空
+     */
+    T top() const;
+
+    /**
+     * @brief 判断栈是否为空
+     * @return 为空返回true，否则返回false
+     */
+    bool empty() const;
+
+    /**
+     * @brief 获取栈中元素个数
+     * @return 元素个数
+     */
+    int size() const;
+
+    /**
+     * @brief 清空栈（仅当前版本）
+     */
+    void clear();
+
+    /**
+     * @brief 从栈顶到栈底遍历，对每个元素调用visit函数
+     * @param visit 回调函数，参数为const T&，无返回值
+     */
+    void traverse(void (*visit)(const T&)) const;
+};
+
+// ================== 实现部分 ==================
+
+// 构造函数，初始化空栈
+template<typename T>
+PersistentStack<T>::PersistentStack() : list() {}
+
+// 拷贝构造函数，共享节点
+template<typename T>
+PersistentStack<T>::PersistentStack(const PersistentStack& other) : list(other.list) {}
+
+// 赋值操作符重载，共享节点
+template<typename T>
+PersistentStack<T>& PersistentStack<T>::operator=(const PersistentStack& other) {
+    list = other.list;
+    return *this;
+}
+
+// 析构函数
+template<typename T>
+PersistentStack<T>::~PersistentStack() {}
+
+// 入栈
+template<typename T>
+void PersistentStack<T>::push(const T& value) {
+    list.push_front(value);
+}
+
+// 出栈
+template<typename T>
+void PersistentStack<T>::pop() {
+    if (empty())
+        throw std::out_of_range("Stack is empty");
+    list.pop_front();
+}
+
+// 获取栈顶元素
+template<typename T>
+T PersistentStack<T>::top() const {
+    if (empty())
+        throw std::out_of_range("Stack is empty");
+    return list.front();
+}
+
+// 判断栈是否为空
+template<typename T>
+bool PersistentStack<T>::empty() const {
+    return list.empty();
+}
+
+// 获取栈中元素个数
+template<typename T>
+int PersistentStack<T>::size() const {
+    return list.size();
+}
+
+// 清空栈
+template<typename T>
+void PersistentStack<T>::clear() {
+    list.clear();
+}
+
+// 从栈顶到栈底遍历
+template<typename T>
+void PersistentStack<T>::traverse(void (*visit)(const T&)) const {
+    list.traverse(visit);
+}
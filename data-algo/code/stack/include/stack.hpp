@@ -1,17 +1,23 @@
 #pragma once
-#include "../../linklist/include/linkList.hpp"
+#include "stackStorage.hpp"
+#include "../../common/include/dsCheck.hpp"
+#include "../../trace/include/traceHooks.hpp"
 
 /**
  * @brief 栈模板类
  * 
- * 基于单链表实现的顺序栈，支持入栈、出栈、取栈顶、判空、获取大小、清空等操作。
+ * 支持入栈、出栈、取栈顶、判空、获取大小、清空等操作。
+ * 底层存储由策略参数决定：默认使用连续存储（ArrayStorage），
+ * 稳态下入栈/出栈不分配内存；也可指定链式存储（LinkStorage）。
  * 
  * @tparam T 栈元素类型
+ * @tparam Storage 存储策略，需提供 push_back/push_n/pop_back/pop_n/back/empty/size/clear，
+ *                 其中 pop_back/pop_n/back 不做检查，由 Stack 保证非空
  */
-template<typename T>
+template<typename T, typename Storage = ArrayStorage<T>>
 class Stack {
 private:
-    LinkList<T> list; ///< 底层链表实现
+    Storage storage; ///< 底层存储实现
 
 public:
     /**
@@ -44,12 +50,37 @@ public:
      */
     void push(const T& value);
 
+    /**
+     * @brief 批量入栈，按区间顺序依次压入（最后一个元素成为栈顶）
+     * @param first 区间起始迭代器
+     * @param last 区间尾后迭代器
+     * @throws std::bad_alloc 内存分配失败
+     */
+    template<typename ForwardIt>
+    void push_n(ForwardIt first, ForwardIt last);
+
     /**
      * @brief 出栈
      * @throws std::out_of_range 栈为空
      */
     void pop();
 
+    /**
+     * @brief 批量出栈，按出栈顺序（栈顶在前）写入连续缓冲区
+     * @param out 输出缓冲区，长度至少为max
+     * @param max 最多出栈个数
+     * @return 实际出栈个数，栈为空时返回0
+     */
+    int pop_n(T* out, int max);
+
+    /**
+     * @brief 按出栈顺序把所有元素交给consume处理并清空栈
+     * @param consume 回调，参数为const T&
+     * @return 处理的元素个数
+     */
+    template<typename F>
+    int drain(F consume);
+
     /**
      * @brief 获取栈顶元素（常量版本）
      * @return 栈顶元素的值
@@ -57,6 +88,31 @@ public:
      */
     T top() const;
 
+    /**
+     * @brief 不抛异常的出栈
+     * @param out 成功时写入原栈顶元素
+     * @return 栈非空返回true，栈为空返回false（out不变）
+     */
+    bool try_pop(T& out);
+
+    /**
+     * @brief 不抛异常的取栈顶
+     * @param out 成功时写入栈顶元素
+     * @return 栈非空返回true，栈为空返回false（out不变）
+     */
+    bool try_top(T& out) const;
+
+    /**
+     * @brief 不检查是否为空的出栈，调用者保证栈非空
+     */
+    void unchecked_pop() { storage.pop_back(); }
+
+    /**
+     * @brief 不检查是否为空的取栈顶，调用者保证栈非空
+     * @return 栈顶元素的常量引用，下一次修改栈之前有效
+     */
+    const T& unchecked_top() const { return storage.back(); }
+
     /**
      * @brief 判断栈是否为空
      * @return 为空返回true，否则返回false
@@ -78,62 +134,112 @@ public:
 // ================== 实现部分 ==================
 
 // 构造函数，初始化空栈
-template<typename T>
-Stack<T>::Stack() : list() {}
+template<typename T, typename Storage>
+Stack<T, Storage>::Stack() : storage() {}
 
 // 拷贝构造函数，深拷贝栈
-template<typename T>
-Stack<T>::Stack(const Stack& other) : list(other.list) {}
+template<typename T, typename Storage>
+Stack<T, Storage>::Stack(const Stack& other) : storage(other.storage) {}
 
 // 赋值操作符重载，深拷贝栈
-template<typename T>
-Stack<T>& Stack<T>::operator=(const Stack& other) {
+template<typename T, typename Storage>
+Stack<T, Storage>& Stack<T, Storage>::operator=(const Stack& other) {
     if (this != &other) {
-        list = other.list;
+        storage = other.storage;
     }
     return *this;
 }
 
 // 析构函数
-template<typename T>
-Stack<T>::~Stack() {}
+template<typename T, typename Storage>
+Stack<T, Storage>::~Stack() {}
 
 // 入栈
-template<typename T>
-void Stack<T>::push(const T& value) {
-    list.insert(0, value); // 头插法，O(1)
+template<typename T, typename Storage>
+void Stack<T, Storage>::push(const T& value) {
+    DS_TRACE_SCOPE("Stack::push");
+    storage.push_back(value); // 连续存储为尾插、链式存储为头插，均为O(1)
+}
+
+// 批量入栈
+template<typename T, typename Storage>
+template<typename ForwardIt>
+void Stack<T, Storage>::push_n(ForwardIt first, ForwardIt last) {
+    storage.push_n(first, last);
 }
 
 // 出栈
-template<typename T>
-void Stack<T>::pop() {
-    if (empty())
-        throw std::out_of_range("Stack is empty");
-    list.remove(0);
+template<typename T, typename Storage>
+void Stack<T, Storage>::pop() {
+    DS_TRACE_SCOPE("Stack::pop");
+    DS_CHECK(!empty(), std::out_of_range, "Stack is empty");
+    storage.pop_back();
+}
+
+// 不抛异常的出栈
+template<typename T, typename Storage>
+bool Stack<T, Storage>::try_pop(T& out) {
+    if (storage.empty())
+        return false;
+    out = storage.back();
+    storage.pop_back();
+    return true;
+}
+
+// 不抛异常的取栈顶
+template<typename T, typename Storage>
+bool Stack<T, Storage>::try_top(T& out) const {
+    if (storage.empty())
+        return false;
+    out = storage.back();
+    return true;
+}
+
+// 批量出栈，不足max个时全部弹出
+template<typename T, typename Storage>
+int Stack<T, Storage>::pop_n(T* out, int max) {
+    int n = max < size() ? max : size();
+    if (n <= 0)
+        return 0;
+    storage.pop_n(out, n);
+    return n;
+}
+
+// 逐个取出栈顶交给consume，直到栈空
+template<typename T, typename Storage>
+template<typename F>
+int Stack<T, Storage>::drain(F consume) {
+    int n = 0;
+    while (!storage.empty()) {
+        consume(storage.back());
+        storage.pop_back();
+        ++n;
+    }
+    return n;
 }
 
 // 获取栈顶元素（常量版本）
-template<typename T>
-T Stack<T>::top() const {
-    if (empty())
-        throw std::out_of_range("Stack is empty");
-    return list.get(0);
+template<typename T, typename Storage>
+T Stack<T, Storage>::top() const {
+    DS_CHECK(!empty(), std::out_of_range, "Stack is empty");
+    return storage.back();
 }
 
 // 判断栈是否为空
-template<typename T>
-bool Stack<T>::empty() const {
-    return list.empty();
+template<typename T, typename Storage>
+bool Stack<T, Storage>::empty() const {
+    return storage.empty();
 }
 
 // 获取栈中元素个数
-template<typename T>
-int Stack<T>::size() const {
-    return list.size();
+template<typename T, typename Storage>
+int Stack<T, Storage>::size() const {
+    return storage.size();
 }
 
 // 清空栈
-template<typename T>
-void Stack<T>::clear() {
-    list.clear();
+template<typename T, typename Storage>
+void Stack<T, Storage>::clear() {
+    DS_TRACE_SCOPE("Stack::clear");
+    storage.clear();
 }
\ No newline at end of file
@@ -0,0 +1,163 @@
+#pragma once
+#include "../../array/include/array.hpp"
+#include "../../linklist/include/linkList.hpp"
+#include <iterator>
+
+/**
+ * @brief 栈的连续存储策略
+ *
+ * 基于动态数组（Array）实现，栈顶位于数组尾部，入栈/出栈只操作尾部元素，
+ * 容量不足时按倍增扩容。出栈不释放缓冲区，稳态下入栈/出栈不再分配内存。
+ *
+ * @tparam T 元素类型（需可默认构造）
+ */
+template<typename T>
+class ArrayStorage {
+private:
+    Array<T> buffer;   ///< 底层动态数组，按倍增策略自动扩容
+
+    static const int INITIAL_CAPACITY = 16;   ///< 初始容量
+
+public:
+    /**
+     * @brief 构造函数，预分配初始容量
+     */
+    ArrayStorage() : buffer(INITIAL_CAPACITY, GrowthPolicy::geometric(2.0)) {}
+
+    /**
+     * @brief 在尾部追加元素，容量不足时倍增扩容，均摊O(1)
+     * @param value 元素值
+     */
+    void push_back(const T& value) { buffer.insert(buffer.size(), value); }
+
+    /**
+     * @brief 批量追加元素，最多扩容一次后依次写入
+     * @param first 区间起始迭代器
+     * @param last 区间尾后迭代器
+     */
+    template<typename ForwardIt>
+    void push_n(ForwardIt first, ForwardIt last) {
+        int need = buffer.size() + static_cast<int>(std::distance(first, last));
+        buffer.reserve(buffer.growthPolicy().next(buffer.getCapacity(), need));
+        for (; first != last; ++first)
+            buffer.insert(buffer.size(), *first);
+    }
+
+    /**
+     * @brief 删除尾部元素，O(1)，调用者保证非空
+     */
+    void pop_back() { buffer.unchecked_remove(buffer.size() - 1); }
+
+    /**
+     * @brief 从尾部批量弹出n个元素，按弹出顺序写入out
+     * @param out 输出缓冲区，长度至少为n
+     * @param n 弹出个数（调用者保证不超过size()）
+     */
+    void pop_n(T* out, int n) {
+        for (int i = 0; i < n; ++i) {
+            out[i] = buffer.unchecked_get(buffer.size() - 1);
+            buffer.unchecked_remove(buffer.size() - 1);
+        }
+    }
+
+    /**
+     * @brief 获取尾部元素，O(1)，调用者保证非空
+     * @return 尾部元素的常量引用
+     */
+    const T& back() const { return buffer.unchecked_get(buffer.size() - 1); }
+
+    /**
+     * @brief 判断是否为空
+     * @return 为空返回true，否则返回false
+     */
+    bool empty() const { return buffer.isEmpty(); }
+
+    /**
+     * @brief 获取元素个数
+     * @return 元素个数
+     */
+    int size() const { return buffer.size(); }
+
+    /**
+     * @brief 清空元素，保留已分配的缓冲区
+     */
+    void clear() {
+        while (!buffer.isEmpty())
+            buffer.unchecked_remove(buffer.size() - 1);
+    }
+};
+
+/**
+ * @brief 栈的链式存储策略
+ *
+ * 基于单链表（LinkList）实现，栈顶位于链表头部，每次入栈分配一个节点，
+ * 无需预分配，适合元素很大或栈深度波动很大的场景。
+ *
+ * @tparam T 元素类型
+ */
+template<typename T>
+class LinkStorage {
+private:
+    LinkList<T> list;   ///< 底层单链表
+
+public:
+    /**
+     * @brief 头插元素，O(1)
+     * @param value 元素值
+     */
+    void push_back(const T& value) { list.insert(0, value); }
+
+    /**
+     * @brief 依次头插区间内的元素：先在临时链表中建好整段节点，再一次拼接到头部；
+     *        中途分配或拷贝失败时栈保持不变
+     * @param first 区间起始迭代器
+     * @param last 区间尾后迭代器
+     */
+    template<typename ForwardIt>
+    void push_n(ForwardIt first, ForwardIt last) {
+        LinkList<T> batch;
+        for (; first != last; ++first)
+            batch.insert(0, *first);   // 后入栈的元素在前，与逐个头插的顺序相同
+        list.splice_front(batch);
+    }
+
+    /**
+     * @brief 删除头部元素，O(1)，调用者保证非空
+     */
+    void pop_back() { list.unchecked_remove(0); }
+
+    /**
+     * @brief 从头部批量弹出n个元素，按弹出顺序写入out
+     * @param out 输出缓冲区，长度至少为n
+     * @param n 弹出个数（调用者保证不超过size()）
+     */
+    void pop_n(T* out, int n) {
+        for (int i = 0; i < n; ++i) {
+            out[i] = list.unchecked_get(0);
+            list.unchecked_remove(0);
+        }
+    }
+
+    /**
+     * @brief 获取头部元素，O(1)，调用者保证非空
+     * @return 头部元素的常量引用
+     */
+    const T& back() const { return list.unchecked_get(0); }
+
+    /**
+     * @brief 判断是否为空
+     * @return 为空返回true，否则返回false
+     */
+    bool empty() const { return list.empty(); }
+
+    /**
+     * @brief 获取元素个数
+     * @return 元素个数
+     */
+    int size() const { return list.size(); }
+
+    /**
+     * @brief 清空元素，释放所有节点
+     */
+    void clear() { list.clear(); }
+};
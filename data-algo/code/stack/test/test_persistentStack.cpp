@@ -0,0 +1,122 @@
+#include "../include/persistentStack.hpp"
+#include <iostream>
+#include <string>
+#include <vector>
+#include <limits>
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+void printMenu() {
+    std::cout << "\n====== 持久化栈交互测试菜单 ======\n";
+    std::cout << "命令列表：\n";
+    std::cout << "  push <值>      : 入栈\n";
+    std::cout << "  pop            : 出栈\n";
+    std::cout << "  top            : 查看栈顶元素\n";
+    std::cout << "  size           : 当前元素个数\n";
+    std::cout << "  empty          : 判断栈是否为空\n";
+    std::cout << "  clear          : 清空栈\n";
+    std::cout << "  print          : 打印栈内容\n";
+    std::cout << "  save           : 保存当前栈为快照（O(1)）\n";
+    std::cout << "  load <编号>    : 恢复指定快照（O(1)）\n";
+    std::cout << "  snapshots      : 打印所有快照\n";
+    std::cout << "  help           : 显示菜单\n";
+    std::cout << "  exit / 0       : 退出程序\n";
+    std::cout << "-----------------------------------\n";
+    std::cout << "请输入命令: ";
+}
+
+template<typename T>
+void printStack(const PersistentStack<T>& stk) {
+    auto printElem = [](const T& x) { std::cout << x << " "; };
+    stk.traverse(printElem);
+    std::cout << std::endl;
+}
+
+void clearInput() {
+    std::cin.clear();
+    std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+}
+
+int main() {
+#ifdef _WIN32
+    SetConsoleOutputCP(CP_UTF8);
+    SetConsoleCP(CP_UTF8);
+#endif
+    PersistentStack<int> stk;
+    std::vector<PersistentStack<int>> snapshots;
+
+    std::string cmd;
+    printMenu();
+    while (true) {
+        std::cout << "> ";
+        if (!(std::cin >> cmd)) break;
+        if (cmd == "push") {
+            int val;
+            if (!(std::cin >> val)) {
+                std::cout << "输入有误。用法: push <值>\n";
+                clearInput();
+                continue;
+            }
+            try {
+                stk.push(val);
+                std::cout << "已入栈 " << val << "。\n";
+            } catch (const std::exception& e) {
+                std::cout << "错误: " << e.what() << "\n";
+            }
+        } else if (cmd == "pop") {
+            try {
+                stk.pop();
+                std::cout << "已出栈。\n";
+            } catch (const std::exception& e) {
+                std::cout << "错误: " << e.what() << "\n";
+            }
+        } else if (cmd == "top") {
+            try {
+                std::cout << "栈顶元素为: " << stk.top() << "\n";
+            } catch (const std::exception& e) {
+                std::cout << "错误: " << e.what() << "\n";
+            }
+        } else if (cmd == "size") {
+            std::cout << "当前元素个数: " << stk.size() << "\n";
+        } else if (cmd == "empty") {
+            std::cout << (stk.empty() ? "栈为空。" : "栈非空。") << "\n";
+        } else if (cmd == "clear") {
+            stk.clear();
+            std::cout << "栈已清空。\n";
+        } else if (cmd == "print") {
+            std::cout << "栈内容: ";
+            printStack(stk);
+        } else if (cmd == "save") {
+            snapshots.push_back(stk);
+            std::cout << "已保存快照 " << snapshots.size() - 1 << "。\n";
+        } else if (cmd == "load") {
+            int idx;
+            if (!(std::cin >> idx)) {
+                std::cout << "输入有误。用法: load <编号>\n";
+                clearInput();
+                continue;
+            }
+            if (idx < 0 || idx >= static_cast<int>(snapshots.size())) {
+                std::cout << "错误: 快照编号不存在。\n";
+            } else {
+                stk = snapshots[idx];
+                std::cout << "已恢复快照 " << idx << "。\n";
+            }
+        } else if (cmd == "snapshots") {
+            for (size_t i = 0; i < snapshots.size(); ++i) {
+                std::cout << "快照 " << i << ": ";
+                printStack(snapshots[i]);
+            }
+        } else if (cmd == "help") {
+            printMenu();
+        } else if (cmd == "exit" || cmd == "0") {
+            std::cout << "程序结束，再见！\n";
+            break;
+        } else {
+            std::cout << "未知命令。输入 help 查看菜单。\n";
+        }
+        clearInput();
+    }
+    return 0;
+}
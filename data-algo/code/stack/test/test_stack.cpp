@@ -2,6 +2,9 @@
 #include <iostream>
 #include <string>
 #include <limits>
+#include <chrono>
+#include <stdexcept>
+#include <vector>
 #ifdef _WIN32
 #include <windows.h>
 #endif
@@ -11,11 +14,17 @@ void printMenu() {
     std::cout << "命令列表：\n";
     std::cout << "  push <值>      : 入栈\n";
     std::cout << "  pop            : 出栈\n";
+    std::cout << "  pushn <k> <值...> : 批量入栈k个值\n";
+    std::cout << "  popn <k>       : 批量出栈至多k个\n";
+    std::cout << "  drain          : 依次取出全部元素\n";
     std::cout << "  top            : 查看栈顶元素\n";
+    std::cout << "  trypop         : 不抛异常的出栈（try_pop）\n";
+    std::cout << "  trytop         : 不抛异常的取栈顶（try_top）\n";
     std::cout << "  size           : 当前元素个数\n";
     std::cout << "  empty          : 判断栈是否为空\n";
     std::cout << "  clear          : 清空栈\n";
     std::cout << "  print          : 打印栈内容\n";
+    std::cout << "  bench <次数>   : 对比连续/链式存储的入栈出栈耗时，以及三种出栈写法\n";
     std::cout << "  help           : 显示菜单\n";
     std::cout << "  exit / 0       : 退出程序\n";
     std::cout << "-----------------------------------\n";
@@ -41,6 +50,58 @@ void printStack(Stack<T>& stk) {
     std::cout << std::endl;
 }
 
+// 反复入栈n个再全部出栈，返回耗时（毫秒）
+template<typename Storage>
+double benchStack(int n, int rounds) {
+    Stack<int, Storage> stk;
+    auto start = std::chrono::steady_clock::now();
+    for (int r = 0; r < rounds; ++r) {
+        for (int i = 0; i < n; ++i)
+            stk.push(i);
+        while (!stk.empty())
+            stk.pop();
+    }
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+// 三种出栈写法：判空+top+pop（带异常检查）、try_pop、判空+unchecked_top+unchecked_pop
+void benchPop(int n, int rounds) {
+    Stack<int> stk;
+    long long s1 = 0, s2 = 0, s3 = 0;
+    double t[3];
+    for (int mode = 0; mode < 3; ++mode) {
+        auto start = std::chrono::steady_clock::now();
+        for (int r = 0; r < rounds; ++r) {
+            for (int i = 0; i < n; ++i)
+                stk.push(i);
+            if (mode == 0) {
+                while (!stk.empty()) {
+                    try {
+                        s1 += stk.top();
+                        stk.pop();
+                    } catch (const std::out_of_range&) {
+                        break;
+                    }
+                }
+            } else if (mode == 1) {
+                int v;
+                while (stk.try_pop(v))
+                    s2 += v;
+            } else {
+                while (!stk.empty()) {
+                    s3 += stk.unchecked_top();
+                    stk.unchecked_pop();
+                }
+            }
+        }
+        auto end = std::chrono::steady_clock::now();
+        t[mode] = std::chrono::duration<double, std::milli>(end - start).count();
+    }
+    std::cout << "  出栈写法（连续存储，含入栈）: empty+top+pop " << t[0] << " ms，try_pop " << t[1]
+              << " ms，unchecked " << t[2] << " ms" << (s1 == s2 && s2 == s3 ? "" : "（结果不一致！）") << "\n";
+}
+
 void clearInput() {
     std::cin.clear();
     std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
@@ -84,6 +145,13 @@ int main() {
             } catch (const std::exception& e) {
                 std::cout << "错误: " << e.what() << "\n";
             }
+        } else if (cmd == "trypop" || cmd == "trytop") {
+            int val = 0;
+            bool ok = cmd == "trypop" ? stk.try_pop(val) : stk.try_top(val);
+            if (ok)
+                std::cout << (cmd == "trypop" ? "已出栈: " : "栈顶元素为: ") << val << "\n";
+            else
+                std::cout << "栈为空，" << cmd << " 返回 false。\n";
         } else if (cmd == "size") {
             std::cout << "当前元素个数: " << stk.size() << "\n";
         } else if (cmd == "empty") {
@@ -93,6 +161,52 @@ int main() {
             std::cout << "栈已清空。\n";
         } else if (cmd == "print") {
             printStack(stk);
+        } else if (cmd == "bench") {
+            int n;
+            if (!(std::cin >> n) || n <= 0) {
+                std::cout << "输入有误。用法: bench <次数>\n";
+                clearInput();
+                continue;
+            }
+            const int rounds = 10;
+            std::cout << "入栈/出栈 " << n << " 个元素，重复 " << rounds << " 轮：\n";
+            std::cout << "  连续存储 ArrayStorage: " << benchStack<ArrayStorage<int>>(n, rounds) << " ms\n";
+            std::cout << "  链式存储 LinkStorage : " << benchStack<LinkStorage<int>>(n, rounds) << " ms\n";
+            benchPop(n, rounds);
+        } else if (cmd == "pushn") {
+            int k;
+            if (!(std::cin >> k) || k < 0) {
+                std::cout << "输入有误。用法: pushn <k> <值...>\n";
+                clearInput();
+                continue;
+            }
+            std::vector<int> vals(k);
+            bool ok = true;
+            for (int i = 0; i < k && ok; ++i)
+                ok = static_cast<bool>(std::cin >> vals[i]);
+            if (!ok) {
+                std::cout << "输入有误。用法: pushn <k> <值...>\n";
+                clearInput();
+                continue;
+            }
+            stk.push_n(vals.begin(), vals.end());
+            std::cout << "已批量入栈 " << k << " 个元素。\n";
+        } else if (cmd == "popn") {
+            int k;
+            if (!(std::cin >> k) || k < 0) {
+                std::cout << "输入有误。用法: popn <k>\n";
+                clearInput();
+                continue;
+            }
+            std::vector<int> out(k > 0 ? k : 1);
+            int got = stk.pop_n(&out[0], k);
+            std::cout << "已批量出栈 " << got << " 个元素: ";
+            for (int i = 0; i < got; ++i) std::cout << out[i] << " ";
+            std::cout << "\n";
+        } else if (cmd == "drain") {
+            std::cout << "取出: ";
+            int got = stk.drain([](const int& x) { std::cout << x << " "; });
+            std::cout << "\n共 " << got << " 个元素。\n";
         } else if (cmd == "help") {
             printMenu();
         } else if (cmd == "exit" || cmd == "0") {
@@ -0,0 +1,225 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+
+/**
+ * @brief 无锁对数-线性直方图（HDR 风格）
+ *
+ * 值域 [0, 2^64) 按二进制数量级分段，每段再等分为 64 个子桶：小于 128 的值精确计数，
+ * 更大的值相对误差不超过 1/64（约 1.6%）。共 3776 个桶，约 30KB，记录与查询都不分配内存。
+ *
+ * record 只做一次定位和若干次 relaxed 原子加，可在多个线程中同时调用；
+ * 读取（percentile、dump 等）与写入并发时得到的是近似快照。
+ */
+class LatencyHistogram {
+public:
+    static const int SUB_BITS = 7;                          ///< 子桶精度位数
+    static const int SUB_COUNT = 1 << SUB_BITS;             ///< 小于该值的数精确计数
+    static const int HALF = SUB_COUNT / 2;                  ///< 每个数量级的子桶数
+    static const int BUCKETS = (66 - SUB_BITS) * HALF;      ///< 桶总数
+
+private:
+    std::atomic<uint64_t> counts[BUCKETS];   ///< 各桶计数
+    std::atomic<uint64_t> total;             ///< 记录总数
+    std::atomic<uint64_t> sum;               ///< 记录值之和（用于均值，溢出时回绕）
+    std::atomic<uint64_t> minValue;          ///< 最小值
+    std::atomic<uint64_t> maxValue;          ///< 最大值
+
+    static int highestBit(uint64_t value);
+
+public:
+    /**
+     * @brief 构造空直方图
+     */
+    LatencyHistogram();
+
+    LatencyHistogram(const LatencyHistogram&) = delete;
+    LatencyHistogram& operator=(const LatencyHistogram&) = delete;
+
+    /**
+     * @brief 值所在的桶号
+     * @param value 值
+     * @return 桶号 [0, BUCKETS)
+     */
+    static int bucketIndex(uint64_t value);
+
+    /**
+     * @brief 桶内最小值
+     * @param index 桶号
+     * @return 落入该桶的最小值
+     */
+    static uint64_t bucketLower(int index);
+
+    /**
+     * @brief 桶内最大值
+     * @param index 桶号
+     * @return 落入该桶的最大值
+     */
+    static uint64_t bucketUpper(int index);
+
+    /**
+     * @brief 记录一个值，无锁，线程安全
+     * @param value 值（如纳秒数、事件数）
+     */
+    void record(uint64_t value);
+
+    /**
+     * @brief 记录总数
+     * @return 个数
+     */
+    uint64_t count() const { return total.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief 最小值，无记录时为0
+     * @return 最小值
+     */
+    uint64_t min() const;
+
+    /**
+     * @brief 最大值，无记录时为0
+     * @return 最大值
+     */
+    uint64_t max() const { return maxValue.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief 平均值，无记录时为0
+     * @return 平均值
+     */
+    double mean() const;
+
+    /**
+     * @brief 百分位数，返回所在桶的上界（不超过最大值），即“不超过该值的记录至少占 p%”
+     * @param p 百分比 [0, 100]，如 50、99、99.9
+     * @return 百分位数，无记录时为0
+     */
+    uint64_t percentile(double p) const;
+
+    /**
+     * @brief 某个桶的计数
+     * @param index 桶号
+     * @return 计数
+     */
+    uint64_t bucketCount(int index) const { return counts[index].load(std::memory_order_relaxed); }
+
+    /**
+     * @brief 清空所有计数（与并发 record 同时调用时可能丢失少量记录）
+     */
+    void reset();
+
+    /**
+     * @brief 输出摘要行与全部非空桶 [下界, 上界] 计数 累计百分比
+     * @param out 输出流
+     */
+    void dump(std::ostream& out) const;
+};
+
+// ================== 实现部分 ==================
+
+// 最高位的位置，value 非0
+inline int LatencyHistogram::highestBit(uint64_t value) {
+#if defined(__GNUC__) || defined(__clang__)
+    return 63 - __builtin_clzll(value);
+#else
+    int pos = 0;
+    while (value >>= 1) ++pos;
+    return pos;
+#endif
+}
+
+// 构造空直方图，原子数组需逐个初始化
+inline LatencyHistogram::LatencyHistogram() : total(0), sum(0), minValue(UINT64_MAX), maxValue(0) {
+    for (int i = 0; i < BUCKETS; ++i) counts[i].store(0, std::memory_order_relaxed);
+}
+
+// 小于 SUB_COUNT 的值直接作为桶号；否则按最高位确定数量级，取其后 SUB_BITS-1 位作为子桶
+inline int LatencyHistogram::bucketIndex(uint64_t value) {
+    if (value < static_cast<uint64_t>(SUB_COUNT)) return static_cast<int>(value);
+    int shift = highestBit(value) - (SUB_BITS - 1);
+    return shift * HALF + static_cast<int>(value >> shift);
+}
+
+// 桶内最小值
+inline uint64_t LatencyHistogram::bucketLower(int index) {
+    if (index < SUB_COUNT) return static_cast<uint64_t>(index);
+    int shift = index / HALF - 1;
+    return static_cast<uint64_t>(index - shift * HALF) << shift;
+}
+
+// 桶内最大值
+inline uint64_t LatencyHistogram::bucketUpper(int index) {
+    if (index < SUB_COUNT) return static_cast<uint64_t>(index);
+    int shift = index / HALF - 1;
+    return ((static_cast<uint64_t>(index - shift * HALF + 1)) << shift) - 1;
+}
+
+// 记录：桶计数、总数、和各一次原子加，最值只在需要更新时 CAS
+inline void LatencyHistogram::record(uint64_t value) {
+    counts[bucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+    total.fetch_add(1, std::memory_order_relaxed);
+    sum.fetch_add(value, std::memory_order_relaxed);
+    uint64_t cur = minValue.load(std::memory_order_relaxed);
+    while (value < cur && !minValue.compare_exchange_weak(cur, value, std::memory_order_relaxed)) {
+    }
+    cur = maxValue.load(std::memory_order_relaxed);
+    while (value > cur && !maxValue.compare_exchange_weak(cur, value, std::memory_order_relaxed)) {
+    }
+}
+
+// 最小值
+inline uint64_t LatencyHistogram::min() const {
+    uint64_t v = minValue.load(std::memory_order_relaxed);
+    return v == UINT64_MAX ? 0 : v;
+}
+
+// 平均值
+inline double LatencyHistogram::mean() const {
+    uint64_t n = count();
+    return n == 0 ? 0.0 : static_cast<double>(sum.load(std::memory_order_relaxed)) / static_cast<double>(n);
+}
+
+// 百分位数：从小到大累计，第一次达到 rank 的桶
+inline uint64_t LatencyHistogram::percentile(double p) const {
+    uint64_t n = 0;
+    for (int i = 0; i < BUCKETS; ++i) n += bucketCount(i);
+    if (n == 0) return 0;
+    if (p < 0.0) p = 0.0;
+    if (p > 100.0) p = 100.0;
+    uint64_t rank = static_cast<uint64_t>(p / 100.0 * static_cast<double>(n) + 0.999999);
+    if (rank == 0) rank = 1;
+    uint64_t seen = 0;
+    for (int i = 0; i < BUCKETS; ++i) {
+        seen += bucketCount(i);
+        if (seen >= rank) {
+            uint64_t upper = bucketUpper(i);
+            return upper < max() ? upper : max();
+        }
+    }
+    return max();
+}
+
+// 清空所有计数
+inline void LatencyHistogram::reset() {
+    for (int i = 0; i < BUCKETS; ++i) counts[i].store(0, std::memory_order_relaxed);
+    total.store(0, std::memory_order_relaxed);
+    sum.store(0, std::memory_order_relaxed);
+    minValue.store(UINT64_MAX, std::memory_order_relaxed);
+    maxValue.store(0, std::memory_order_relaxed);
+}
+
+// 输出摘要与非空桶
+inline void LatencyHistogram::dump(std::ostream& out) const {
+    out << "count=" << count() << " min=" << min() << " p50=" << percentile(50) << " p99=" << percentile(99)
+        << " p999=" << percentile(99.9) << " max=" << max() << " mean=" << mean() << "\n";
+    uint64_t n = 0;
+    for (int i = 0; i < BUCKETS; ++i) n += bucketCount(i);
+    uint64_t seen = 0;
+    for (int i = 0; i < BUCKETS; ++i) {
+        uint64_t c = bucketCount(i);
+        if (c == 0) continue;
+        seen += c;
+        out << "  [" << bucketLower(i) << ", " << bucketUpper(i) << "] " << c << " "
+            << 100.0 * static_cast<double>(seen) / static_cast<double>(n) << "%\n";
+    }
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+/**
+ * @file traceHooks.hpp
+ * @brief 容器操作的编译期埋点
+ *
+ * 默认情况下宏展开为空语句，容器代码不受任何影响。编译时定义 DS_TRACE_ENABLED
+ * （如 g++ -DDS_TRACE_ENABLED）后：
+ *
+ * - DS_TRACE_SCOPE("Array::extend")：记录所在作用域的耗时（纳秒）到同名直方图
+ * - DS_TRACE_PERF_SCOPE("Array::extend")：额外记录作用域内的缓存未命中数，
+ *   直方图名为 "Array::extend cache-misses"（perf 不可用时不记录）
+ *
+ * 每个埋点首次执行时在 TraceRegistry 中查找一次直方图并缓存在局部静态变量中，
+ * 之后每次执行只有两次读时钟和一次无锁 record。模板的不同实例共享同名直方图。
+ */
+
+#if defined(DS_TRACE_ENABLED)
+
+#include "tracer.hpp"
+
+#define DS_TRACE_CONCAT_IMPL(a, b) a##b
+#define DS_TRACE_CONCAT(a, b) DS_TRACE_CONCAT_IMPL(a, b)
+
+#define DS_TRACE_SCOPE(name)                                                                         \
+    static LatencyHistogram& DS_TRACE_CONCAT(dsTraceHistogram_, __LINE__) =                         \
+        TraceRegistry::instance().histogram(name);                                                   \
+    ScopedLatency DS_TRACE_CONCAT(dsTraceScope_, __LINE__)(DS_TRACE_CONCAT(dsTraceHistogram_, __LINE__))
+
+#define DS_TRACE_PERF_SCOPE(name)                                                                    \
+    static thread_local PerfCounter DS_TRACE_CONCAT(dsTracePerf_, __LINE__)(PerfCounter::CACHE_MISSES); \
+    static LatencyHistogram& DS_TRACE_CONCAT(dsTraceMisses_, __LINE__) =                            \
+        TraceRegistry::instance().histogram(std::string(name) + " cache-misses", "events");         \
+    ScopedPerfCounter DS_TRACE_CONCAT(dsTracePerfScope_, __LINE__)(DS_TRACE_CONCAT(dsTracePerf_, __LINE__), \
+                                                                   DS_TRACE_CONCAT(dsTraceMisses_, __LINE__)); \
+    DS_TRACE_SCOPE(name)
+
+#else
+
+#define DS_TRACE_SCOPE(name) ((void)0)
+#define DS_TRACE_PERF_SCOPE(name) ((void)0)
+
+#endif
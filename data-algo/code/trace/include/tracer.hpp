@@ -0,0 +1,353 @@
+#pragma once
+#include "latencyHistogram.hpp"
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__)) && !defined(DS_TRACE_NO_RDTSC)
+#include <x86intrin.h>
+#define DS_TRACE_HAVE_RDTSC 1
+#elif (defined(_M_X64) || defined(_M_IX86)) && defined(_MSC_VER) && !defined(DS_TRACE_NO_RDTSC)
+#include <intrin.h>
+#define DS_TRACE_HAVE_RDTSC 1
+#endif
+#if defined(__unix__) || defined(__APPLE__)
+#include <time.h>
+#endif
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <cstring>
+#endif
+
+/**
+ * @brief 计时时钟
+ *
+ * x86 上使用 rdtsc 读取时间戳计数器（约 20 个周期，无系统调用），首次换算时
+ * 用 steady_clock 校准每个计数对应的纳秒数（约 20ms）；其他平台使用
+ * clock_gettime(CLOCK_MONOTONIC)，再退化为 std::chrono::steady_clock。
+ * 定义 DS_TRACE_NO_RDTSC 可强制不用 rdtsc（如虚拟机中 TSC 不稳定时）。
+ */
+class TraceClock {
+public:
+    /**
+     * @brief 读取当前计数
+     * @return 计数（rdtsc 周期或纳秒）
+     */
+    static uint64_t ticks();
+
+    /**
+     * @brief 每个计数对应的纳秒数，首次调用时校准
+     * @return 纳秒数
+     */
+    static double nanosPerTick();
+
+    /**
+     * @brief 把计数差换算为纳秒
+     * @param elapsed 计数差
+     * @return 纳秒数
+     */
+    static uint64_t toNanos(uint64_t elapsed) {
+        return static_cast<uint64_t>(static_cast<double>(elapsed) * nanosPerTick());
+    }
+};
+
+/**
+ * @brief 直方图注册表（进程内单例）
+ *
+ * 按名称保存直方图，名称通常为“类型::操作”。查找加锁，但每个埋点只在首次执行时查找一次，
+ * 之后直接持有直方图引用；直方图在进程结束前不会释放。
+ */
+class TraceRegistry {
+private:
+    /**
+     * @brief 注册表条目
+     */
+    struct Entry {
+        std::unique_ptr<LatencyHistogram> histogram;   ///< 直方图
+        std::string unit;                              ///< 记录值的单位，如 "ns"
+    };
+
+    mutable std::mutex lock;                ///< 保护 entries
+    std::map<std::string, Entry> entries;   ///< 名称到直方图
+
+    TraceRegistry() {}
+
+public:
+    /**
+     * @brief 获取单例
+     * @return 注册表
+     */
+    static TraceRegistry& instance();
+
+    /**
+     * @brief 获取（不存在时创建）指定名称的直方图
+     * @param name 名称
+     * @param unit 单位，仅在创建时生效
+     * @return 直方图引用，在进程结束前有效
+     */
+    LatencyHistogram& histogram(const std::string& name, const std::string& unit = "ns");
+
+    /**
+     * @brief 查找直方图
+     * @param name 名称
+     * @return 直方图指针，不存在返回nullptr
+     */
+    LatencyHistogram* find(const std::string& name);
+
+    /**
+     * @brief 按名称顺序访问所有直方图
+     * @param visit 可调用对象，参数为 (const std::string& 名称, const std::string& 单位, const LatencyHistogram&)
+     */
+    template<typename F>
+    void forEach(F visit) const;
+
+    /**
+     * @brief 清空所有直方图的计数（保留注册）
+     */
+    void reset();
+
+    /**
+     * @brief 输出所有非空直方图的 count、p50、p99、p999、max、mean 表格
+     * @param out 输出流
+     */
+    void dump(std::ostream& out) const;
+};
+
+/**
+ * @brief 作用域计时器：构造时读时钟，析构时把经过的纳秒数记入直方图
+ */
+class ScopedLatency {
+private:
+    LatencyHistogram& histogram;   ///< 目标直方图
+    uint64_t start;                ///< 开始计数
+
+public:
+    explicit ScopedLatency(LatencyHistogram& h) : histogram(h), start(TraceClock::ticks()) {}
+    ~ScopedLatency() { histogram.record(TraceClock::toNanos(TraceClock::ticks() - start)); }
+
+    ScopedLatency(const ScopedLatency&) = delete;
+    ScopedLatency& operator=(const ScopedLatency&) = delete;
+};
+
+/**
+ * @brief 硬件性能计数器（Linux perf_event_open），只统计调用线程的用户态事件
+ *
+ * 打开失败（非 Linux、内核禁止 perf_event_paranoid、容器内无权限等）时 available() 返回 false，
+ * read() 恒为0，不抛出异常。
+ */
+class PerfCounter {
+public:
+    /**
+     * @brief 事件类型
+     */
+    enum Event {
+        CACHE_MISSES,       ///< 末级缓存未命中
+        CACHE_REFERENCES,   ///< 末级缓存访问
+        BRANCH_MISSES,      ///< 分支预测失败
+        INSTRUCTIONS,       ///< 退役指令数
+        CPU_CYCLES          ///< CPU 周期
+    };
+
+private:
+    int fd;   ///< perf 事件文件描述符，-1 表示不可用
+
+public:
+    /**
+     * @brief 打开计数器并立即开始计数
+     * @param event 事件类型
+     */
+    explicit PerfCounter(Event event = CACHE_MISSES);
+
+    /**
+     * @brief 关闭计数器
+     */
+    ~PerfCounter();
+
+    PerfCounter(const PerfCounter&) = delete;
+    PerfCounter& operator=(const PerfCounter&) = delete;
+
+    /**
+     * @brief 计数器是否可用
+     * @return 可用返回true
+     */
+    bool available() const { return fd >= 0; }
+
+    /**
+     * @brief 读取自打开以来的累计计数，区间内的事件数为两次读取之差
+     * @return 计数，不可用时为0
+     */
+    uint64_t read() const;
+
+    /**
+     * @brief 事件名称
+     * @param event 事件类型
+     * @return 名称
+     */
+    static const char* name(Event event);
+};
+
+/**
+ * @brief 作用域事件计数：析构时把区间内的事件数记入直方图（计数器不可用时不记录）
+ */
+class ScopedPerfCounter {
+private:
+    const PerfCounter& counter;    ///< 计数器
+    LatencyHistogram& histogram;   ///< 目标直方图
+    uint64_t start;                ///< 开始计数
+
+public:
+    ScopedPerfCounter(const PerfCounter& c, LatencyHistogram& h) : counter(c), histogram(h), start(c.read()) {}
+    ~ScopedPerfCounter() {
+        if (counter.available()) histogram.record(counter.read() - start);
+    }
+
+    ScopedPerfCounter(const ScopedPerfCounter&) = delete;
+    ScopedPerfCounter& operator=(const ScopedPerfCounter&) = delete;
+};
+
+// ================== 实现部分 ==================
+
+// 读取当前计数：rdtsc > clock_gettime > steady_clock
+inline uint64_t TraceClock::ticks() {
+#if defined(DS_TRACE_HAVE_RDTSC)
+    return static_cast<uint64_t>(__rdtsc());
+#elif defined(__unix__) || defined(__APPLE__)
+    timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return static_cast<uint64_t>(ts.tv_sec) * 1000000000ULL + static_cast<uint64_t>(ts.tv_nsec);
+#else
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+}
+
+// 每个计数对应的纳秒数：rdtsc 时用 steady_clock 忙等约 20ms 校准一次，其余时钟本身即为纳秒
+inline double TraceClock::nanosPerTick() {
+#if defined(DS_TRACE_HAVE_RDTSC)
+    static const double ratio = []() {
+        auto begin = std::chrono::steady_clock::now();
+        uint64_t t0 = ticks();
+        auto end = begin;
+        while (end - begin < std::chrono::milliseconds(20)) end = std::chrono::steady_clock::now();
+        uint64_t t1 = ticks();
+        double ns = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count());
+        return t1 > t0 ? ns / static_cast<double>(t1 - t0) : 1.0;
+    }();
+    return ratio;
+#else
+    return 1.0;
+#endif
+}
+
+// 获取单例：有意不析构，避免其他静态对象析构时仍在埋点中使用已销毁的直方图
+inline TraceRegistry& TraceRegistry::instance() {
+    static TraceRegistry* registry = new TraceRegistry();
+    return *registry;
+}
+
+// 获取或创建直方图
+inline LatencyHistogram& TraceRegistry::histogram(const std::string& name, const std::string& unit) {
+    std::lock_guard<std::mutex> guard(lock);
+    Entry& e = entries[name];
+    if (!e.histogram) {
+        e.histogram.reset(new LatencyHistogram());
+        e.unit = unit;
+    }
+    return *e.histogram;
+}
+
+// 查找直方图
+inline LatencyHistogram* TraceRegistry::find(const std::string& name) {
+    std::lock_guard<std::mutex> guard(lock);
+    std::map<std::string, Entry>::iterator it = entries.find(name);
+    return it == entries.end() ? nullptr : it->second.histogram.get();
+}
+
+// 按名称顺序访问所有直方图
+template<typename F>
+void TraceRegistry::forEach(F visit) const {
+    std::lock_guard<std::mutex> guard(lock);
+    for (std::map<std::string, Entry>::const_iterator it = entries.begin(); it != entries.end(); ++it) {
+        visit(it->first, it->second.unit, *it->second.histogram);
+    }
+}
+
+// 清空所有直方图的计数
+inline void TraceRegistry::reset() {
+    std::lock_guard<std::mutex> guard(lock);
+    for (std::map<std::string, Entry>::iterator it = entries.begin(); it != entries.end(); ++it) {
+        it->second.histogram->reset();
+    }
+}
+
+// 输出表格，跳过空直方图
+inline void TraceRegistry::dump(std::ostream& out) const {
+    out << "name                          unit          count        p50        p99       p999        max       mean\n";
+    forEach([&out](const std::string& name, const std::string& unit, const LatencyHistogram& h) {
+        if (h.count() == 0) return;
+        std::string n = name.size() < 30 ? name + std::string(30 - name.size(), ' ') : name + " ";
+        std::string u = unit.size() < 8 ? unit + std::string(8 - unit.size(), ' ') : unit;
+        out << n << u;
+        const uint64_t values[] = {h.count(), h.percentile(50), h.percentile(99), h.percentile(99.9), h.max()};
+        for (int i = 0; i < 5; ++i) {
+            std::string v = std::to_string(values[i]);
+            out << std::string(v.size() < 11 ? 11 - v.size() : 1, ' ') << v;
+        }
+        std::string m = std::to_string(static_cast<uint64_t>(h.mean() + 0.5));
+        out << std::string(m.size() < 11 ? 11 - m.size() : 1, ' ') << m << "\n";
+    });
+}
+
+#if defined(__linux__)
+
+// 打开 perf 事件：只统计本线程、排除内核与虚拟机监控程序，打开即开始计数
+inline PerfCounter::PerfCounter(Event event) : fd(-1) {
+    static const unsigned long long configs[] = {
+        PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_CACHE_REFERENCES, PERF_COUNT_HW_BRANCH_MISSES,
+        PERF_COUNT_HW_INSTRUCTIONS, PERF_COUNT_HW_CPU_CYCLES};
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.size = sizeof(attr);
+    attr.config = configs[event];
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    fd = static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0));
+}
+
+// 关闭计数器
+inline PerfCounter::~PerfCounter() {
+    if (fd >= 0) close(fd);
+}
+
+// 读取累计计数
+inline uint64_t PerfCounter::read() const {
+    uint64_t value = 0;
+    if (fd < 0 || ::read(fd, &value, sizeof(value)) != static_cast<ssize_t>(sizeof(value))) return 0;
+    return value;
+}
+
+#else
+
+// 非 Linux 平台：计数器不可用
+inline PerfCounter::PerfCounter(Event) : fd(-1) {}
+
+// 关闭计数器
+inline PerfCounter::~PerfCounter() {}
+
+// 读取累计计数
+inline uint64_t PerfCounter::read() const { return 0; }
+
+#endif
+
+// 事件名称
+inline const char* PerfCounter::name(Event event) {
+    static const char* const names[] = {"cache-misses", "cache-references", "branch-misses", "instructions",
+                                        "cpu-cycles"};
+    return names[event];
+}
@@ -0,0 +1,235 @@
+// 编译时需定义 DS_TRACE_ENABLED 才会记录容器操作：
+//   g++ -std=c++11 -O2 -DDS_TRACE_ENABLED test/test_trace.cpp -o test_trace
+#include "../include/latencyHistogram.hpp"
+#include "../include/tracer.hpp"
+#include "../../array/include/array.hpp"
+#include "../../deque/include/deque.hpp"
+#include "../../linklist/include/linkList.hpp"
+#include "../../queue/include/queue.hpp"
+#include "../../stack/include/stack.hpp"
+#include <chrono>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <vector>
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+void printMenu() {
+    std::cout << "\n====== 操作延迟直方图交互测试菜单 ======\n";
+#if defined(DS_TRACE_ENABLED)
+    std::cout << "（已定义 DS_TRACE_ENABLED，容器操作会被记录）\n";
+#else
+    std::cout << "（未定义 DS_TRACE_ENABLED，容器埋点为空；用 -DDS_TRACE_ENABLED 重新编译）\n";
+#endif
+    std::cout << "命令列表：\n";
+    std::cout << "  array <次数>          : Array 尾部插入（满时扩容一倍）并随机删除\n";
+    std::cout << "  list <次数>           : LinkList 头插、查找，每 1000 个清空一次\n";
+    std::cout << "  stack <次数>          : Stack 入栈/出栈\n";
+    std::cout << "  queue <次数>          : Queue 入队/出队\n";
+    std::cout << "  deque <次数>          : Deque 两端插入/删除\n";
+    std::cout << "  dump                  : 输出所有直方图的 p50/p99/p999\n";
+    std::cout << "  hist <名称>           : 输出某个直方图的全部非空桶，如 hist Array::extend\n";
+    std::cout << "  record <值>           : 向 \"manual\" 直方图手动记录一个值\n";
+    std::cout << "  reset                 : 清空所有直方图\n";
+    std::cout << "  perf <元素数>         : 用 perf 计数器统计顺序/随机访问的缓存未命中\n";
+    std::cout << "  bench <次数>          : 测量计时埋点本身的开销\n";
+    std::cout << "  help                  : 显示菜单\n";
+    std::cout << "  exit / 0              : 退出程序\n";
+    std::cout << "-----------------------------------\n";
+    std::cout << "请输入命令: ";
+}
+
+void clearInput() {
+    std::cin.clear();
+    std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+}
+
+// 计时工具：执行f并返回耗时（毫秒）
+template<typename F>
+double timeIt(F f) {
+    auto start = std::chrono::steady_clock::now();
+    f();
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+// 简单线性同余随机数
+unsigned nextRandom(unsigned& x) {
+    x = x * 1103515245u + 12345u;
+    return x >> 8;
+}
+
+void runArray(int n) {
+    Array<int> arr(16);
+    unsigned seed = 1;
+    for (int i = 0; i < n; ++i) {
+        if (arr.isFull()) arr.extend(arr.size());
+        arr.insert(arr.size(), i);
+        if (i % 4 == 3) arr.remove(static_cast<int>(nextRandom(seed) % static_cast<unsigned>(arr.size())));
+    }
+    std::cout << "  Array 完成，最终长度 " << arr.size() << "\n";
+}
+
+void runList(int n) {
+    LinkList<int> list;
+    long long found = 0;
+    for (int i = 0; i < n; ++i) {
+        list.insert(0, i);
+        if (i % 10 == 0) found += list.find(i / 2) >= 0 ? 1 : 0;
+        if (i % 1000 == 999) list.clear();
+    }
+    std::cout << "  LinkList 完成，查找命中 " << found << " 次\n";
+}
+
+void runStack(int n) {
+    Stack<int> s;
+    for (int i = 0; i < n; ++i) {
+        s.push(i);
+        if (i % 3 == 2) s.pop();
+    }
+    s.clear();
+    std::cout << "  Stack 完成\n";
+}
+
+void runQueue(int n) {
+    Queue<int> q;
+    for (int i = 0; i < n; ++i) {
+        q.push(i);
+        if (i % 3 == 2) q.pop();
+    }
+    q.clear();
+    std::cout << "  Queue 完成\n";
+}
+
+void runDeque(int n) {
+    Deque<int> d;
+    for (int i = 0; i < n; ++i) {
+        if (i & 1) d.push_front(i);
+        else d.push_back(i);
+        if (i % 3 == 2) {
+            if (i & 2) d.pop_front();
+            else d.pop_back();
+        }
+    }
+    std::cout << "  Deque 完成，最终长度 " << d.size() << "\n";
+}
+
+// 对同一数组做顺序与随机求和，分别统计缓存未命中
+void perfDemo(int n) {
+    PerfCounter counter(PerfCounter::CACHE_MISSES);
+    if (!counter.available()) {
+        std::cout << "  perf 计数器不可用（非 Linux、无权限或 perf_event_paranoid 限制），改为只计时\n";
+    }
+    std::vector<int> data(n, 1);
+    std::vector<int> order(n);
+    unsigned seed = 7;
+    for (int i = 0; i < n; ++i) order[i] = static_cast<int>(nextRandom(seed) % static_cast<unsigned>(n));
+    LatencyHistogram& seqMisses = TraceRegistry::instance().histogram("perf::sequential cache-misses", "events");
+    LatencyHistogram& rndMisses = TraceRegistry::instance().histogram("perf::random cache-misses", "events");
+    LatencyHistogram& seqTime = TraceRegistry::instance().histogram("perf::sequential");
+    LatencyHistogram& rndTime = TraceRegistry::instance().histogram("perf::random");
+    long long sum = 0;
+    for (int round = 0; round < 10; ++round) {
+        {
+            ScopedPerfCounter p(counter, seqMisses);
+            ScopedLatency t(seqTime);
+            for (int i = 0; i < n; ++i) sum += data[i];
+        }
+        {
+            ScopedPerfCounter p(counter, rndMisses);
+            ScopedLatency t(rndTime);
+            for (int i = 0; i < n; ++i) sum += data[order[i]];
+        }
+    }
+    std::cout << "  校验和 " << sum << "，每种访问方式 10 轮：\n";
+    TraceRegistry::instance().dump(std::cout);
+}
+
+// 空作用域计时埋点的平均开销
+void bench(int n) {
+    LatencyHistogram h;
+    double tTrace = timeIt([&]() {
+        for (int i = 0; i < n; ++i) {
+            ScopedLatency t(h);
+        }
+    });
+    LatencyHistogram direct;
+    double tRecord = timeIt([&]() {
+        for (int i = 0; i < n; ++i) direct.record(static_cast<uint64_t>(i & 1023));
+    });
+    std::cout << "  " << n << " 次：ScopedLatency 每次 " << tTrace * 1e6 / n << " ns，record 每次 "
+              << tRecord * 1e6 / n << " ns\n";
+    std::cout << "  空作用域自身的计时分布: p50=" << h.percentile(50) << " ns，p99=" << h.percentile(99)
+              << " ns，max=" << h.max() << " ns\n";
+}
+
+int main() {
+#ifdef _WIN32
+    SetConsoleOutputCP(CP_UTF8);
+    SetConsoleCP(CP_UTF8);
+#endif
+    std::string cmd;
+    printMenu();
+    while (true) {
+        std::cout << "> ";
+        if (!(std::cin >> cmd)) break;
+        try {
+            if (cmd == "array" || cmd == "list" || cmd == "stack" || cmd == "queue" || cmd == "deque" ||
+                cmd == "perf" || cmd == "bench") {
+                int n;
+                if (!(std::cin >> n) || n <= 0) {
+                    std::cout << "输入有误。用法: " << cmd << " <正整数>\n";
+                    clearInput();
+                    continue;
+                }
+                if (cmd == "array") runArray(n);
+                else if (cmd == "list") runList(n);
+                else if (cmd == "stack") runStack(n);
+                else if (cmd == "queue") runQueue(n);
+                else if (cmd == "deque") runDeque(n);
+                else if (cmd == "perf") perfDemo(n);
+                else bench(n);
+            } else if (cmd == "dump") {
+                TraceRegistry::instance().dump(std::cout);
+            } else if (cmd == "hist") {
+                std::string name;
+                if (!(std::cin >> name)) {
+                    std::cout << "输入有误。用法: hist <名称>\n";
+                    clearInput();
+                    continue;
+                }
+                LatencyHistogram* h = TraceRegistry::instance().find(name);
+                if (h == nullptr) std::cout << "没有名为 " << name << " 的直方图。\n";
+                else h->dump(std::cout);
+            } else if (cmd == "record") {
+                unsigned long long v;
+                if (!(std::cin >> v)) {
+                    std::cout << "输入有误。用法: record <值>\n";
+                    clearInput();
+                    continue;
+                }
+                LatencyHistogram& h = TraceRegistry::instance().histogram("manual", "value");
+                h.record(v);
+                std::cout << "桶 [" << LatencyHistogram::bucketLower(LatencyHistogram::bucketIndex(v)) << ", "
+                          << LatencyHistogram::bucketUpper(LatencyHistogram::bucketIndex(v)) << "]，共 "
+                          << h.count() << " 个记录\n";
+            } else if (cmd == "reset") {
+                TraceRegistry::instance().reset();
+                std::cout << "已清空所有直方图。\n";
+            } else if (cmd == "help") {
+                printMenu();
+            } else if (cmd == "exit" || cmd == "0") {
+                std::cout << "程序结束，再见！\n";
+                break;
+            } else {
+                std::cout << "未知命令。输入 help 查看菜单。\n";
+            }
+        } catch (const std::exception& e) {
+            std::cout << "错误: " << e.what() << "\n";
+        }
+        clearInput();
+    }
+    return 0;
+}
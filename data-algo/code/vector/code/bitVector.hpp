@@ -0,0 +1,444 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+/**
+ * @brief 统计64位字中1的个数，优先使用硬件 popcount 指令
+ * @param word 64位字
+ * @return 1的个数
+ */
+inline int bitPopcount(uint64_t word) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_popcountll(word);
+#elif defined(_MSC_VER) && defined(_M_X64)
+    return static_cast<int>(__popcnt64(word));
+#else
+    word = word - ((word >> 1) & 0x5555555555555555ULL);
+    word = (word & 0x3333333333333333ULL) + ((word >> 2) & 0x3333333333333333ULL);
+    word = (word + (word >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+    return static_cast<int>((word * 0x0101010101010101ULL) >> 56);
+#endif
+}
+
+/**
+ * @brief 在64位字中查找第k个（从0计）为1的位
+ * @param word 64位字，至少含k+1个1
+ * @param k 序号
+ * @return 该位的位置（0~63）
+ */
+inline int bitSelectInWord(uint64_t word, int k) {
+    for (int i = 0; i < k; ++i)
+        word &= word - 1;   // 清除最低位的1
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctzll(word);
+#else
+    int pos = 0;
+    while (!(word & 1)) {
+        word >>= 1;
+        ++pos;
+    }
+    return pos;
+#endif
+}
+
+/**
+ * @brief 位压缩的位向量
+ *
+ * 每个64位字存放64个标志，相比 Vector<bool>/Array<bool> 每个标志占1字节节省8倍内存。
+ * 区间置位/清零/翻转与位图之间的与/或/异或都按字并行处理，count() 使用硬件 popcount。
+ *
+ * rank/select 依赖一个辅助索引：每512位（8个字）记录一次此前1的累计个数，
+ * 额外空间约为位图的 1/8。索引在第一次 rank/select 时按需构建，修改位图后失效并自动重建；
+ * 多线程并发查询前应先调用 buildIndex()。
+ */
+class BitVector {
+private:
+    std::vector<uint64_t> words;            ///< 位数据，第i位位于 words[i/64] 的第 i%64 位
+    size_t bits;                            ///< 位数
+    mutable std::vector<uint64_t> blockRank;  ///< 每个超级块之前1的累计个数，末尾为总数
+    mutable bool indexValid;                ///< 索引是否与位数据一致
+
+    static const int WORD_BITS = 64;
+    static const int BLOCK_WORDS = 8;       ///< 每个超级块的字数（512位）
+
+    static size_t wordCount(size_t n) { return (n + WORD_BITS - 1) / WORD_BITS; }
+    void checkIndex(size_t pos) const;
+    void checkRange(size_t first, size_t last) const;
+    void clearTail();
+    template<typename Op>
+    void applyRange(size_t first, size_t last, Op op);
+
+public:
+    /**
+     * @brief 构造函数
+     * @param n 位数
+     * @param value 所有位的初值
+     */
+    explicit BitVector(size_t n = 0, bool value = false);
+
+    /**
+     * @brief 获取位数
+     * @return 位数
+     */
+    size_t size() const { return bits; }
+
+    /**
+     * @brief 判断是否没有任何位
+     * @return 位数为0返回true
+     */
+    bool empty() const { return bits == 0; }
+
+    /**
+     * @brief 调整位数，新增的位取value
+     * @param n 新位数
+     * @param value 新增位的值
+     */
+    void resize(size_t n, bool value = false);
+
+    /**
+     * @brief 在末尾追加一位
+     * @param value 位的值
+     */
+    void push_back(bool value);
+
+    /**
+     * @brief 读取一位
+     * @param pos 位置
+     * @return 该位是否为1
+     * @throws std::out_of_range 如果越界
+     */
+    bool test(size_t pos) const;
+
+    /**
+     * @brief 读取一位（无越界检查）
+     * @param pos 位置
+     * @return 该位是否为1
+     */
+    bool operator[](size_t pos) const { return (words[pos / WORD_BITS] >> (pos % WORD_BITS)) & 1; }
+
+    /**
+     * @brief 单个位置1/清零/翻转
+     * @param pos 位置
+     * @throws std::out_of_range 如果越界
+     */
+    void set(size_t pos);
+    void reset(size_t pos);
+    void flip(size_t pos);
+
+    /**
+     * @brief 区间 [first, last) 批量置1/清零/翻转，按整字处理
+     * @param first 起始位置
+     * @param last 结束位置（不含）
+     * @throws std::out_of_range 如果区间越界或 first > last
+     */
+    void set(size_t first, size_t last);
+    void reset(size_t first, size_t last);
+    void flip(size_t first, size_t last);
+
+    /**
+     * @brief 全部置1/清零/翻转
+     */
+    void setAll();
+    void resetAll();
+    void flipAll();
+
+    /**
+     * @brief 与另一个等长位图按字做与/或/异或
+     * @param other 另一个位图
+     * @return 当前对象的引用
+     * @throws std::invalid_argument 如果位数不同
+     */
+    BitVector& operator&=(const BitVector& other);
+    BitVector& operator|=(const BitVector& other);
+    BitVector& operator^=(const BitVector& other);
+
+    /**
+     * @brief 统计1的个数
+     * @return 1的个数
+     */
+    size_t count() const;
+
+    /**
+     * @brief 是否存在为1的位
+     * @return 存在返回true
+     */
+    bool any() const;
+
+    /**
+     * @brief 构建 rank/select 辅助索引，O(n/64)
+     */
+    void buildIndex() const;
+
+    /**
+     * @brief 统计 [0, pos) 中1的个数，O(1)
+     * @param pos 位置，可等于 size()
+     * @return 1的个数
+     * @throws std::out_of_range 如果 pos > size()
+     */
+    size_t rank(size_t pos) const;
+
+    /**
+     * @brief 查找第k个（从0计）为1的位，超级块上二分后在块内逐字查找，O(log n)
+     * @param k 序号
+     * @return 该位的位置
+     * @throws std::out_of_range 如果1的个数不足k+1个
+     */
+    size_t select(size_t k) const;
+
+    /**
+     * @brief 底层字数组（最后一个字中超出 size() 的位恒为0）
+     * @return 首字地址
+     */
+    const uint64_t* data() const { return words.empty() ? nullptr : &words[0]; }
+
+    /**
+     * @brief 占用的字节数（不含索引）
+     * @return 字节数
+     */
+    size_t bytes() const { return words.size() * sizeof(uint64_t); }
+
+    bool operator==(const BitVector& other) const { return bits == other.bits && words == other.words; }
+    bool operator!=(const BitVector& other) const { return !(*this == other); }
+};
+
+// ================== 实现部分 ==================
+
+// 构造函数，按初值填充整字
+inline BitVector::BitVector(size_t n, bool value)
+    : words(wordCount(n), value ? ~0ULL : 0ULL), bits(n), indexValid(false) {
+    clearTail();
+}
+
+// 检查单个位置
+inline void BitVector::checkIndex(size_t pos) const {
+    if (pos >= bits)
+        throw std::out_of_range("Index out of range");
+}
+
+// 检查区间
+inline void BitVector::checkRange(size_t first, size_t last) const {
+    if (first > last || last > bits)
+        throw std::out_of_range("Range out of range");
+}
+
+// 把最后一个字中超出 size() 的位清零，保证 count/比较 不受影响
+inline void BitVector::clearTail() {
+    size_t used = bits % WORD_BITS;
+    if (used != 0)
+        words.back() &= (1ULL << used) - 1;
+}
+
+// 对区间内每个字调用 op(字, 掩码)，首尾不完整的字用掩码截取
+template<typename Op>
+void BitVector::applyRange(size_t first, size_t last, Op op) {
+    checkRange(first, last);
+    if (first == last)
+        return;
+    indexValid = false;
+    size_t firstWord = first / WORD_BITS, lastWord = (last - 1) / WORD_BITS;
+    uint64_t headMask = ~0ULL << (first % WORD_BITS);
+    uint64_t tailMask = ~0ULL >> (WORD_BITS - 1 - (last - 1) % WORD_BITS);
+    if (firstWord == lastWord) {
+        op(words[firstWord], headMask & tailMask);
+        return;
+    }
+    op(words[firstWord], headMask);
+    for (size_t w = firstWord + 1; w < lastWord; ++w)
+        op(words[w], ~0ULL);
+    op(words[lastWord], tailMask);
+}
+
+// 调整位数
+inline void BitVector::resize(size_t n, bool value) {
+    size_t old = bits;
+    words.resize(wordCount(n), 0);
+    bits = n;
+    if (n > old && value)
+        set(old, n);
+    clearTail();
+    indexValid = false;
+}
+
+// 末尾追加一位
+inline void BitVector::push_back(bool value) {
+    if (bits % WORD_BITS == 0)
+        words.push_back(0);
+    if (value)
+        words.back() |= 1ULL << (bits % WORD_BITS);
+    ++bits;
+    indexValid = false;
+}
+
+// 读取一位
+inline bool BitVector::test(size_t pos) const {
+    checkIndex(pos);
+    return (*this)[pos];
+}
+
+// 单个位置1
+inline void BitVector::set(size_t pos) {
+    checkIndex(pos);
+    words[pos / WORD_BITS] |= 1ULL << (pos % WORD_BITS);
+    indexValid = false;
+}
+
+// 单个位清零
+inline void BitVector::reset(size_t pos) {
+    checkIndex(pos);
+    words[pos / WORD_BITS] &= ~(1ULL << (pos % WORD_BITS));
+    indexValid = false;
+}
+
+// 单个位翻转
+inline void BitVector::flip(size_t pos) {
+    checkIndex(pos);
+    words[pos / WORD_BITS] ^= 1ULL << (pos % WORD_BITS);
+    indexValid = false;
+}
+
+// 区间置1
+inline void BitVector::set(size_t first, size_t last) {
+    applyRange(first, last, [](uint64_t& w, uint64_t mask) { w |= mask; });
+}
+
+// 区间清零
+inline void BitVector::reset(size_t first, size_t last) {
+    applyRange(first, last, [](uint64_t& w, uint64_t mask) { w &= ~mask; });
+}
+
+// 区间翻转
+inline void BitVector::flip(size_t first, size_t last) {
+    applyRange(first, last, [](uint64_t& w, uint64_t mask) { w ^= mask; });
+}
+
+// 全部置1
+inline void BitVector::setAll() {
+    for (size_t w = 0; w < words.size(); ++w)
+        words[w] = ~0ULL;
+    clearTail();
+    indexValid = false;
+}
+
+// 全部清零
+inline void BitVector::resetAll() {
+    for (size_t w = 0; w < words.size(); ++w)
+        words[w] = 0;
+    indexValid = false;
+}
+
+// 全部翻转
+inline void BitVector::flipAll() {
+    for (size_t w = 0; w < words.size(); ++w)
+        words[w] = ~words[w];
+    clearTail();
+    indexValid = false;
+}
+
+// 按字求与
+inline BitVector& BitVector::operator&=(const BitVector& other) {
+    if (bits != other.bits)
+        throw std::invalid_argument("BitVector sizes differ");
+    for (size_t w = 0; w < words.size(); ++w)
+        words[w] &= other.words[w];
+    indexValid = false;
+    return *this;
+}
+
+// 按字求或
+inline BitVector& BitVector::operator|=(const BitVector& other) {
+    if (bits != other.bits)
+        throw std::invalid_argument("BitVector sizes differ");
+    for (size_t w = 0; w < words.size(); ++w)
+        words[w] |= other.words[w];
+    indexValid = false;
+    return *this;
+}
+
+// 按字求异或
+inline BitVector& BitVector::operator^=(const BitVector& other) {
+    if (bits != other.bits)
+        throw std::invalid_argument("BitVector sizes differ");
+    for (size_t w = 0; w < words.size(); ++w)
+        words[w] ^= other.words[w];
+    indexValid = false;
+    return *this;
+}
+
+// 逐字 popcount 求和；索引有效时直接取总数（有效的索引至少有末尾的总数一项）
+inline size_t BitVector::count() const {
+    if (indexValid && !blockRank.empty())
+        return blockRank.back();
+    size_t total = 0;
+    for (size_t w = 0; w < words.size(); ++w)
+        total += bitPopcount(words[w]);
+    return total;
+}
+
+// 是否存在为1的位
+inline bool BitVector::any() const {
+    for (size_t w = 0; w < words.size(); ++w)
+        if (words[w])
+            return true;
+    return false;
+}
+
+// 构建超级块累计计数
+inline void BitVector::buildIndex() const {
+    if (indexValid)
+        return;
+    size_t blocks = (words.size() + BLOCK_WORDS - 1) / BLOCK_WORDS;
+    blockRank.assign(blocks + 1, 0);
+    uint64_t total = 0;
+    for (size_t b = 0; b < blocks; ++b) {
+        blockRank[b] = total;
+        size_t end = (b + 1) * BLOCK_WORDS < words.size() ? (b + 1) * BLOCK_WORDS : words.size();
+        for (size_t w = b * BLOCK_WORDS; w < end; ++w)
+            total += bitPopcount(words[w]);
+    }
+    blockRank[blocks] = total;
+    indexValid = true;
+}
+
+// 超级块累计值 + 块内至多7个整字 + 末字掩码后的 popcount
+inline size_t BitVector::rank(size_t pos) const {
+    if (pos > bits)
+        throw std::out_of_range("Index out of range");
+    buildIndex();
+    size_t word = pos / WORD_BITS;
+    size_t block = word / BLOCK_WORDS;
+    size_t result = blockRank[block];
+    for (size_t w = block * BLOCK_WORDS; w < word; ++w)
+        result += bitPopcount(words[w]);
+    size_t offset = pos % WORD_BITS;
+    if (offset != 0)
+        result += bitPopcount(words[word] & ((1ULL << offset) - 1));
+    return result;
+}
+
+// 在超级块累计值上二分定位，再在块内逐字递减
+inline size_t BitVector::select(size_t k) const {
+    buildIndex();
+    if (k >= blockRank.back())
+        throw std::out_of_range("Not enough set bits");
+    // 找最后一个 blockRank[b] <= k 的超级块
+    size_t lo = 0, hi = blockRank.size() - 1;
+    while (hi - lo > 1) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (blockRank[mid] <= k)
+            lo = mid;
+        else
+            hi = mid;
+    }
+    size_t remaining = k - blockRank[lo];
+    for (size_t w = lo * BLOCK_WORDS;; ++w) {
+        size_t ones = bitPopcount(words[w]);
+        if (remaining < ones)
+            return w * WORD_BITS + bitSelectInWord(words[w], static_cast<int>(remaining));
+        remaining -= ones;
+    }
+}
@@ -0,0 +1,369 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <stdexcept>
+#include <vector>
+
+/**
+ * @brief 分块压缩的无符号整数序列（只追加）
+ *
+ * 每128个值为一块，逐块选择更窄的编码：
+ * - 参照系（FOR）：存块内最小值，其余存与最小值之差
+ * - 差分（DELTA）：块内单调不减时存首值，其余存与前一个值之差
+ * 差值按块内最大位宽 w 紧密位打包，一块恰好占 2w 个64位字，w=0 时不占空间。
+ * 最后一个不满128个的块以原值暂存，凑满后再编码。
+ *
+ * 每块有一个块头（基准值、位宽、编码方式、数据起始字），作为跳转指针：
+ * 随机访问直接定位到块，FOR 块 O(1) 取值，DELTA 块从最近的块内检查点（每32个值一个）
+ * 起累加至多31个差值；
+ * 顺序遍历每次解码整块到缓冲区。解包循环定长、无分支，便于编译器向量化。
+ *
+ * 对间隔很小的有序ID列表，相比每个值8字节通常可节省4~8倍以上内存。
+ */
+class CompressedIntVector {
+public:
+    static const int BLOCK_SIZE = 128;   ///< 每块的值个数
+    static const int CHECKPOINT_STRIDE = 32;   ///< DELTA 块内检查点间隔
+
+    /// 块的编码方式
+    enum Encoding { FRAME_OF_REFERENCE = 0, DELTA = 1 };
+
+private:
+    /// 块头，即块的跳转指针
+    struct BlockHeader {
+        uint64_t base;       ///< FOR 为块内最小值，DELTA 为块内首值
+        uint64_t checkpoint[BLOCK_SIZE / CHECKPOINT_STRIDE - 1];   ///< DELTA 块第32/64/96个值与首值之差
+        uint32_t offset;     ///< 数据在 packed 中的起始字下标
+        uint8_t width;       ///< 位宽（0~64）
+        uint8_t encoding;    ///< 编码方式
+    };
+
+    std::vector<BlockHeader> blocks;   ///< 已编码块的块头
+    std::vector<uint64_t> packed;      ///< 所有块的位打包数据，末尾多留一个0字便于无分支读取
+    uint64_t pending[BLOCK_SIZE];      ///< 尚未凑满一块的原值
+    int pendingCount;                  ///< pending 中的值个数
+
+    static int bitWidth(uint64_t v);
+    static uint64_t lowMask(int width) { return width >= 64 ? ~0ULL : ((1ULL << width) - 1); }
+    static uint64_t unpackOne(const uint64_t* words, int width, int j);
+    static void unpackBlock(const uint64_t* words, int width, uint64_t* out);
+    void encodePending();
+
+public:
+    /**
+     * @brief 构造空序列
+     */
+    CompressedIntVector();
+
+    /**
+     * @brief 由区间构造
+     * @param first 区间起始迭代器
+     * @param last 区间尾后迭代器
+     */
+    template<typename InputIt>
+    CompressedIntVector(InputIt first, InputIt last);
+
+    /**
+     * @brief 在末尾追加一个值，凑满一块时编码，均摊O(1)
+     * @param value 值
+     */
+    void push_back(uint64_t value);
+
+    /**
+     * @brief 获取值的个数
+     * @return 个数
+     */
+    size_t size() const { return blocks.size() * BLOCK_SIZE + pendingCount; }
+
+    /**
+     * @brief 判断是否为空
+     * @return 为空返回true
+     */
+    bool empty() const { return size() == 0; }
+
+    /**
+     * @brief 清空
+     */
+    void clear();
+
+    /**
+     * @brief 随机访问，FOR 块 O(1)，DELTA 块至多累加31个差值
+     * @param index 下标
+     * @return 该位置的值
+     * @throws std::out_of_range 如果下标越界
+     */
+    uint64_t get(size_t index) const;
+
+    /**
+     * @brief 把第 b 块解码到 out
+     * @param b 块序号（最后一个未编码的块序号为 blockCount()-1）
+     * @param out 输出缓冲区，至少 BLOCK_SIZE 个
+     * @return 该块的值个数
+     * @throws std::out_of_range 如果块序号越界
+     */
+    int decodeBlock(size_t b, uint64_t* out) const;
+
+    /**
+     * @brief 块数（含未凑满的最后一块）
+     * @return 块数
+     */
+    size_t blockCount() const { return blocks.size() + (pendingCount > 0 ? 1 : 0); }
+
+    /**
+     * @brief 按顺序逐块解码并把每个值交给 visit
+     * @param visit 回调
+     */
+    template<typename F>
+    void forEach(F visit) const;
+
+    /**
+     * @brief 占用的字节数（块头、打包数据与暂存区）
+     * @return 字节数
+     */
+    size_t bytes() const;
+
+    /**
+     * @brief 统计两种编码的块数
+     * @param forBlocks 输出 FOR 块数
+     * @param deltaBlocks 输出 DELTA 块数
+     */
+    void encodingStats(size_t& forBlocks, size_t& deltaBlocks) const;
+
+    /**
+     * @brief 顺序只读迭代器，内部缓存一整块解码结果
+     */
+    class const_iterator {
+    public:
+        typedef std::input_iterator_tag iterator_category;
+        typedef uint64_t value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef const uint64_t* pointer;
+        typedef const uint64_t& reference;
+
+        const_iterator() : owner(nullptr), index(0) {}
+        const uint64_t& operator*() const { return buffer[index % BLOCK_SIZE]; }
+        const_iterator& operator++();
+        const_iterator operator++(int) { const_iterator old = *this; ++*this; return old; }
+        bool operator==(const const_iterator& other) const { return index == other.index; }
+        bool operator!=(const const_iterator& other) const { return index != other.index; }
+
+    private:
+        friend class CompressedIntVector;
+        const_iterator(const CompressedIntVector* owner, size_t index);
+        void load();
+
+        const CompressedIntVector* owner;
+        size_t index;                  ///< 当前下标
+        uint64_t buffer[BLOCK_SIZE];   ///< index 所在块的解码结果
+    };
+
+    const_iterator begin() const { return const_iterator(this, 0); }
+    const_iterator end() const { return const_iterator(this, size()); }
+};
+
+// ================== 实现部分 ==================
+
+// 构造空序列，打包数据只有末尾的填充字
+inline CompressedIntVector::CompressedIntVector() : packed(1, 0), pendingCount(0) {}
+
+// 由区间构造
+template<typename InputIt>
+CompressedIntVector::CompressedIntVector(InputIt first, InputIt last) : packed(1, 0), pendingCount(0) {
+    for (; first != last; ++first)
+        push_back(*first);
+}
+
+// 表示v所需的最少位数
+inline int CompressedIntVector::bitWidth(uint64_t v) {
+#if defined(__GNUC__) || defined(__clang__)
+    return v == 0 ? 0 : 64 - __builtin_clzll(v);
+#else
+    int w = 0;
+    while (v) {
+        ++w;
+        v >>= 1;
+    }
+    return w;
+#endif
+}
+
+// 取出第j个打包值；跨字时拼接下一个字，移位写成两步避免 shift==0 时移64位
+inline uint64_t CompressedIntVector::unpackOne(const uint64_t* words, int width, int j) {
+    if (width == 0)
+        return 0;   // 位宽为0的块不占字，words 可能已是末尾填充字
+    size_t bit = static_cast<size_t>(j) * width;
+    size_t word = bit >> 6;
+    unsigned shift = bit & 63;
+    uint64_t lo = words[word] >> shift;
+    uint64_t hi = (words[word + 1] << 1) << (63 - shift);
+    return (lo | hi) & lowMask(width);
+}
+
+// 解包整块：定长循环、无数据相关分支
+inline void CompressedIntVector::unpackBlock(const uint64_t* words, int width, uint64_t* out) {
+    if (width == 0) {
+        for (int j = 0; j < BLOCK_SIZE; ++j)
+            out[j] = 0;
+        return;
+    }
+    uint64_t mask = lowMask(width);
+    for (int j = 0; j < BLOCK_SIZE; ++j) {
+        size_t bit = static_cast<size_t>(j) * width;
+        size_t word = bit >> 6;
+        unsigned shift = bit & 63;
+        out[j] = ((words[word] >> shift) | ((words[word + 1] << 1) << (63 - shift))) & mask;
+    }
+}
+
+// 把凑满的暂存块编码：比较两种编码的位宽，取较窄者（相同时取可O(1)随机访问的 FOR）
+inline void CompressedIntVector::encodePending() {
+    uint64_t minValue = pending[0], maxValue = pending[0], maxDelta = 0;
+    bool sorted = true;
+    for (int j = 1; j < BLOCK_SIZE; ++j) {
+        if (pending[j] < minValue) minValue = pending[j];
+        if (pending[j] > maxValue) maxValue = pending[j];
+        if (pending[j] < pending[j - 1])
+            sorted = false;
+        else if (pending[j] - pending[j - 1] > maxDelta)
+            maxDelta = pending[j] - pending[j - 1];
+    }
+    BlockHeader header;
+    header.encoding = FRAME_OF_REFERENCE;
+    header.base = minValue;
+    header.width = static_cast<uint8_t>(bitWidth(maxValue - minValue));
+    if (sorted && bitWidth(maxDelta) < header.width) {
+        header.encoding = DELTA;
+        header.base = pending[0];
+        header.width = static_cast<uint8_t>(bitWidth(maxDelta));
+    }
+    for (int q = 1; q < BLOCK_SIZE / CHECKPOINT_STRIDE; ++q)
+        header.checkpoint[q - 1] = pending[q * CHECKPOINT_STRIDE] - pending[0];
+    if (packed.size() - 1 + 2 * header.width > UINT32_MAX)
+        throw std::length_error("CompressedIntVector is too large");
+    // 原来的填充字成为本块的第一个字，扩展后末尾仍是一个0填充字
+    size_t start = packed.size() - 1;
+    header.offset = static_cast<uint32_t>(start);
+    packed.resize(packed.size() + 2 * header.width, 0);
+    for (int j = 0; j < BLOCK_SIZE && header.width > 0; ++j) {
+        uint64_t v = header.encoding == DELTA ? (j == 0 ? 0 : pending[j] - pending[j - 1])
+                                              : pending[j] - minValue;
+        size_t bit = static_cast<size_t>(j) * header.width;
+        size_t word = start + (bit >> 6);
+        unsigned shift = bit & 63;
+        packed[word] |= v << shift;
+        if (shift + header.width > 64)
+            packed[word + 1] |= v >> (64 - shift);
+    }
+    blocks.push_back(header);
+    pendingCount = 0;
+}
+
+// 末尾追加
+inline void CompressedIntVector::push_back(uint64_t value) {
+    pending[pendingCount++] = value;
+    if (pendingCount == BLOCK_SIZE) {
+        try {
+            encodePending();
+        } catch (...) {
+            --pendingCount;
+            throw;
+        }
+    }
+}
+
+// 清空
+inline void CompressedIntVector::clear() {
+    blocks.clear();
+    packed.assign(1, 0);
+    pendingCount = 0;
+}
+
+// 随机访问：由块头跳到所在块
+inline uint64_t CompressedIntVector::get(size_t index) const {
+    if (index >= size())
+        throw std::out_of_range("Index out of range");
+    size_t b = index / BLOCK_SIZE;
+    int j = static_cast<int>(index % BLOCK_SIZE);
+    if (b == blocks.size())
+        return pending[j];
+    const BlockHeader& header = blocks[b];
+    const uint64_t* words = &packed[header.offset];
+    if (header.encoding == FRAME_OF_REFERENCE)
+        return header.base + unpackOne(words, header.width, j);
+    // DELTA 块：从 j 之前最近的检查点起累加差值
+    int q = j / CHECKPOINT_STRIDE;
+    uint64_t value = header.base + (q == 0 ? 0 : header.checkpoint[q - 1]);
+    for (int k = q * CHECKPOINT_STRIDE + 1; k <= j; ++k)
+        value += unpackOne(words, header.width, k);
+    return value;
+}
+
+// 解码一整块：先解包，再按编码加基准值或求前缀和
+inline int CompressedIntVector::decodeBlock(size_t b, uint64_t* out) const {
+    if (b >= blockCount())
+        throw std::out_of_range("Block index out of range");
+    if (b == blocks.size()) {
+        for (int j = 0; j < pendingCount; ++j)
+            out[j] = pending[j];
+        return pendingCount;
+    }
+    const BlockHeader& header = blocks[b];
+    unpackBlock(&packed[header.offset], header.width, out);
+    if (header.encoding == FRAME_OF_REFERENCE) {
+        for (int j = 0; j < BLOCK_SIZE; ++j)
+            out[j] += header.base;
+    } else {
+        out[0] = header.base;
+        for (int j = 1; j < BLOCK_SIZE; ++j)
+            out[j] += out[j - 1];
+    }
+    return BLOCK_SIZE;
+}
+
+// 逐块解码后回调
+template<typename F>
+void CompressedIntVector::forEach(F visit) const {
+    uint64_t buffer[BLOCK_SIZE];
+    for (size_t b = 0; b < blockCount(); ++b) {
+        int n = decodeBlock(b, buffer);
+        for (int j = 0; j < n; ++j)
+            visit(buffer[j]);
+    }
+}
+
+// 占用字节数
+inline size_t CompressedIntVector::bytes() const {
+    return blocks.size() * sizeof(BlockHeader) + packed.size() * sizeof(uint64_t) + sizeof(pending);
+}
+
+// 统计两种编码的块数
+inline void CompressedIntVector::encodingStats(size_t& forBlocks, size_t& deltaBlocks) const {
+    forBlocks = deltaBlocks = 0;
+    for (size_t b = 0; b < blocks.size(); ++b) {
+        if (blocks[b].encoding == DELTA)
+            ++deltaBlocks;
+        else
+            ++forBlocks;
+    }
+}
+
+// 迭代器构造：定位到 index，首次解引用前解码所在块
+inline CompressedIntVector::const_iterator::const_iterator(const CompressedIntVector* owner, size_t index)
+    : owner(owner), index(index) {
+    if (index < owner->size())
+        load();
+}
+
+// 解码 index 所在的块
+inline void CompressedIntVector::const_iterator::load() {
+    owner->decodeBlock(index / BLOCK_SIZE, buffer);
+}
+
+// 前进一位，跨块时解码下一块
+inline CompressedIntVector::const_iterator& CompressedIntVector::const_iterator::operator++() {
+    ++index;
+    if (index % BLOCK_SIZE == 0 && index < owner->size())
+        load();
+    return *this;
+}
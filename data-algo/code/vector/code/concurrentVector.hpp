@@ -0,0 +1,407 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+/**
+ * @brief 分段存储、只追加的并发动态数组
+ *
+ * 元素存放在大小按2倍递增的段中：第k段容量为 FIRST_SEGMENT << k，已有段从不搬移，
+ * 元素地址在整个生命周期内保持不变。下标 i 所在的段由 i + FIRST_SEGMENT 的最高位直接算出。
+ *
+ * - push_back/grow_by 先确保所需的段已分配（段按需由 CAS 安装），再用 CAS 预留槽位，不加锁；
+ *   段分配失败时不预留任何槽位，已预留的槽位总能标记为就绪或失败，前缀推进不会停滞
+ * - 每个槽位带一个就绪标志；size() 返回“全部已构造完成的最长前缀”的长度，
+ *   由完成构造的线程协作推进，读者看到的 [0, size()) 中元素都已构造完毕
+ * - operator[] 只有一次原子读取段指针加下标运算，无等待
+ * - clear()、析构与 reserve 以外的容量操作不能与其他操作并发
+ *
+ * @tparam T 元素类型
+ */
+template<typename T>
+class ConcurrentVector {
+public:
+    static const int FIRST_SHIFT = 4;                      ///< 第0段容量的对数
+    static const size_t FIRST_SEGMENT = size_t(1) << FIRST_SHIFT;   ///< 第0段容量
+    static const int MAX_SEGMENTS = 44;                    ///< 段数上限，总容量约 2^48
+
+private:
+    enum SlotState : unsigned char { EMPTY = 0, READY = 1, FAILED = 2 };
+
+    std::atomic<char*> segments[MAX_SEGMENTS];  ///< 各段内存：先放元素，再放就绪标志
+    std::atomic<size_t> reserved;               ///< 已预留的槽位数
+    std::atomic<size_t> committed;              ///< 已构造完成的最长前缀长度
+
+    static size_t segmentSize(int k) { return FIRST_SEGMENT << k; }
+    static int highestBit(size_t v);
+    static void locate(size_t index, int& segment, size_t& offset);
+    static T* slots(char* raw) { return reinterpret_cast<T*>(raw); }
+    static std::atomic<unsigned char>* flags(char* raw, int k) {
+        return reinterpret_cast<std::atomic<unsigned char>*>(raw + sizeof(T) * segmentSize(k));
+    }
+
+    char* ensureSegment(int k);
+    size_t reserveSlots(size_t n);
+    void publish(size_t first, size_t count, unsigned char state);
+    void advance();
+
+public:
+    /**
+     * @brief 构造函数，初始化空数组，不分配内存
+     */
+    ConcurrentVector();
+
+    /**
+     * @brief 析构函数，销毁全部已构造的元素并释放各段（不能与其他操作并发）
+     */
+    ~ConcurrentVector();
+
+    ConcurrentVector(const ConcurrentVector&) = delete;
+    ConcurrentVector& operator=(const ConcurrentVector&) = delete;
+
+    /**
+     * @brief 追加一个元素，线程安全、不加锁
+     * @param value 元素值
+     * @return 新元素的下标；返回后该下标上的元素即可由本线程访问
+     */
+    size_t push_back(const T& value) { return emplace_back(value); }
+    size_t push_back(T&& value) { return emplace_back(std::move(value)); }
+
+    /**
+     * @brief 原地构造并追加一个元素，线程安全、不加锁
+     * @param args 构造参数
+     * @return 新元素的下标
+     */
+    template<typename... Args>
+    size_t emplace_back(Args&&... args);
+
+    /**
+     * @brief 一次预留 n 个连续槽位并以 value 填充，线程安全、不加锁
+     * @param n 追加个数
+     * @param value 填充值
+     * @return 第一个新元素的下标
+     */
+    size_t grow_by(size_t n, const T& value = T());
+
+    /**
+     * @brief 下标访问，不检查越界，无等待
+     * @param index 下标，调用者须确保该元素已构造完成（例如 index < size()，或是本线程追加的）
+     * @return 元素引用，地址在数组生命周期内不变
+     */
+    T& operator[](size_t index);
+    const T& operator[](size_t index) const;
+
+    /**
+     * @brief 带检查的下标访问
+     * @param index 下标
+     * @return 元素引用
+     * @throws std::out_of_range 如果 index >= size()
+     */
+    T& at(size_t index);
+    const T& at(size_t index) const;
+
+    /**
+     * @brief 已构造完成的最长前缀长度，[0, size()) 中的元素都可安全读取
+     * @return 元素个数
+     */
+    size_t size() const { return committed.load(std::memory_order_acquire); }
+
+    /**
+     * @brief 判断是否为空
+     * @return 为空返回true
+     */
+    bool empty() const { return size() == 0; }
+
+    /**
+     * @brief 已预留的槽位数（包括仍在构造中的元素）
+     * @return 槽位数
+     */
+    size_t reservedSize() const { return reserved.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief 已分配的段能容纳的元素个数
+     * @return 容量
+     */
+    size_t capacity() const;
+
+    /**
+     * @brief 预先分配能容纳 n 个元素的段，线程安全
+     * @param n 目标容量
+     */
+    void reserve(size_t n);
+
+    /**
+     * @brief 按下标顺序访问 [0, size()) 中的元素，可与追加并发
+     * @param visit 回调 visit(value)
+     */
+    template<typename F>
+    void forEach(F visit) const;
+
+    /**
+     * @brief 销毁全部元素，保留已分配的段（不能与其他操作并发）
+     */
+    void clear();
+};
+
+// ================== 实现部分 ==================
+
+template<typename T> const int ConcurrentVector<T>::FIRST_SHIFT;
+template<typename T> const size_t ConcurrentVector<T>::FIRST_SEGMENT;
+template<typename T> const int ConcurrentVector<T>::MAX_SEGMENTS;
+
+// 构造函数，所有段指针置空
+template<typename T>
+ConcurrentVector<T>::ConcurrentVector() : reserved(0), committed(0) {
+    for (int k = 0; k < MAX_SEGMENTS; ++k)
+        segments[k].store(nullptr, std::memory_order_relaxed);
+}
+
+// 析构函数：销毁已构造的元素，释放各段
+template<typename T>
+ConcurrentVector<T>::~ConcurrentVector() {
+    clear();
+    for (int k = 0; k < MAX_SEGMENTS; ++k) {
+        char* raw = segments[k].load(std::memory_order_relaxed);
+        if (raw != nullptr) ::operator delete(raw);
+    }
+}
+
+// 最高位的位置（v > 0）
+template<typename T>
+int ConcurrentVector<T>::highestBit(size_t v) {
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<int>(sizeof(unsigned long long) * 8 - 1) - __builtin_clzll(v);
+#else
+    int pos = 0;
+    while (v >>= 1) ++pos;
+    return pos;
+#endif
+}
+
+// 下标映射：v = index + FIRST_SEGMENT 的最高位决定段号，去掉最高位即段内偏移
+template<typename T>
+void ConcurrentVector<T>::locate(size_t index, int& segment, size_t& offset) {
+    size_t v = index + FIRST_SEGMENT;
+    int h = highestBit(v);
+    segment = h - FIRST_SHIFT;
+    offset = v - (size_t(1) << h);
+}
+
+// 确保第k段已分配：多个线程同时发现缺段时各自分配，CAS 失败者释放自己的那份
+template<typename T>
+char* ConcurrentVector<T>::ensureSegment(int k) {
+    if (k >= MAX_SEGMENTS) {
+        throw std::length_error("ConcurrentVector capacity exceeded");
+    }
+    char* raw = segments[k].load(std::memory_order_acquire);
+    if (raw != nullptr) return raw;
+    size_t n = segmentSize(k);
+    char* fresh = static_cast<char*>(::operator new(sizeof(T) * n + n));
+    std::atomic<unsigned char>* state = flags(fresh, k);
+    for (size_t i = 0; i < n; ++i)
+        new (&state[i]) std::atomic<unsigned char>(EMPTY);
+    char* expected = nullptr;
+    if (segments[k].compare_exchange_strong(expected, fresh, std::memory_order_acq_rel)) {
+        return fresh;
+    }
+    ::operator delete(fresh);
+    return expected;
+}
+
+// 标记 [first, first + count) 的状态，然后推进已提交前缀。
+// 快速路径：已提交前缀恰好停在 first 时，直接用一次 CAS 越过本批槽位，不必等其他线程看到标志
+template<typename T>
+void ConcurrentVector<T>::publish(size_t first, size_t count, unsigned char state) {
+    for (size_t i = first; i < first + count; ++i) {
+        int k;
+        size_t off;
+        locate(i, k, off);
+        flags(segments[k].load(std::memory_order_relaxed), k)[off].store(state, std::memory_order_release);
+    }
+    size_t expected = first;
+    if (count == 0 || !committed.compare_exchange_strong(expected, first + count)) {
+        // 慢速路径：以全序重新写入标志，保证与其他线程的 advance() 互相可见
+        for (size_t i = first; i < first + count; ++i) {
+            int k;
+            size_t off;
+            locate(i, k, off);
+            flags(segments[k].load(std::memory_order_relaxed), k)[off].store(state);
+        }
+    }
+    advance();
+}
+
+// 推进已提交前缀：只要下一个槽位已就绪（或构造失败）就前移一格。
+// 任何完成构造的线程都会尝试推进，最后完成的线程会把前缀推到底，因此不会停滞。
+// 标志的写入与这里的读取都用全序：否则两个线程可能各自写完标志后都看不到对方的标志而同时退出
+template<typename T>
+void ConcurrentVector<T>::advance() {
+    size_t c = committed.load();
+    while (c < reserved.load()) {
+        int k;
+        size_t off;
+        locate(c, k, off);
+        char* raw = segments[k].load(std::memory_order_acquire);
+        if (raw == nullptr || flags(raw, k)[off].load() == EMPTY)
+            return;
+        // 失败时 c 被更新为其他线程推进后的值，继续从那里检查
+        if (committed.compare_exchange_weak(c, c + 1))
+            ++c;
+    }
+}
+
+// 预留 n 个连续槽位：先确保覆盖这些槽位的段都已分配，再用 CAS 预留；其他线程抢先预留时按新位置重来。
+// 段分配失败（或超出容量上限）时异常在预留之前抛出，不留下无法标记的槽位
+template<typename T>
+size_t ConcurrentVector<T>::reserveSlots(size_t n) {
+    size_t first = reserved.load(std::memory_order_relaxed);
+    while (true) {
+        if (first + n < first) {
+            throw std::length_error("ConcurrentVector capacity exceeded");
+        }
+        int lo, hi;
+        size_t off;
+        locate(first, lo, off);
+        locate(first + n - 1, hi, off);
+        for (int k = lo; k <= hi; ++k) ensureSegment(k);
+        if (reserved.compare_exchange_weak(first, first + n, std::memory_order_relaxed)) return first;
+    }
+}
+
+// 原地构造并追加：确保段存在并预留槽位 -> 构造 -> 发布
+template<typename T>
+template<typename... Args>
+size_t ConcurrentVector<T>::emplace_back(Args&&... args) {
+    size_t index = reserveSlots(1);
+    int k;
+    size_t off;
+    locate(index, k, off);
+    try {
+        new (slots(segments[k].load(std::memory_order_acquire)) + off) T(std::forward<Args>(args)...);
+    } catch (...) {
+        publish(index, 1, FAILED);   // 槽位已被预留，标记为失败以免阻塞前缀推进
+        throw;
+    }
+    publish(index, 1, READY);
+    return index;
+}
+
+// 批量追加：一次预留连续槽位，可能跨越多个段
+template<typename T>
+size_t ConcurrentVector<T>::grow_by(size_t n, const T& value) {
+    if (n == 0) return reserved.load(std::memory_order_relaxed);
+    size_t first = reserveSlots(n);
+    size_t done = 0;
+    try {
+        for (; done < n; ++done) {
+            int k;
+            size_t off;
+            locate(first + done, k, off);
+            new (slots(segments[k].load(std::memory_order_acquire)) + off) T(value);
+        }
+    } catch (...) {
+        // 已构造的照常发布，其余已预留的槽位标记为失败
+        publish(first, done, READY);
+        publish(first + done, n - done, FAILED);
+        throw;
+    }
+    publish(first, n, READY);
+    return first;
+}
+
+// 下标访问，不检查越界
+template<typename T>
+T& ConcurrentVector<T>::operator[](size_t index) {
+    int k;
+    size_t off;
+    locate(index, k, off);
+    return slots(segments[k].load(std::memory_order_acquire))[off];
+}
+
+// 下标访问（常量版本）
+template<typename T>
+const T& ConcurrentVector<T>::operator[](size_t index) const {
+    int k;
+    size_t off;
+    locate(index, k, off);
+    return slots(segments[k].load(std::memory_order_acquire))[off];
+}
+
+// 带检查的下标访问：越界或该槽位构造失败时抛出异常
+template<typename T>
+T& ConcurrentVector<T>::at(size_t index) {
+    return const_cast<T&>(static_cast<const ConcurrentVector&>(*this).at(index));
+}
+
+// 带检查的下标访问（常量版本）
+template<typename T>
+const T& ConcurrentVector<T>::at(size_t index) const {
+    if (index >= size()) {
+        throw std::out_of_range("Index out of range");
+    }
+    int k;
+    size_t off;
+    locate(index, k, off);
+    char* raw = segments[k].load(std::memory_order_acquire);
+    if (flags(raw, k)[off].load(std::memory_order_acquire) != READY) {
+        throw std::out_of_range("Element construction failed");
+    }
+    return slots(raw)[off];
+}
+
+// 已分配的段的总容量
+template<typename T>
+size_t ConcurrentVector<T>::capacity() const {
+    size_t total = 0;
+    for (int k = 0; k < MAX_SEGMENTS; ++k) {
+        if (segments[k].load(std::memory_order_acquire) != nullptr) total += segmentSize(k);
+    }
+    return total;
+}
+
+// 预先分配覆盖 [0, n) 的所有段
+template<typename T>
+void ConcurrentVector<T>::reserve(size_t n) {
+    if (n == 0) return;
+    int k;
+    size_t off;
+    locate(n - 1, k, off);
+    for (int i = 0; i <= k; ++i) ensureSegment(i);
+}
+
+// 按下标顺序访问已提交的元素，逐段处理以省去每个元素的段计算
+template<typename T>
+template<typename F>
+void ConcurrentVector<T>::forEach(F visit) const {
+    size_t n = size();
+    size_t index = 0;
+    for (int k = 0; index < n; ++k) {
+        char* raw = segments[k].load(std::memory_order_acquire);
+        std::atomic<unsigned char>* state = flags(raw, k);
+        size_t count = segmentSize(k) < n - index ? segmentSize(k) : n - index;
+        for (size_t i = 0; i < count; ++i) {
+            if (state[i].load(std::memory_order_relaxed) == READY) visit(slots(raw)[i]);
+        }
+        index += count;
+    }
+}
+
+// 销毁全部元素并重置就绪标志，段保留以便复用
+template<typename T>
+void ConcurrentVector<T>::clear() {
+    size_t n = reserved.load(std::memory_order_relaxed);
+    for (size_t i = 0; i < n; ++i) {
+        int k;
+        size_t off;
+        locate(i, k, off);
+        char* raw = segments[k].load(std::memory_order_relaxed);
+        if (raw == nullptr) continue;
+        std::atomic<unsigned char>& state = flags(raw, k)[off];
+        if (state.load(std::memory_order_relaxed) == READY) slots(raw)[off].~T();
+        state.store(EMPTY, std::memory_order_relaxed);
+    }
+    reserved.store(0, std::memory_order_relaxed);
+    committed.store(0, std::memory_order_relaxed);
+}
@@ -0,0 +1,773 @@
+#pragma once
+#include "vector.hpp"
+#include <algorithm>
+#include <chrono>
+#include <climits>
+#include <cstddef>
+#include <cstdio>
+#include <deque>
+#include <functional>
+#include <future>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define DS_MMAP_SUPPORTED 1
+#endif
+
+/**
+ * @brief 超出内存的外部归并排序
+ *
+ * 分两个阶段：
+ * - 生成有序段：元素先追加到 Vector<T> 缓冲区，缓冲区达到预算的一半时排序，交给后台线程整段写入
+ *   临时文件，同时在另一半预算的缓冲区中继续接收元素（双缓冲），排序与写盘重叠进行
+ * - 多路归并：每个有序段一个游标，游标持有两个块，消费当前块时后台线程预读下一块；
+ *   按游标的当前元素建小根堆，每次取出堆顶元素写入输出块，输出块写满后交给后台线程写盘，
+ *   同时填充另一个输出块。段数超过预算允许的路数时，先把前若干段归并成更长的段，再继续
+ *
+ * 内存占用不超过预算：生成阶段为两个各占一半预算的缓冲区；归并阶段为 路数×2 个输入块加 2 个输出块。
+ * 临时文件在归并读完后立即删除，析构时删除所有剩余临时文件。
+ *
+ * @tparam T 元素类型，必须可平凡复制（按字节写入文件）
+ * @tparam Compare 比较器
+ */
+template<typename T, typename Compare = std::less<T>>
+class ExternalSorter {
+    static_assert(std::is_trivially_copyable<T>::value, "ExternalSorter requires a trivially copyable element type");
+
+public:
+    /**
+     * @brief 一次排序的统计信息
+     */
+    struct Stats {
+        unsigned long long elements;       ///< 元素个数
+        unsigned long long inputBytes;     ///< 输入字节数
+        unsigned long long bytesWritten;   ///< 写入临时文件与输出文件的字节数
+        unsigned long long bytesRead;      ///< 从临时文件读回的字节数
+        int runs;                          ///< 生成的有序段数，全部在内存中排完时为 0
+        int merges;                        ///< 多路归并次数，包括直接写出结果的最后一次
+        double runMillis;                  ///< 生成阶段耗时（从第一次追加到 finish 开始）
+        double mergeMillis;                ///< 归并阶段耗时
+
+        /**
+         * @brief 整体吞吐量
+         * @return 输入字节数 / 总耗时，单位 MB/s（1 MB = 10^6 字节）
+         */
+        double throughputMBps() const {
+            double seconds = (runMillis + mergeMillis) / 1000.0;
+            return seconds > 0 ? inputBytes / 1e6 / seconds : 0.0;
+        }
+    };
+
+private:
+    /// 临时文件中的一个有序段
+    struct Run {
+        std::string path;
+        unsigned long long count;
+    };
+
+    /// 双缓冲写入：上一块在后台写盘时调用者填充下一块
+    struct BlockWriter {
+        std::FILE* file;
+        std::string path;
+        Vector<T> spare;                  ///< 正在写盘的块
+        std::future<void> pending;        ///< 正在进行的写盘
+        unsigned long long count;         ///< 已交给本文件的元素个数
+
+        BlockWriter() : file(nullptr), count(0) {}
+        ~BlockWriter() { abandon(); }
+        void open(const std::string& target);
+        void write(Vector<T>& block);
+        void close();
+        void abandon();
+    };
+
+    /// 归并游标：消费 current 时后台线程把下一块读入 spare
+    struct Cursor {
+        std::FILE* file;
+        unsigned long long unread;        ///< 尚未发起读取的元素个数
+        Vector<T> current;
+        int pos;
+        Vector<T> spare;
+        std::future<void> pending;
+
+        Cursor() : file(nullptr), unread(0), pos(0) {}
+        ~Cursor();
+    };
+
+    Compare less;
+    size_t memoryBudget;                 ///< 内存预算（字节）
+    int blockElements;                   ///< 每个读写块的元素个数
+    int runCapacity;                     ///< 每个生成缓冲区的元素个数（预算的一半）
+    int fanIn;                           ///< 每次多路归并的最大路数
+    std::string filePrefix;              ///< 临时文件路径前缀：目录 + 本对象的随机标识
+    unsigned long long fileSeq;          ///< 临时文件序号
+
+    Vector<T> filling;                   ///< 正在接收元素的缓冲区
+    BlockWriter runWriter;               ///< 正在写盘的有序段
+    std::deque<Run> runs;                ///< 已写完的有序段
+    Stats current;                       ///< 本次排序的统计
+    bool started;                        ///< 本次排序是否已追加过元素
+    bool failed;                         ///< 有序段写盘失败、已有元素丢失，clear() 之前拒绝继续
+    std::chrono::steady_clock::time_point startTime;
+
+    static void writeAll(std::FILE* file, const T* data, size_t n);
+    static void readAll(std::FILE* file, T* data, size_t n);
+
+    std::string nextPath() { return filePrefix + std::to_string(fileSeq++) + ".run"; }
+    void resetStats();
+    void checkIntact() const;
+    void makeRoom();
+    void sealRun();
+    void closeRun();
+    bool advance(Cursor& cursor);
+    void startRead(Cursor& cursor);
+    template<typename Emit>
+    void mergeRuns(size_t n, Emit emit);
+    template<typename Emit>
+    Stats produce(Emit emit);
+    void removeRuns();
+
+public:
+    /**
+     * @brief 构造函数
+     * @param memoryBudget 内存预算（字节），至少能容纳6个块
+     * @param tempDirectory 临时文件目录，需已存在且可写
+     * @param blockBytes 每次顺序读写的字节数
+     * @param compare 比较器
+     * @throws std::invalid_argument 如果预算不足6个块
+     */
+    explicit ExternalSorter(size_t memoryBudget, const std::string& tempDirectory = ".",
+                            size_t blockBytes = 1 << 20, const Compare& compare = Compare());
+
+    /**
+     * @brief 析构函数，等待后台读写结束并删除所有临时文件
+     */
+    ~ExternalSorter() { removeRuns(); }
+
+    ExternalSorter(const ExternalSorter&) = delete;
+    ExternalSorter& operator=(const ExternalSorter&) = delete;
+
+    /**
+     * @brief 追加一个待排序元素，缓冲区满时排序并在后台写出一个有序段
+     * @param value 元素值
+     * @throws std::runtime_error 如果临时文件写入失败。写盘失败的有序段已丢失，
+     *         此后 push、push_n、finish 都抛出异常，直到调用 clear()
+     */
+    void push(const T& value);
+
+    /**
+     * @brief 批量追加 n 个元素
+     * @param values 元素数组
+     * @param n 个数
+     * @throws std::runtime_error 如果临时文件写入失败（之后的行为同 push）
+     */
+    void push_n(const T* values, size_t n);
+
+    /**
+     * @brief 完成排序，把结果按块顺序写入文件
+     * @param outputPath 输出文件路径，已存在时覆盖；失败时删除不完整的输出
+     * @return 本次排序的统计
+     * @throws std::runtime_error 如果读写失败，或之前有有序段写盘失败；抛出时放弃本次排序
+     */
+    Stats finish(const std::string& outputPath);
+
+    /**
+     * @brief 完成排序，把结果按块依次交给 sink
+     * @param sink 可调用对象 sink(const T* block, int count)，按升序依次收到各块
+     * @return 本次排序的统计
+     * @throws std::runtime_error 如果读写失败，或之前有有序段写盘失败；抛出时放弃本次排序
+     */
+    template<typename F>
+    Stats finishWith(F sink);
+
+    /**
+     * @brief 排序一个由 T 的原始字节组成的文件
+     * @param inputPath 输入文件路径
+     * @param outputPath 输出文件路径，可与输入相同
+     * @return 本次排序的统计
+     * @throws std::runtime_error 如果读写失败或文件长度不是 sizeof(T) 的整数倍
+     */
+    Stats sortFile(const std::string& inputPath, const std::string& outputPath);
+
+    /**
+     * @brief 放弃本次排序：清空缓冲区并删除所有临时文件
+     */
+    void clear();
+
+    /**
+     * @brief 本次已追加的元素个数
+     * @return 元素个数
+     */
+    unsigned long long size() const { return current.elements; }
+
+    /**
+     * @brief 当前已写出的有序段数（包括正在写盘的一段）
+     * @return 段数
+     */
+    int runCount() const { return static_cast<int>(runs.size()) + (runWriter.file != nullptr ? 1 : 0); }
+
+    /**
+     * @brief 每个有序段最多的元素个数
+     * @return 元素个数
+     */
+    int runSize() const { return runCapacity; }
+
+    /**
+     * @brief 每次多路归并的最大路数
+     * @return 路数
+     */
+    int mergeFanIn() const { return fanIn; }
+};
+
+/**
+ * @brief 以只读方式映射到内存的数组文件
+ *
+ * 把由 T 的原始字节组成的文件（如 ExternalSorter::finish 的输出）映射为只读数组，
+ * 按需由操作系统换入，不必把整个文件读入内存。不支持 mmap 的平台上整个读入堆内存。
+ *
+ * @tparam T 元素类型，必须可平凡复制
+ */
+template<typename T>
+class MappedVector {
+    static_assert(std::is_trivially_copyable<T>::value, "MappedVector requires a trivially copyable element type");
+
+private:
+    const T* base;       ///< 首元素地址，空文件为 nullptr
+    size_t count;        ///< 元素个数
+    size_t bytes;        ///< 映射的字节数
+
+    void release();
+
+public:
+    /**
+     * @brief 映射文件
+     * @param path 文件路径
+     * @throws std::runtime_error 如果打开或映射失败，或文件长度不是 sizeof(T) 的整数倍
+     */
+    explicit MappedVector(const std::string& path);
+
+    /**
+     * @brief 析构函数，解除映射
+     */
+    ~MappedVector() { release(); }
+
+    MappedVector(const MappedVector&) = delete;
+    MappedVector& operator=(const MappedVector&) = delete;
+    MappedVector(MappedVector&& other) noexcept : base(other.base), count(other.count), bytes(other.bytes) {
+        other.base = nullptr;
+        other.count = 0;
+        other.bytes = 0;
+    }
+
+    size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+    const T* data() const { return base; }
+    const T* begin() const { return base; }
+    const T* end() const { return base + count; }
+
+    /**
+     * @brief 下标访问，不检查越界
+     */
+    const T& operator[](size_t index) const { return base[index]; }
+
+    /**
+     * @brief 带检查的下标访问
+     * @throws std::out_of_range 如果 index >= size()
+     */
+    const T& at(size_t index) const {
+        if (index >= count) {
+            throw std::out_of_range("Index out of range");
+        }
+        return base[index];
+    }
+};
+
+// ================== 实现部分 ==================
+
+// 构造函数：按预算计算生成缓冲区大小与归并路数
+template<typename T, typename Compare>
+ExternalSorter<T, Compare>::ExternalSorter(size_t memoryBudget, const std::string& tempDirectory,
+                                           size_t blockBytes, const Compare& compare)
+    : less(compare), memoryBudget(memoryBudget), blockElements(0), runCapacity(0), fanIn(0), fileSeq(0),
+      started(false), failed(false) {
+    size_t block = blockBytes / sizeof(T) > 0 ? blockBytes / sizeof(T) : 1;
+    if (block > INT_MAX) block = INT_MAX;
+    size_t blocks = memoryBudget / (block * sizeof(T));
+    if (blocks < 6) {
+        throw std::invalid_argument("ExternalSorter memory budget must hold at least 6 blocks");
+    }
+    size_t run = memoryBudget / 2 / sizeof(T);
+    blockElements = static_cast<int>(block);
+    runCapacity = run > INT_MAX ? INT_MAX : static_cast<int>(run);
+    // 每路两个输入块，另留两个输出块
+    fanIn = static_cast<int>(blocks / 2 - 1 > INT_MAX ? INT_MAX : blocks / 2 - 1);
+    // 随机标识避免多个排序器（包括其他进程中的）共用目录时文件名冲突
+    std::random_device rd;
+    filePrefix = tempDirectory + "/extsort_" + std::to_string(rd()) + "_" + std::to_string(rd()) + "_";
+    resetStats();
+}
+
+// 整块写入
+template<typename T, typename Compare>
+void ExternalSorter<T, Compare>::writeAll(std::FILE* file, const T* data, size_t n) {
+    if (std::fwrite(data, sizeof(T), n, file) != n) {
+        throw std::runtime_error("ExternalSorter: cannot write temporary file");
+    }
+}
+
+// 整块读取
+template<typename T, typename Compare>
+void ExternalSorter<T, Compare>::readAll(std::FILE* file, T* data, size_t n) {
+    if (std::fread(data, sizeof(T), n, file) != n) {
+        throw std::runtime_error("ExternalSorter: temporary file truncated");
+    }
+}
+
+// 打开输出文件
+template<typename T, typename Compare>
+void ExternalSorter<T, Compare>::BlockWriter::open(const std::string& target) {
+    file = std::fopen(target.c_str(), "wb");
+    if (file == nullptr) {
+        throw std::runtime_error("ExternalSorter: cannot create file " + target);
+    }
+    path = target;
+    count = 0;
+}
+
+// 交出一块：等上一块写完，与之交换缓冲区，在后台写出本块；返回时 block 为空，可继续填充
+template<typename T, typename Compare>
+void ExternalSorter<T, Compare>::BlockWriter::write(Vector<T>& block) {
+    if (pending.valid()) pending.get();
+    spare.clear();
+    spare.swap(block);
+    count += static_cast<unsigned long long>(spare.size());
+    pending = std::async(std::launch::async, &ExternalSorter::writeAll, file, spare.data(),
+                         static_cast<size_t>(spare.size()));
+}
+
+// 等最后一块写完并关闭文件；失败时删除文件并抛出异常
+template<typename T, typename Compare>
+void ExternalSorter<T, Compare>::BlockWriter::close() {
+    try {
+        if (pending.valid()) pending.get();
+    } catch (...) {
+        abandon();
+        throw;
+    }
+    bool ok = std::fclose(file) == 0;
+    file = nullptr;
+    if (!ok) {
+        std::remove(path.c_str());
+        throw std::runtime_error("ExternalSorter: cannot write file " + path);
+    }
+}
+
+// 放弃写入：等后台写盘结束，关闭并删除文件
+template<typename T, typename Compare>
+void ExternalSorter<T, Compare>::BlockWriter::abandon() {
+    if (pending.valid()) pending.wait();
+    pending = std::future<void>();
+    if (file != nullptr) {
+        std::fclose(file);
+        file = nullptr;
+        std::remove(path.c_str());
+    }
+}
+
+// 游标析构：预读线程可能仍在读文件，先等它结束再关闭
+template<typename T, typename Compare>
+ExternalSorter<T, Compare>::Cursor::~Cursor() {
+    if (pending.valid()) pending.wait();
+    if (file != nullptr) std::fclose(file);
+}
+
+// 开始新一次排序的统计
+template<typename T, typename Compare>
+void ExternalSorter<T, Compare>::resetStats() {
+    current.elements = 0;
+    current.inputBytes = 0;
+    current.bytesWritten = 0;
+    current.bytesRead = 0;
+    current.runs = 0;
+    current.merges = 0;
+    current.runMillis = 0;
+    current.mergeMillis = 0;
+    started = false;
+}
+
+// 有序段写盘失败后，已计数的元素不在任何地方，继续排序会得到缺少元素的结果
+template<typename T, typename Compare>
+void ExternalSorter<T, Compare>::checkIntact() const {
+    if (failed) {
+        throw std::runtime_error("ExternalSorter: a run was lost after a write error, call clear() first");
+    }
+}
+
+// 缓冲区已满：达到段长时写出一个有序段；缓冲区是刚换回来的空缓冲区时按段长预留容量
+template<typename T, typename Compare>
+void ExternalSorter<T, Compare>::makeRoom() {
+    if (!started) {
+        started = true;
+        startTime = std::chrono::steady_clock::now();
+    }
+    if (filling.size() >= runCapacity) sealRun();
+    if (filling.capacity() < runCapacity) filling.reserve(runCapacity);
+}
+
+// 写出有序段：在本线程排序（与上一段的写盘重叠），再把缓冲区交给后台写盘，换回上一段的缓冲区继续接收
+template<typename T, typename Compare>
+void ExternalSorter<T, Compare>::sealRun() {
+    std::sort(filling.begin(), filling.end(), less);
+    if (runWriter.file != nullptr) closeRun();
+    runWriter.open(nextPath());
+    current.bytesWritten += static_cast<unsigned long long>(filling.size()) * sizeof(T);
+    try {
+        runWriter.write(filling);   // 返回后 filling 持有上一段写盘用过的缓冲区（已清空）
+    } catch (...) {
+        failed = true;   // 缓冲区已交给写入器，后台写盘没有启动
+        throw;
+    }
+}
+
+// 等正在写盘的有序段完成并记录；失败时该段文件已删除，其中的元素丢失
+template<typename T, typename Compare>
+void ExternalSorter<T, Compare>::closeRun() {
+    Run run;
+    run.path = runWriter.path;
+    run.count = runWriter.count;
+    try {
+        runWriter.close();
+    } catch (...) {
+        failed = true;
+        throw;
+    }
+    runs.push_back(run);
+    ++current.runs;
+}
+
+// 追加一个元素
+template<typename T, typename Compare>
+void ExternalSorter<T, Compare>::push(const T& value) {
+    checkIntact();
+    if (filling.size() == filling.capacity()) makeRoom();
+    filling.push_back(value);
+    ++current.elements;
+}
+
+// 批量追加：按缓冲区剩余空间整段复制
+template<typename T, typename Compare>
+void ExternalSorter<T, Compare>::push_n(const T* values, size_t n) {
+    checkIntact();
+    while (n > 0) {
+        if (filling.size() == filling.capacity()) makeRoom();
+        size_t room = static_cast<size_t>(filling.capacity() - filling.size());
+        int k = static_cast<int>(n < room ? n : room);
+        int old = filling.size();
+        filling.resize(old + k);
+        std::copy(values, values + k, filling.data() + old);
+        values += k;
+        n -= k;
+        current.elements += k;
+    }
+}
+
+// 发起游标下一块的后台读取
+template<typename T, typename Compare>
+void ExternalSorter<T, Compare>::startRead(Cursor& cursor) {
+    if (cursor.unread == 0) return;
+    int n = cursor.unread < static_cast<unsigned long long>(blockElements) ? static_cast<int>(cursor.unread)
+                                                                           : blockElements;
+    cursor.spare.resize(n);
+    cursor.unread -= n;
+    current.bytesRead += static_cast<unsigned long long>(n) * sizeof(T);
+    cursor.pending = std::async(std::launch::async, &ExternalSorter::readAll, cursor.file, cursor.spare.data(),
+                                static_cast<size_t>(n));
+}
+
+// 游标换到下一块：等预读完成、交换缓冲区并预读再下一块；段已读完返回 false
+template<typename T, typename Compare>
+bool ExternalSorter<T, Compare>::advance(Cursor& cursor) {
+    if (!cursor.pending.valid()) return false;
+    cursor.pending.get();
+    cursor.current.swap(cursor.spare);
+    cursor.pos = 0;
+    startRead(cursor);
+    return true;
+}
+
+// 归并 runs 的前 n 段：按各游标当前元素建小根堆，输出块写满时交给 emit（emit 须清空该块）。
+// 读完的段立即删除
+template<typename T, typename Compare>
+template<typename Emit>
+void ExternalSorter<T, Compare>::mergeRuns(size_t n, Emit emit) {
+    std::vector<Cursor> cursors(n);
+    std::vector<int> heap;
+    heap.reserve(n);
+    for (size_t i = 0; i < n; ++i) {
+        cursors[i].file = std::fopen(runs[i].path.c_str(), "rb");
+        if (cursors[i].file == nullptr) {
+            throw std::runtime_error("ExternalSorter: cannot open file " + runs[i].path);
+        }
+        cursors[i].unread = runs[i].count;
+        startRead(cursors[i]);
+    }
+    // 堆序：游标当前元素小者在上
+    auto before = [&](int a, int b) {
+        const Cursor& x = cursors[a];
+        const Cursor& y = cursors[b];
+        return less(x.current[x.pos], y.current[y.pos]);
+    };
+    auto siftDown = [&](size_t i) {
+        size_t size = heap.size();
+        int item = heap[i];
+        while (true) {
+            size_t child = 2 * i + 1;
+            if (child >= size) break;
+            if (child + 1 < size && before(heap[child + 1], heap[child])) ++child;
+            if (!before(heap[child], item)) break;
+            heap[i] = heap[child];
+            i = child;
+        }
+        heap[i] = item;
+    };
+    for (size_t i = 0; i < n; ++i) {
+        if (advance(cursors[i])) heap.push_back(static_cast<int>(i));
+    }
+    for (size_t i = heap.size() / 2; i-- > 0;) siftDown(i);
+
+    Vector<T> out;
+    out.reserve(blockElements);
+    while (!heap.empty()) {
+        Cursor& top = cursors[heap[0]];
+        out.push_back(top.current[top.pos]);
+        if (out.size() == blockElements) {
+            emit(out);
+            if (out.capacity() < blockElements) out.reserve(blockElements);
+        }
+        if (++top.pos == top.current.size() && !advance(top)) {
+            heap[0] = heap.back();
+            heap.pop_back();
+            if (heap.empty()) break;
+        }
+        siftDown(0);
+    }
+    if (!out.empty()) emit(out);
+
+    for (size_t i = 0; i < n; ++i) {
+        std::fclose(cursors[i].file);
+        cursors[i].file = nullptr;
+        std::remove(runs.front().path.c_str());
+        runs.pop_front();
+    }
+}
+
+// 结束生成阶段并产生结果：全部在内存中时直接排序交出；否则写出最后一段，
+// 段数超过路数时先把前 fanIn 段归并成新段，最后一趟归并交给 emit。交出的元素个数须与追加的个数相同
+template<typename T, typename Compare>
+template<typename Emit>
+typename ExternalSorter<T, Compare>::Stats ExternalSorter<T, Compare>::produce(Emit emit) {
+    checkIntact();
+    unsigned long long emitted = 0;
+    auto counted = [&](Vector<T>& block) {
+        emitted += static_cast<unsigned long long>(block.size());
+        emit(block);
+    };
+    std::chrono::steady_clock::time_point mergeStart = std::chrono::steady_clock::now();
+    if (started) current.runMillis = std::chrono::duration<double, std::milli>(mergeStart - startTime).count();
+    current.inputBytes = current.elements * sizeof(T);
+
+    if (runWriter.file == nullptr && runs.empty()) {
+        std::sort(filling.begin(), filling.end(), less);
+        if (!filling.empty()) counted(filling);
+    } else {
+        if (!filling.empty()) sealRun();
+        if (runWriter.file != nullptr) closeRun();
+        // 归并阶段按块读写，释放生成阶段的两个缓冲区
+        Vector<T>().swap(filling);
+        Vector<T>().swap(runWriter.spare);
+        while (runs.size() > static_cast<size_t>(fanIn)) {
+            BlockWriter writer;
+            writer.open(nextPath());
+            mergeRuns(static_cast<size_t>(fanIn), [&](Vector<T>& block) {
+                current.bytesWritten += static_cast<unsigned long long>(block.size()) * sizeof(T);
+                writer.write(block);
+            });
+            writer.close();
+            Run run;
+            run.path = writer.path;
+            run.count = writer.count;
+            runs.push_back(run);
+            ++current.merges;
+        }
+        mergeRuns(runs.size(), counted);
+        ++current.merges;
+    }
+    if (emitted != current.elements) {
+        throw std::runtime_error("ExternalSorter: sorted output has " + std::to_string(emitted) + " of " +
+                                 std::to_string(current.elements) + " elements");
+    }
+
+    Stats result = current;
+    result.mergeMillis =
+        std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - mergeStart).count();
+    Vector<T>().swap(filling);
+    Vector<T>().swap(runWriter.spare);
+    resetStats();
+    return result;
+}
+
+// 完成排序并写入文件
+template<typename T, typename Compare>
+typename ExternalSorter<T, Compare>::Stats ExternalSorter<T, Compare>::finish(const std::string& outputPath) {
+    BlockWriter writer;
+    Stats result;
+    try {
+        writer.open(outputPath);
+        unsigned long long outputBytes = 0;
+        result = produce([&](Vector<T>& block) {
+            outputBytes += static_cast<unsigned long long>(block.size()) * sizeof(T);
+            writer.write(block);
+        });
+        writer.close();
+        result.bytesWritten += outputBytes;
+    } catch (...) {
+        clear();
+        throw;
+    }
+    return result;
+}
+
+// 完成排序并按块交给 sink
+template<typename T, typename Compare>
+template<typename F>
+typename ExternalSorter<T, Compare>::Stats ExternalSorter<T, Compare>::finishWith(F sink) {
+    try {
+        return produce([&](Vector<T>& block) {
+            sink(static_cast<const T*>(block.data()), block.size());
+            block.clear();
+        });
+    } catch (...) {
+        clear();
+        throw;
+    }
+}
+
+// 排序文件：按块读入并追加，读完后关闭输入，因此输出可以覆盖输入
+template<typename T, typename Compare>
+typename ExternalSorter<T, Compare>::Stats ExternalSorter<T, Compare>::sortFile(const std::string& inputPath,
+                                                                                const std::string& outputPath) {
+    std::FILE* file = std::fopen(inputPath.c_str(), "rb");
+    if (file == nullptr) {
+        throw std::runtime_error("ExternalSorter: cannot open file " + inputPath);
+    }
+    // 按字节读取，以便发现文件末尾不完整的元素
+    Vector<T> block(blockElements);
+    size_t blockBytes = static_cast<size_t>(blockElements) * sizeof(T);
+    size_t got = 0;
+    bool bad = false;
+    try {
+        while (!bad && (got = std::fread(block.data(), 1, blockBytes, file)) > 0) {
+            bad = got % sizeof(T) != 0;
+            push_n(block.data(), got / sizeof(T));
+        }
+    } catch (...) {
+        std::fclose(file);
+        throw;
+    }
+    bad = bad || std::ferror(file) != 0;
+    std::fclose(file);
+    if (bad) {
+        clear();
+        throw std::runtime_error("ExternalSorter: cannot read whole elements from " + inputPath);
+    }
+    return finish(outputPath);
+}
+
+// 放弃本次排序
+template<typename T, typename Compare>
+void ExternalSorter<T, Compare>::clear() {
+    removeRuns();
+    filling.clear();
+    failed = false;
+    resetStats();
+}
+
+// 删除全部临时文件，包括正在写盘的一段
+template<typename T, typename Compare>
+void ExternalSorter<T, Compare>::removeRuns() {
+    runWriter.abandon();
+    for (size_t i = 0; i < runs.size(); ++i) std::remove(runs[i].path.c_str());
+    runs.clear();
+}
+
+// 映射文件：POSIX 上用 mmap 只读映射，其他平台整个读入
+template<typename T>
+MappedVector<T>::MappedVector(const std::string& path) : base(nullptr), count(0), bytes(0) {
+#if defined(DS_MMAP_SUPPORTED)
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw std::runtime_error("MappedVector: cannot open file " + path);
+    }
+    struct stat info;
+    if (::fstat(fd, &info) != 0 || static_cast<size_t>(info.st_size) % sizeof(T) != 0) {
+        ::close(fd);
+        throw std::runtime_error("MappedVector: file size is not a multiple of the element size " + path);
+    }
+    bytes = static_cast<size_t>(info.st_size);
+    if (bytes > 0) {
+        void* p = ::mmap(nullptr, bytes, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (p == MAP_FAILED) {
+            ::close(fd);
+            throw std::runtime_error("MappedVector: cannot map file " + path);
+        }
+        base = static_cast<const T*>(p);
+    }
+    ::close(fd);
+#else
+    std::FILE* file = std::fopen(path.c_str(), "rb");
+    if (file == nullptr) {
+        throw std::runtime_error("MappedVector: cannot open file " + path);
+    }
+    std::fseek(file, 0, SEEK_END);
+    long size = std::ftell(file);
+    std::fseek(file, 0, SEEK_SET);
+    if (size < 0 || static_cast<size_t>(size) % sizeof(T) != 0) {
+        std::fclose(file);
+        throw std::runtime_error("MappedVector: file size is not a multiple of the element size " + path);
+    }
+    bytes = static_cast<size_t>(size);
+    if (bytes > 0) {
+        T* p = static_cast<T*>(::operator new(bytes));
+        size_t got = std::fread(p, 1, bytes, file);
+        if (got != bytes) {
+            ::operator delete(p);
+            std::fclose(file);
+            throw std::runtime_error("MappedVector: cannot read file " + path);
+        }
+        base = p;
+    }
+    std::fclose(file);
+#endif
+    count = bytes / sizeof(T);
+}
+
+// 解除映射
+template<typename T>
+void MappedVector<T>::release() {
+    if (base == nullptr) return;
+#if defined(DS_MMAP_SUPPORTED)
+    ::munmap(const_cast<T*>(base), bytes);
+#else
+    ::operator delete(const_cast<T*>(base));
+#endif
+    base = nullptr;
+}
@@ -0,0 +1,442 @@
+#pragma once
+#include <cstddef>
+#include <new>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+/**
+ * @brief 连续列视图，指向 SoaVector 中某一字段的整列数据
+ *
+ * 只记录首地址与长度，不拥有内存；容器扩容、插入或删除后失效。
+ *
+ * @tparam T 字段类型（可为 const）
+ */
+template<typename T>
+class ColumnSpan {
+private:
+    T* ptr;      ///< 列首地址
+    int count;   ///< 元素个数
+
+public:
+    ColumnSpan(T* ptr, int count) : ptr(ptr), count(count) {}
+
+    T* data() const noexcept { return ptr; }
+    int size() const noexcept { return count; }
+    bool empty() const noexcept { return count == 0; }
+    T& operator[](int index) const { return ptr[index]; }
+    T* begin() const noexcept { return ptr; }
+    T* end() const noexcept { return ptr + count; }
+};
+
+/**
+ * @brief 列式存储（structure-of-arrays）动态数组
+ *
+ * 每个字段单独存放在一块按缓存行（64 字节）对齐的连续数组中，
+ * 只扫描一两个字段时不会把其余字段一起载入缓存，列视图可直接交给向量化循环。
+ * 所有列共享同一长度与容量，push_back/erase 等操作同时作用于每一列。
+ *
+ * 行访问返回字段引用组成的 std::tuple，可用结构化绑定：
+ * `auto [id, price] = soa[i];`。需要 C++17（-std=c++17）。
+ *
+ * @tparam Fields 各字段类型，至少一个
+ */
+template<typename... Fields>
+class SoaVector {
+    static_assert(sizeof...(Fields) > 0, "SoaVector needs at least one field");
+
+public:
+    /// 第 I 个字段的类型
+    template<std::size_t I>
+    using FieldType = typename std::tuple_element<I, std::tuple<Fields...>>::type;
+
+    using Row = std::tuple<Fields&...>;               ///< 可修改的行引用
+    using ConstRow = std::tuple<const Fields&...>;    ///< 只读的行引用
+    using Value = std::tuple<Fields...>;              ///< 行的值拷贝
+
+    static constexpr std::size_t COLUMN_ALIGNMENT = 64;  ///< 每列的最小对齐字节数
+
+private:
+    using Indices = std::index_sequence_for<Fields...>;
+
+    std::tuple<Fields*...> columns;   ///< 各列首地址
+    int length;                       ///< 行数
+    int cap;                          ///< 每列容量
+
+    static const int INITIAL_CAPACITY = 16;   ///< 首次扩容的容量
+
+    template<typename T>
+    static constexpr std::size_t alignmentOf() {
+        return alignof(T) > COLUMN_ALIGNMENT ? alignof(T) : COLUMN_ALIGNMENT;
+    }
+    template<typename T>
+    static T* allocateColumn(int n);
+    template<typename T>
+    static void deallocateColumn(T* column);
+
+    template<std::size_t... I>
+    void reallocate(int newCap, std::index_sequence<I...>);
+    template<std::size_t... I>
+    void constructRow(int index, std::index_sequence<I...>, const Fields&... values);
+    template<std::size_t... I>
+    void destroyRow(int index, std::index_sequence<I...>);
+    template<std::size_t... I>
+    void shiftDown(int index, std::index_sequence<I...>);
+    template<std::size_t... I>
+    void releaseColumns(std::index_sequence<I...>);
+    template<std::size_t... I>
+    Row rowAt(int index, std::index_sequence<I...>);
+    template<std::size_t... I>
+    ConstRow rowAt(int index, std::index_sequence<I...>) const;
+
+public:
+    /**
+     * @brief 构造空容器，不分配内存
+     */
+    SoaVector();
+
+    /**
+     * @brief 拷贝构造函数，逐列深拷贝
+     * @param other 被拷贝的容器
+     */
+    SoaVector(const SoaVector& other);
+
+    /**
+     * @brief 移动构造函数，接管各列内存
+     * @param other 被移动的容器，之后为空
+     */
+    SoaVector(SoaVector&& other) noexcept;
+
+    /**
+     * @brief 赋值操作符（拷贝并交换）
+     * @param other 被赋值的容器
+     * @return 当前对象的引用
+     */
+    SoaVector& operator=(SoaVector other) noexcept;
+
+    /**
+     * @brief 析构函数，析构所有元素并释放各列
+     */
+    ~SoaVector();
+
+    /**
+     * @brief 获取行数
+     * @return 行数
+     */
+    int size() const noexcept { return length; }
+
+    /**
+     * @brief 获取每列容量
+     * @return 容量
+     */
+    int capacity() const noexcept { return cap; }
+
+    /**
+     * @brief 判断是否为空
+     * @return 为空返回true
+     */
+    bool empty() const noexcept { return length == 0; }
+
+    /**
+     * @brief 预留容量，所有列同时扩容
+     * @param n 目标容量
+     */
+    void reserve(int n);
+
+    /**
+     * @brief 在尾部追加一行，容量不足时倍增扩容，均摊O(1)
+     * @param values 各字段的值
+     */
+    void push_back(const Fields&... values);
+
+    /**
+     * @brief 以 tuple 形式追加一行
+     * @param row 行的值
+     */
+    void push_back(const Value& row);
+
+    /**
+     * @brief 删除尾部一行
+     * @throws std::out_of_range 如果为空
+     */
+    void pop_back();
+
+    /**
+     * @brief 删除指定行，后续行整体前移，各列保持对齐，O(n)
+     * @param index 行下标
+     * @throws std::out_of_range 如果下标越界
+     */
+    void erase(int index);
+
+    /**
+     * @brief 清空所有行，保留容量
+     */
+    void clear() noexcept;
+
+    /**
+     * @brief 与另一个容器交换内容
+     * @param other 另一个容器
+     */
+    void swap(SoaVector& other) noexcept;
+
+    /**
+     * @brief 行访问（无越界检查）
+     * @param index 行下标
+     * @return 各字段引用组成的 tuple
+     */
+    Row operator[](int index) { return rowAt(index, Indices()); }
+    ConstRow operator[](int index) const { return rowAt(index, Indices()); }
+
+    /**
+     * @brief 带越界检查的行访问
+     * @param index 行下标
+     * @return 各字段引用组成的 tuple
+     * @throws std::out_of_range 如果下标越界
+     */
+    Row at(int index);
+    ConstRow at(int index) const;
+
+    /**
+     * @brief 获取第 I 个字段的整列视图
+     * @tparam I 字段序号
+     * @return 列视图，长度为 size()
+     */
+    template<std::size_t I>
+    ColumnSpan<FieldType<I>> column() noexcept {
+        return ColumnSpan<FieldType<I>>(std::get<I>(columns), length);
+    }
+    template<std::size_t I>
+    ColumnSpan<const FieldType<I>> column() const noexcept {
+        return ColumnSpan<const FieldType<I>>(std::get<I>(columns), length);
+    }
+};
+
+// ================== 实现部分 ==================
+
+// 按列对齐要求分配未初始化的内存
+template<typename... Fields>
+template<typename T>
+T* SoaVector<Fields...>::allocateColumn(int n) {
+    return static_cast<T*>(::operator new(sizeof(T) * static_cast<std::size_t>(n),
+                                          std::align_val_t(alignmentOf<T>())));
+}
+
+// 释放 allocateColumn 分配的内存
+template<typename... Fields>
+template<typename T>
+void SoaVector<Fields...>::deallocateColumn(T* column) {
+    if (column)
+        ::operator delete(column, std::align_val_t(alignmentOf<T>()));
+}
+
+// 所有列一起换到新容量：先分配全部新列，再把每列元素搬入新列，全部成功后才析构旧元素、释放旧列。
+// 只有所有列都能不抛异常地移动时才移动（不可拷贝的列也只能移动），否则一律拷贝；
+// 某列拷贝抛出异常时析构已搬入的元素并释放新列，旧列保持不变
+template<typename... Fields>
+template<std::size_t... I>
+void SoaVector<Fields...>::reallocate(int newCap, std::index_sequence<I...>) {
+    std::tuple<Fields*...> fresh(static_cast<Fields*>(nullptr)...);
+    try {
+        ((std::get<I>(fresh) = allocateColumn<Fields>(newCap)), ...);
+    } catch (...) {
+        (deallocateColumn(std::get<I>(fresh)), ...);
+        throw;
+    }
+    constexpr bool allNothrowMove = (std::is_nothrow_move_constructible<Fields>::value && ...);
+    int rows = 0;   // 当前列已搬入的行数
+    auto buildColumn = [this, &rows](auto* from, auto* to) {
+        using T = typename std::remove_pointer<decltype(from)>::type;
+        for (rows = 0; rows < length; ++rows) {
+            if constexpr (allNothrowMove || !std::is_copy_constructible<T>::value)
+                ::new (static_cast<void*>(to + rows)) T(std::move(from[rows]));
+            else
+                ::new (static_cast<void*>(to + rows)) T(static_cast<const T&>(from[rows]));
+        }
+    };
+    auto destroyColumn = [](auto* column, int n) {
+        using T = typename std::remove_pointer<decltype(column)>::type;
+        for (int i = 0; i < n; ++i)
+            column[i].~T();
+    };
+    std::size_t built = 0;   // 已全部搬完的列数
+    try {
+        ((buildColumn(std::get<I>(columns), std::get<I>(fresh)), ++built), ...);
+    } catch (...) {
+        (destroyColumn(std::get<I>(fresh), I < built ? length : I == built ? rows : 0), ...);
+        (deallocateColumn(std::get<I>(fresh)), ...);
+        throw;
+    }
+    (destroyColumn(std::get<I>(columns), length), ...);
+    (deallocateColumn(std::get<I>(columns)), ...);
+    columns = fresh;
+    cap = newCap;
+}
+
+// 在第 index 行逐列构造元素；某列构造抛出异常时析构已构造的列
+template<typename... Fields>
+template<std::size_t... I>
+void SoaVector<Fields...>::constructRow(int index, std::index_sequence<I...>, const Fields&... values) {
+    std::size_t built = 0;
+    try {
+        ((::new (static_cast<void*>(std::get<I>(columns) + index)) Fields(values), ++built), ...);
+    } catch (...) {
+        ((I < built ? (std::get<I>(columns)[index].~Fields(), 0) : 0), ...);
+        throw;
+    }
+}
+
+// 析构第 index 行的所有字段
+template<typename... Fields>
+template<std::size_t... I>
+void SoaVector<Fields...>::destroyRow(int index, std::index_sequence<I...>) {
+    (std::get<I>(columns)[index].~Fields(), ...);
+}
+
+// 第 index 行之后的行在每一列中前移一位，最后一行随后由调用者析构
+template<typename... Fields>
+template<std::size_t... I>
+void SoaVector<Fields...>::shiftDown(int index, std::index_sequence<I...>) {
+    auto shiftColumn = [this, index](auto* column) {
+        for (int i = index; i < length - 1; ++i)
+            column[i] = std::move(column[i + 1]);
+    };
+    (shiftColumn(std::get<I>(columns)), ...);
+}
+
+// 释放所有列的内存（元素需已析构）
+template<typename... Fields>
+template<std::size_t... I>
+void SoaVector<Fields...>::releaseColumns(std::index_sequence<I...>) {
+    (deallocateColumn(std::get<I>(columns)), ...);
+    columns = std::tuple<Fields*...>(static_cast<Fields*>(nullptr)...);
+    cap = 0;
+}
+
+// 组装第 index 行的引用
+template<typename... Fields>
+template<std::size_t... I>
+typename SoaVector<Fields...>::Row SoaVector<Fields...>::rowAt(int index, std::index_sequence<I...>) {
+    return Row(std::get<I>(columns)[index]...);
+}
+
+// 组装第 index 行的只读引用
+template<typename... Fields>
+template<std::size_t... I>
+typename SoaVector<Fields...>::ConstRow SoaVector<Fields...>::rowAt(int index, std::index_sequence<I...>) const {
+    return ConstRow(std::get<I>(columns)[index]...);
+}
+
+// 构造空容器
+template<typename... Fields>
+SoaVector<Fields...>::SoaVector()
+    : columns(static_cast<Fields*>(nullptr)...), length(0), cap(0) {}
+
+// 拷贝构造：委托给默认构造，逐行追加时若抛出异常由析构函数回收
+template<typename... Fields>
+SoaVector<Fields...>::SoaVector(const SoaVector& other) : SoaVector() {
+    reserve(other.length);
+    for (int i = 0; i < other.length; ++i)
+        std::apply([this](const Fields&... values) { push_back(values...); }, other[i]);
+}
+
+// 移动构造：接管各列
+template<typename... Fields>
+SoaVector<Fields...>::SoaVector(SoaVector&& other) noexcept
+    : columns(other.columns), length(other.length), cap(other.cap) {
+    other.columns = std::tuple<Fields*...>(static_cast<Fields*>(nullptr)...);
+    other.length = 0;
+    other.cap = 0;
+}
+
+// 赋值：参数按值传入后交换
+template<typename... Fields>
+SoaVector<Fields...>& SoaVector<Fields...>::operator=(SoaVector other) noexcept {
+    swap(other);
+    return *this;
+}
+
+// 析构所有元素并释放各列
+template<typename... Fields>
+SoaVector<Fields...>::~SoaVector() {
+    clear();
+    releaseColumns(Indices());
+}
+
+// 预留容量
+template<typename... Fields>
+void SoaVector<Fields...>::reserve(int n) {
+    if (n > cap)
+        reallocate(n, Indices());
+}
+
+// 尾部追加一行
+template<typename... Fields>
+void SoaVector<Fields...>::push_back(const Fields&... values) {
+    if (length == cap) {
+        Value copy(values...);   // values 可能引用旧缓冲区中的元素
+        reallocate(cap == 0 ? INITIAL_CAPACITY : cap * 2, Indices());
+        std::apply([this](const Fields&... fields) { constructRow(length, Indices(), fields...); }, copy);
+    } else {
+        constructRow(length, Indices(), values...);
+    }
+    ++length;
+}
+
+// 以 tuple 形式追加一行
+template<typename... Fields>
+void SoaVector<Fields...>::push_back(const Value& row) {
+    std::apply([this](const Fields&... values) { push_back(values...); }, row);
+}
+
+// 删除尾部一行
+template<typename... Fields>
+void SoaVector<Fields...>::pop_back() {
+    if (length == 0)
+        throw std::out_of_range("SoaVector is empty");
+    --length;
+    destroyRow(length, Indices());
+}
+
+// 删除指定行
+template<typename... Fields>
+void SoaVector<Fields...>::erase(int index) {
+    if (index < 0 || index >= length)
+        throw std::out_of_range("Index out of range");
+    shiftDown(index, Indices());
+    --length;
+    destroyRow(length, Indices());
+}
+
+// 清空所有行
+template<typename... Fields>
+void SoaVector<Fields...>::clear() noexcept {
+    while (length > 0) {
+        --length;
+        destroyRow(length, Indices());
+    }
+}
+
+// 交换内容
+template<typename... Fields>
+void SoaVector<Fields...>::swap(SoaVector& other) noexcept {
+    std::swap(columns, other.columns);
+    std::swap(length, other.length);
+    std::swap(cap, other.cap);
+}
+
+// 带越界检查的行访问
+template<typename... Fields>
+typename SoaVector<Fields...>::Row SoaVector<Fields...>::at(int index) {
+    if (index < 0 || index >= length)
+        throw std::out_of_range("Index out of range");
+    return rowAt(index, Indices());
+}
+
+// 带越界检查的只读行访问
+template<typename... Fields>
+typename SoaVector<Fields...>::ConstRow SoaVector<Fields...>::at(int index) const {
+    if (index < 0 || index >= length)
+        throw std::out_of_range("Index out of range");
+    return rowAt(index, Indices());
+}
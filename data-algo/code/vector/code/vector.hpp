@@ -1,14 +1,26 @@
 #pragma once
+#include "../../common/include/dsCheck.hpp"
+#include "../../common/include/growthPolicy.hpp"
+#include "../../common/include/hugePageMemory.hpp"
+#include <algorithm>
+#include <new>
 #include <stdexcept>
+#include <utility>
 
+// 动态数组：只有前 size_ 个槽位构造了元素，容量不足时按扩容策略（默认 2 倍）扩容；
+// 不小于 DS_HUGE_PAGE_THRESHOLD 字节的缓冲区按 2 MB 对齐分配并请求透明大页
 template<typename T>
 class Vector {
 private:
     T* data_;
     int size_;
     int capacity_;
+    GrowthPolicy policy_;
 
+    static T* allocate(int n);
+    static void deallocate(T* p, int n);
     void reallocate(int new_cap);
+    void grow_for(int required);
 
 public:
     // 类型定义
@@ -34,6 +46,9 @@ public:
     bool empty() const noexcept;
     void reserve(int n);
     void resize(int n, const T& value = T());
+    void shrink_to_fit();
+    void set_growth_policy(const GrowthPolicy& policy);
+    const GrowthPolicy& growth_policy() const noexcept;
 
     // 元素访问
     T& operator[](int index);
@@ -47,6 +62,15 @@ public:
     T* data() noexcept;
     const T* data() const noexcept;
 
+    // 不抛异常的访问：下标越界时返回 false，out 不变
+    bool try_get(int index, T& out) const;
+    bool try_set(int index, const T& value);
+
+    // 不检查的访问：调用者保证 0 <= index < size()，与 DS_CHECK 的编译选项无关
+    T& unchecked_get(int index);
+    const T& unchecked_get(int index) const;
+    void unchecked_set(int index, const T& value);
+
     // 修改操作
     void push_back(const T& value);
     void push_back(T&& value);
@@ -66,4 +90,390 @@ public:
     const_iterator begin() const noexcept;
     iterator end() noexcept;
     const_iterator end() const noexcept;
-};
\ No newline at end of file
+};
+
+// ================== 实现部分 ==================
+
+// 分配能容纳n个元素的未构造缓冲区
+template<typename T>
+T* Vector<T>::allocate(int n) {
+    if (n <= 0) return nullptr;
+    return static_cast<T*>(HugePageMemory::allocate(static_cast<std::size_t>(n) * sizeof(T)));
+}
+
+// 释放缓冲区，n须与分配时相同
+template<typename T>
+void Vector<T>::deallocate(T* p, int n) {
+    if (p != nullptr) HugePageMemory::deallocate(p, static_cast<std::size_t>(n) * sizeof(T));
+}
+
+// 换到容量为new_cap的新缓冲区：移动（移动可能抛异常时复制）已有元素，失败时原缓冲区不变
+template<typename T>
+void Vector<T>::reallocate(int new_cap) {
+    T* new_data = allocate(new_cap);
+    int built = 0;
+    try {
+        for (; built < size_; ++built) {
+            ::new (static_cast<void*>(new_data + built)) T(std::move_if_noexcept(data_[built]));
+        }
+    } catch (...) {
+        for (int i = 0; i < built; ++i) new_data[i].~T();
+        deallocate(new_data, new_cap);
+        throw;
+    }
+    for (int i = 0; i < size_; ++i) data_[i].~T();
+    deallocate(data_, capacity_);
+    data_ = new_data;
+    capacity_ = new_cap;
+}
+
+// 保证至少容纳required个元素，按扩容策略计算新容量
+template<typename T>
+void Vector<T>::grow_for(int required) {
+    if (required <= capacity_) return;
+    int new_cap = policy_.next(capacity_, required);
+    DS_CHECK(new_cap >= required, std::overflow_error, "Vector is full");
+    reallocate(new_cap);
+}
+
+// 默认构造：空数组，不分配内存
+template<typename T>
+Vector<T>::Vector() : data_(nullptr), size_(0), capacity_(0), policy_(GrowthPolicy::geometric(2.0)) {}
+
+// 构造n个val的副本
+template<typename T>
+Vector<T>::Vector(int n, const T& val) : Vector() {
+    if (n < 0) throw std::length_error("Negative size");
+    reserve(n);
+    for (; size_ < n; ++size_) {
+        ::new (static_cast<void*>(data_ + size_)) T(val);
+    }
+}
+
+// 拷贝构造：容量恰好等于元素个数
+template<typename T>
+Vector<T>::Vector(const Vector& other) : Vector() {
+    policy_ = other.policy_;
+    reserve(other.size_);
+    for (; size_ < other.size_; ++size_) {
+        ::new (static_cast<void*>(data_ + size_)) T(other.data_[size_]);
+    }
+}
+
+// 移动构造：接管缓冲区
+template<typename T>
+Vector<T>::Vector(Vector&& other) noexcept
+    : data_(other.data_), size_(other.size_), capacity_(other.capacity_), policy_(other.policy_) {
+    other.data_ = nullptr;
+    other.size_ = 0;
+    other.capacity_ = 0;
+}
+
+// 析构：析构全部元素并释放缓冲区
+template<typename T>
+Vector<T>::~Vector() {
+    clear();
+    deallocate(data_, capacity_);
+}
+
+// 拷贝赋值：先拷贝再交换，失败时当前对象不变
+template<typename T>
+Vector<T>& Vector<T>::operator=(const Vector& other) {
+    if (this != &other) {
+        Vector tmp(other);
+        swap(tmp);
+    }
+    return *this;
+}
+
+// 移动赋值：释放当前缓冲区后接管对方的
+template<typename T>
+Vector<T>& Vector<T>::operator=(Vector&& other) noexcept {
+    if (this != &other) {
+        clear();
+        deallocate(data_, capacity_);
+        data_ = other.data_;
+        size_ = other.size_;
+        capacity_ = other.capacity_;
+        policy_ = other.policy_;
+        other.data_ = nullptr;
+        other.size_ = 0;
+        other.capacity_ = 0;
+    }
+    return *this;
+}
+
+// 元素个数
+template<typename T>
+int Vector<T>::size() const noexcept {
+    return size_;
+}
+
+// 容量
+template<typename T>
+int Vector<T>::capacity() const noexcept {
+    return capacity_;
+}
+
+// 是否为空
+template<typename T>
+bool Vector<T>::empty() const noexcept {
+    return size_ == 0;
+}
+
+// 预留容量：不足n时恰好扩到n
+template<typename T>
+void Vector<T>::reserve(int n) {
+    if (n > capacity_) reallocate(n);
+}
+
+// 调整元素个数：缩小时析构尾部，扩大时用value填充
+template<typename T>
+void Vector<T>::resize(int n, const T& value) {
+    if (n < 0) throw std::length_error("Negative size");
+    while (size_ > n) data_[--size_].~T();
+    if (n > size_) {
+        T copy = value;   // value 可能引用旧缓冲区中的元素
+        grow_for(n);
+        for (; size_ < n; ++size_) {
+            ::new (static_cast<void*>(data_ + size_)) T(copy);
+        }
+    }
+}
+
+// 收缩容量到元素个数，空数组释放全部内存
+template<typename T>
+void Vector<T>::shrink_to_fit() {
+    if (capacity_ > size_) reallocate(size_);
+}
+
+// 设置扩容策略
+template<typename T>
+void Vector<T>::set_growth_policy(const GrowthPolicy& policy) {
+    policy_ = policy;
+}
+
+// 当前扩容策略
+template<typename T>
+const GrowthPolicy& Vector<T>::growth_policy() const noexcept {
+    return policy_;
+}
+
+// 下标访问，不检查越界
+template<typename T>
+T& Vector<T>::operator[](int index) {
+    return data_[index];
+}
+
+// 下标访问（常量），不检查越界
+template<typename T>
+const T& Vector<T>::operator[](int index) const {
+    return data_[index];
+}
+
+// 带越界检查的访问
+template<typename T>
+T& Vector<T>::at(int index) {
+    DS_CHECK(index >= 0 && index < size_, std::out_of_range, "Index out of range");
+    return data_[index];
+}
+
+// 带越界检查的访问（常量）
+template<typename T>
+const T& Vector<T>::at(int index) const {
+    DS_CHECK(index >= 0 && index < size_, std::out_of_range, "Index out of range");
+    return data_[index];
+}
+
+// 不抛异常的读取
+template<typename T>
+bool Vector<T>::try_get(int index, T& out) const {
+    if (index < 0 || index >= size_) return false;
+    out = data_[index];
+    return true;
+}
+
+// 不抛异常的修改
+template<typename T>
+bool Vector<T>::try_set(int index, const T& value) {
+    if (index < 0 || index >= size_) return false;
+    data_[index] = value;
+    return true;
+}
+
+// 不检查边界的读取
+template<typename T>
+T& Vector<T>::unchecked_get(int index) {
+    return data_[index];
+}
+
+// 不检查边界的读取（常量）
+template<typename T>
+const T& Vector<T>::unchecked_get(int index) const {
+    return data_[index];
+}
+
+// 不检查边界的修改
+template<typename T>
+void Vector<T>::unchecked_set(int index, const T& value) {
+    data_[index] = value;
+}
+
+// 首元素
+template<typename T>
+T& Vector<T>::front() {
+    DS_CHECK(size_ > 0, std::out_of_range, "Vector is empty");
+    return data_[0];
+}
+
+// 首元素（常量）
+template<typename T>
+const T& Vector<T>::front() const {
+    DS_CHECK(size_ > 0, std::out_of_range, "Vector is empty");
+    return data_[0];
+}
+
+// 尾元素
+template<typename T>
+T& Vector<T>::back() {
+    DS_CHECK(size_ > 0, std::out_of_range, "Vector is empty");
+    return data_[size_ - 1];
+}
+
+// 尾元素（常量）
+template<typename T>
+const T& Vector<T>::back() const {
+    DS_CHECK(size_ > 0, std::out_of_range, "Vector is empty");
+    return data_[size_ - 1];
+}
+
+// 底层数据指针
+template<typename T>
+T* Vector<T>::data() noexcept {
+    return data_;
+}
+
+// 底层数据指针（常量）
+template<typename T>
+const T* Vector<T>::data() const noexcept {
+    return data_;
+}
+
+// 尾部插入（复制），均摊O(1)
+template<typename T>
+void Vector<T>::push_back(const T& value) {
+    if (size_ == capacity_) {
+        T copy = value;   // value 可能引用旧缓冲区中的元素
+        grow_for(size_ + 1);
+        ::new (static_cast<void*>(data_ + size_)) T(std::move(copy));
+    } else {
+        ::new (static_cast<void*>(data_ + size_)) T(value);
+    }
+    ++size_;
+}
+
+// 尾部插入（移动），均摊O(1)
+template<typename T>
+void Vector<T>::push_back(T&& value) {
+    if (size_ == capacity_) {
+        T tmp(std::move(value));
+        grow_for(size_ + 1);
+        ::new (static_cast<void*>(data_ + size_)) T(std::move(tmp));
+    } else {
+        ::new (static_cast<void*>(data_ + size_)) T(std::move(value));
+    }
+    ++size_;
+}
+
+// 删除尾部元素
+template<typename T>
+void Vector<T>::pop_back() {
+    DS_CHECK(size_ > 0, std::out_of_range, "Vector is empty");
+    data_[--size_].~T();
+}
+
+// 在指定位置插入（复制）
+template<typename T>
+typename Vector<T>::iterator Vector<T>::insert(int index, const T& value) {
+    return insert(index, T(value));
+}
+
+// 在指定位置插入（移动）：尾部新构造一个槽位，其余元素后移一位
+template<typename T>
+typename Vector<T>::iterator Vector<T>::insert(int index, T&& value) {
+    DS_CHECK(index >= 0 && index <= size_, std::out_of_range, "Index out of range");
+    if (index == size_) {
+        push_back(std::move(value));
+        return data_ + index;
+    }
+    T tmp(std::move(value));
+    grow_for(size_ + 1);
+    ::new (static_cast<void*>(data_ + size_)) T(std::move(data_[size_ - 1]));
+    ++size_;
+    std::move_backward(data_ + index, data_ + size_ - 2, data_ + size_ - 1);
+    data_[index] = std::move(tmp);
+    return data_ + index;
+}
+
+// 删除指定位置：其余元素前移一位，析构最后一个槽位
+template<typename T>
+typename Vector<T>::iterator Vector<T>::erase(int index) {
+    DS_CHECK(index >= 0 && index < size_, std::out_of_range, "Index out of range");
+    std::move(data_ + index + 1, data_ + size_, data_ + index);
+    data_[--size_].~T();
+    return data_ + index;
+}
+
+// 清空：析构全部元素，保留容量
+template<typename T>
+void Vector<T>::clear() noexcept {
+    while (size_ > 0) data_[--size_].~T();
+}
+
+// 交换内容与扩容策略
+template<typename T>
+void Vector<T>::swap(Vector& other) noexcept {
+    std::swap(data_, other.data_);
+    std::swap(size_, other.size_);
+    std::swap(capacity_, other.capacity_);
+    std::swap(policy_, other.policy_);
+}
+
+// 查找首次出现的位置，未找到返回-1
+template<typename T>
+int Vector<T>::find(const T& value) const {
+    for (int i = 0; i < size_; ++i) {
+        if (data_[i] == value) return i;
+    }
+    return -1;
+}
+
+// 依次访问每个元素
+template<typename T>
+void Vector<T>::traverse(void (*visit)(const T&)) const {
+    for (int i = 0; i < size_; ++i) visit(data_[i]);
+}
+
+// 首迭代器
+template<typename T>
+typename Vector<T>::iterator Vector<T>::begin() noexcept {
+    return data_;
+}
+
+// 首迭代器（常量）
+template<typename T>
+typename Vector<T>::const_iterator Vector<T>::begin() const noexcept {
+    return data_;
+}
+
+// 尾后迭代器
+template<typename T>
+typename Vector<T>::iterator Vector<T>::end() noexcept {
+    return data_ + size_;
+}
+
+// 尾后迭代器（常量）
+template<typename T>
+typename Vector<T>::const_iterator Vector<T>::end() const noexcept {
+    return data_ + size_;
+}
@@ -0,0 +1,195 @@
+#include "../code/bitVector.hpp"
+#include <chrono>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <string>
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+void printMenu() {
+    std::cout << "\n====== 位向量交互测试菜单 ======\n";
+    std::cout << "有两个位图 A 与 B，命令作用于当前位图（默认 A）\n";
+    std::cout << "命令列表：\n";
+    std::cout << "  use <A|B>                : 切换当前位图\n";
+    std::cout << "  resize <位数>            : 调整位数，新增位为0\n";
+    std::cout << "  push <0|1>               : 末尾追加一位\n";
+    std::cout << "  set/reset/flip <位置>    : 单个位置1/清零/翻转\n";
+    std::cout << "  setr/resetr/flipr <起> <止> : 区间 [起,止) 置1/清零/翻转\n";
+    std::cout << "  get <位置>               : 读取一位\n";
+    std::cout << "  and / or / xor           : A 与 B 按位运算，结果写入 A\n";
+    std::cout << "  count                    : 统计1的个数\n";
+    std::cout << "  rank <位置>              : [0,位置) 中1的个数\n";
+    std::cout << "  select <k>               : 第k个（从0计）1的位置\n";
+    std::cout << "  print                    : 打印当前位图（最多256位）\n";
+    std::cout << "  bench <位数>             : 与 std::vector<bool> 对比计数与 rank/select 耗时\n";
+    std::cout << "  help                     : 显示菜单\n";
+    std::cout << "  exit / 0                 : 退出程序\n";
+    std::cout << "-----------------------------------\n";
+    std::cout << "请输入命令: ";
+}
+
+void clearInput() {
+    std::cin.clear();
+    std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+}
+
+void printBits(const BitVector& bv) {
+    size_t shown = bv.size() < 256 ? bv.size() : 256;
+    for (size_t i = 0; i < shown; ++i) {
+        std::cout << (bv[i] ? '1' : '0');
+        if (i % 64 == 63) std::cout << "\n";
+        else if (i % 8 == 7) std::cout << ' ';
+    }
+    if (bv.size() > shown) std::cout << "...";
+    std::cout << "\n（共 " << bv.size() << " 位）\n";
+}
+
+// 计时工具：执行f并返回耗时（毫秒）
+template<typename F>
+double timeIt(F f) {
+    auto start = std::chrono::steady_clock::now();
+    f();
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+void bench(size_t n) {
+    std::mt19937_64 rng(2024);
+    BitVector bv(n);
+    std::vector<bool> ref(n);
+    for (size_t i = 0; i < n; ++i) {
+        if (rng() % 3 == 0) {
+            bv.set(i);
+            ref[i] = true;
+        }
+    }
+    size_t c1 = 0, c2 = 0;
+    double tRef = timeIt([&]() {
+        for (size_t i = 0; i < n; ++i) c1 += ref[i];
+    });
+    double tCount = timeIt([&]() { c2 = bv.count(); });
+    double tIndex = timeIt([&]() { bv.buildIndex(); });
+    const int queries = 1000000;
+    size_t checksum = 0;
+    bool ok = true;
+    double tRank = timeIt([&]() {
+        for (int q = 0; q < queries; ++q) checksum += bv.rank(rng() % (n + 1));
+    });
+    double tSelect = timeIt([&]() {
+        for (int q = 0; q < queries && c2 > 0; ++q) {
+            size_t k = rng() % c2;
+            size_t pos = bv.select(k);
+            if (q % 1024 == 0 && (!bv[pos] || bv.rank(pos) != k)) ok = false;
+        }
+    });
+    std::cout << "  1的个数: " << c2 << (c1 == c2 ? "（与 vector<bool> 一致）" : "（不一致！）") << "\n";
+    std::cout << "  内存: BitVector " << bv.bytes() / 1024 << " KB，每标志1字节时 " << n / 1024 << " KB\n";
+    std::cout << "  vector<bool> 逐位计数: " << tRef << " ms\n";
+    std::cout << "  BitVector::count    : " << tCount << " ms\n";
+    std::cout << "  构建 rank/select 索引: " << tIndex << " ms\n";
+    std::cout << "  rank   x" << queries << ": " << tRank << " ms（校验和 " << checksum << "）\n";
+    std::cout << "  select x" << queries << ": " << tSelect << " ms" << (ok ? "" : "（校验失败！）") << "\n";
+}
+
+int main() {
+#ifdef _WIN32
+    SetConsoleOutputCP(CP_UTF8);
+    SetConsoleCP(CP_UTF8);
+#endif
+    BitVector a(64), b(64);
+    BitVector* cur = &a;
+    std::string cmd;
+    printMenu();
+    while (true) {
+        std::cout << "> ";
+        if (!(std::cin >> cmd)) break;
+        try {
+            if (cmd == "use") {
+                std::string name;
+                std::cin >> name;
+                if (name == "A" || name == "a") cur = &a;
+                else if (name == "B" || name == "b") cur = &b;
+                else {
+                    std::cout << "输入有误。用法: use <A|B>\n";
+                    clearInput();
+                    continue;
+                }
+                std::cout << "当前位图: " << (cur == &a ? "A" : "B") << "\n";
+            } else if (cmd == "resize" || cmd == "push" || cmd == "set" || cmd == "reset" ||
+                       cmd == "flip" || cmd == "get" || cmd == "rank" || cmd == "select") {
+                size_t v;
+                if (!(std::cin >> v)) {
+                    std::cout << "输入有误。用法: " << cmd << " <数值>\n";
+                    clearInput();
+                    continue;
+                }
+                if (cmd == "resize") {
+                    cur->resize(v);
+                    std::cout << "位数调整为 " << cur->size() << "。\n";
+                } else if (cmd == "push") {
+                    cur->push_back(v != 0);
+                    std::cout << "已追加，位数 " << cur->size() << "。\n";
+                } else if (cmd == "set") {
+                    cur->set(v);
+                    std::cout << "已置1。\n";
+                } else if (cmd == "reset") {
+                    cur->reset(v);
+                    std::cout << "已清零。\n";
+                } else if (cmd == "flip") {
+                    cur->flip(v);
+                    std::cout << "已翻转。\n";
+                } else if (cmd == "get") {
+                    bool bit = cur->test(v);
+                    std::cout << "第 " << v << " 位: " << bit << "\n";
+                } else if (cmd == "rank") {
+                    size_t r = cur->rank(v);
+                    std::cout << "[0," << v << ") 中1的个数: " << r << "\n";
+                } else {
+                    size_t pos = cur->select(v);
+                    std::cout << "第 " << v << " 个1位于: " << pos << "\n";
+                }
+            } else if (cmd == "setr" || cmd == "resetr" || cmd == "flipr") {
+                size_t first, last;
+                if (!(std::cin >> first >> last)) {
+                    std::cout << "输入有误。用法: " << cmd << " <起> <止>\n";
+                    clearInput();
+                    continue;
+                }
+                if (cmd == "setr") cur->set(first, last);
+                else if (cmd == "resetr") cur->reset(first, last);
+                else cur->flip(first, last);
+                std::cout << "区间 [" << first << "," << last << ") 已处理。\n";
+            } else if (cmd == "and" || cmd == "or" || cmd == "xor") {
+                if (cmd == "and") a &= b;
+                else if (cmd == "or") a |= b;
+                else a ^= b;
+                std::cout << "A " << cmd << "= B 完成。\n";
+            } else if (cmd == "count") {
+                std::cout << "1的个数: " << cur->count() << "\n";
+            } else if (cmd == "print") {
+                printBits(*cur);
+            } else if (cmd == "bench") {
+                size_t n;
+                if (!(std::cin >> n) || n == 0) {
+                    std::cout << "输入有误。用法: bench <位数>\n";
+                    clearInput();
+                    continue;
+                }
+                bench(n);
+            } else if (cmd == "help") {
+                printMenu();
+            } else if (cmd == "exit" || cmd == "0") {
+                std::cout << "程序结束，再见！\n";
+                break;
+            } else {
+                std::cout << "未知命令。输入 help 查看菜单。\n";
+            }
+        } catch (const std::exception& e) {
+            std::cout << "错误: " << e.what() << "\n";
+        }
+        clearInput();
+    }
+    return 0;
+}
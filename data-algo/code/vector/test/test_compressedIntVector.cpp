@@ -0,0 +1,187 @@
+#include "../code/compressedIntVector.hpp"
+#include <chrono>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+void printMenu() {
+    std::cout << "\n====== 压缩整数序列交互测试菜单 ======\n";
+    std::cout << "命令列表：\n";
+    std::cout << "  push <值>                : 末尾追加一个值\n";
+    std::cout << "  sorted <个数> <最大间隔>  : 追加随机间隔的有序ID\n";
+    std::cout << "  random <个数> <上界>      : 追加 [0,上界) 内的随机值\n";
+    std::cout << "  get <下标>               : 随机访问\n";
+    std::cout << "  block <块号>             : 解码并打印一整块\n";
+    std::cout << "  print                    : 顺序打印（最多前200个）\n";
+    std::cout << "  stats                    : 个数、占用内存、压缩比与编码分布\n";
+    std::cout << "  clear                    : 清空\n";
+    std::cout << "  bench <个数> <最大间隔>   : 与 std::vector<uint64_t> 对比内存与遍历耗时\n";
+    std::cout << "  help                     : 显示菜单\n";
+    std::cout << "  exit / 0                 : 退出程序\n";
+    std::cout << "-----------------------------------\n";
+    std::cout << "请输入命令: ";
+}
+
+void clearInput() {
+    std::cin.clear();
+    std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+}
+
+void printStats(const CompressedIntVector& cv) {
+    size_t forBlocks, deltaBlocks;
+    cv.encodingStats(forBlocks, deltaBlocks);
+    size_t raw = cv.size() * sizeof(uint64_t);
+    std::cout << "个数: " << cv.size() << "，块数: " << cv.blockCount()
+              << "（FOR " << forBlocks << "，DELTA " << deltaBlocks << "）\n";
+    std::cout << "占用: " << cv.bytes() << " 字节，原始: " << raw << " 字节";
+    if (cv.bytes() > 0)
+        std::cout << "，压缩比 " << static_cast<double>(raw) / cv.bytes();
+    std::cout << "\n";
+}
+
+// 计时工具：执行f并返回耗时（毫秒）
+template<typename F>
+double timeIt(F f) {
+    auto start = std::chrono::steady_clock::now();
+    f();
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+void bench(size_t n, uint64_t maxGap) {
+    std::mt19937_64 rng(7);
+    std::vector<uint64_t> raw(n);
+    uint64_t id = 1000000;
+    for (size_t i = 0; i < n; ++i) {
+        id += rng() % maxGap + 1;
+        raw[i] = id;
+    }
+    CompressedIntVector cv;
+    double tBuild = timeIt([&]() {
+        for (size_t i = 0; i < n; ++i) cv.push_back(raw[i]);
+    });
+    uint64_t s1 = 0, s2 = 0, s3 = 0, s4 = 0;
+    double tRaw = timeIt([&]() {
+        for (size_t i = 0; i < n; ++i) s1 += raw[i];
+    });
+    double tEach = timeIt([&]() {
+        cv.forEach([&](uint64_t v) { s2 += v; });
+    });
+    std::vector<size_t> probes(1000000);
+    for (size_t i = 0; i < probes.size(); ++i) probes[i] = rng() % n;
+    double tRawGet = timeIt([&]() {
+        for (size_t i = 0; i < probes.size(); ++i) s3 += raw[probes[i]];
+    });
+    double tGet = timeIt([&]() {
+        for (size_t i = 0; i < probes.size(); ++i) s4 += cv.get(probes[i]);
+    });
+    printStats(cv);
+    std::cout << "  构建: " << tBuild << " ms\n";
+    std::cout << "  顺序遍历  vector: " << tRaw << " ms，压缩序列: " << tEach << " ms"
+              << (s1 == s2 ? "" : "（结果不一致！）") << "\n";
+    std::cout << "  随机访问x" << probes.size() << " vector: " << tRawGet << " ms，压缩序列: " << tGet
+              << " ms" << (s3 == s4 ? "" : "（结果不一致！）") << "\n";
+}
+
+int main() {
+#ifdef _WIN32
+    SetConsoleOutputCP(CP_UTF8);
+    SetConsoleCP(CP_UTF8);
+#endif
+    CompressedIntVector cv;
+    std::mt19937_64 rng(12345);
+    uint64_t lastId = 0;
+    std::string cmd;
+    printMenu();
+    while (true) {
+        std::cout << "> ";
+        if (!(std::cin >> cmd)) break;
+        try {
+            if (cmd == "push") {
+                uint64_t v;
+                if (!(std::cin >> v)) {
+                    std::cout << "输入有误。用法: push <值>\n";
+                    clearInput();
+                    continue;
+                }
+                cv.push_back(v);
+                lastId = v;
+                std::cout << "已追加，共 " << cv.size() << " 个。\n";
+            } else if (cmd == "sorted" || cmd == "random") {
+                size_t n;
+                uint64_t bound;
+                if (!(std::cin >> n >> bound) || bound == 0) {
+                    std::cout << "输入有误。用法: " << cmd << " <个数> <" << (cmd == "sorted" ? "最大间隔" : "上界") << ">\n";
+                    clearInput();
+                    continue;
+                }
+                for (size_t i = 0; i < n; ++i) {
+                    if (cmd == "sorted") {
+                        lastId += rng() % bound + 1;
+                        cv.push_back(lastId);
+                    } else {
+                        cv.push_back(rng() % bound);
+                    }
+                }
+                std::cout << "已追加 " << n << " 个，共 " << cv.size() << " 个。\n";
+            } else if (cmd == "get") {
+                size_t idx;
+                if (!(std::cin >> idx)) {
+                    std::cout << "输入有误。用法: get <下标>\n";
+                    clearInput();
+                    continue;
+                }
+                uint64_t v = cv.get(idx);
+                std::cout << "下标 " << idx << " 的值为: " << v << "\n";
+            } else if (cmd == "block") {
+                size_t b;
+                if (!(std::cin >> b)) {
+                    std::cout << "输入有误。用法: block <块号>\n";
+                    clearInput();
+                    continue;
+                }
+                uint64_t buffer[CompressedIntVector::BLOCK_SIZE];
+                int n = cv.decodeBlock(b, buffer);
+                std::cout << "第 " << b << " 块（" << n << " 个）: ";
+                for (int j = 0; j < n; ++j) std::cout << buffer[j] << " ";
+                std::cout << "\n";
+            } else if (cmd == "print") {
+                int shown = 0;
+                for (CompressedIntVector::const_iterator it = cv.begin(); it != cv.end() && shown < 200; ++it, ++shown)
+                    std::cout << *it << " ";
+                std::cout << (cv.size() > 200 ? "...\n" : "\n");
+            } else if (cmd == "stats") {
+                printStats(cv);
+            } else if (cmd == "clear") {
+                cv.clear();
+                lastId = 0;
+                std::cout << "已清空。\n";
+            } else if (cmd == "bench") {
+                size_t n;
+                uint64_t gap;
+                if (!(std::cin >> n >> gap) || n == 0 || gap == 0) {
+                    std::cout << "输入有误。用法: bench <个数> <最大间隔>\n";
+                    clearInput();
+                    continue;
+                }
+                bench(n, gap);
+            } else if (cmd == "help") {
+                printMenu();
+            } else if (cmd == "exit" || cmd == "0") {
+                std::cout << "程序结束，再见！\n";
+                break;
+            } else {
+                std::cout << "未知命令。输入 help 查看菜单。\n";
+            }
+        } catch (const std::exception& e) {
+            std::cout << "错误: " << e.what() << "\n";
+        }
+        clearInput();
+    }
+    return 0;
+}
@@ -0,0 +1,216 @@
+#include "../code/concurrentVector.hpp"
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <limits>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+void printMenu() {
+    std::cout << "\n====== 并发分段数组交互测试菜单 ======\n";
+    std::cout << "命令列表：\n";
+    std::cout << "  push <值>                   : 末尾追加一个值\n";
+    std::cout << "  grow <个数> <值>            : 一次追加若干个相同的值\n";
+    std::cout << "  get <下标>                  : 带检查的下标访问\n";
+    std::cout << "  print                       : 打印全部元素（最多前200个）\n";
+    std::cout << "  size                        : 元素个数、预留槽位数与容量\n";
+    std::cout << "  stable                      : 记录首元素地址，追加大量元素后检查地址不变\n";
+    std::cout << "  clear                       : 清空（保留已分配的段）\n";
+    std::cout << "  concurrent <线程数> <每线程个数> : 多线程并发追加并同时读取，检查结果\n";
+    std::cout << "  bench <线程数> <每线程个数>  : 与 加锁的 std::vector 对比并发追加耗时\n";
+    std::cout << "  help                        : 显示菜单\n";
+    std::cout << "  exit / 0                    : 退出程序\n";
+    std::cout << "-----------------------------------\n";
+    std::cout << "请输入命令: ";
+}
+
+void clearInput() {
+    std::cin.clear();
+    std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+}
+
+// 计时工具：执行f并返回耗时（毫秒）
+template<typename F>
+double timeIt(F f) {
+    auto start = std::chrono::steady_clock::now();
+    f();
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+// 每个线程追加 (线程号 << 32) | 序号，并有一个读线程持续检查已提交前缀
+void concurrentTest(int threads, int perThread) {
+    ConcurrentVector<long long> cv;
+    std::atomic<bool> done(false);
+    std::atomic<bool> ok(true);
+    long long reads = 0;
+    std::thread reader([&]() {
+        size_t last = 0;
+        while (!done.load()) {
+            size_t n = cv.size();
+            if (n < last) ok = false;   // 已提交前缀只增不减
+            last = n;
+            if (n > 0 && (cv[n - 1] & 0xFFFFFFFFLL) >= perThread) ok = false;
+            ++reads;
+        }
+    });
+    std::vector<std::thread> writers;
+    double t = timeIt([&]() {
+        for (int w = 0; w < threads; ++w) {
+            writers.push_back(std::thread([&, w]() {
+                for (int i = 0; i < perThread; ++i) {
+                    long long value = (static_cast<long long>(w) << 32) | i;
+                    size_t index = cv.push_back(value);
+                    if (cv[index] != value) ok = false;
+                }
+            }));
+        }
+        for (size_t i = 0; i < writers.size(); ++i) writers[i].join();
+    });
+    done = true;
+    reader.join();
+    // 每个线程的元素应全部出现，且同一线程内的顺序保持不变
+    std::vector<long long> next(threads, 0);
+    cv.forEach([&](const long long& v) {
+        int w = static_cast<int>(v >> 32);
+        if (w < 0 || w >= threads || (v & 0xFFFFFFFFLL) != next[w]) ok = false;
+        else ++next[w];
+    });
+    for (int w = 0; w < threads; ++w) {
+        if (next[w] != perThread) ok = false;
+    }
+    std::cout << "  " << threads << " 个线程各追加 " << perThread << " 个，耗时 " << t << " ms，"
+              << "最终 " << cv.size() << " 个，读线程检查 " << reads << " 次，结果" << (ok.load() ? "正确" : "错误！") << "\n";
+}
+
+void bench(int threads, int perThread) {
+    ConcurrentVector<long long> cv;
+    double tConcurrent = timeIt([&]() {
+        std::vector<std::thread> pool;
+        for (int w = 0; w < threads; ++w) {
+            pool.push_back(std::thread([&, w]() {
+                for (int i = 0; i < perThread; ++i) cv.push_back(w + i);
+            }));
+        }
+        for (size_t i = 0; i < pool.size(); ++i) pool[i].join();
+    });
+    std::vector<long long> vec;
+    std::mutex mtx;
+    double tLocked = timeIt([&]() {
+        std::vector<std::thread> pool;
+        for (int w = 0; w < threads; ++w) {
+            pool.push_back(std::thread([&, w]() {
+                for (int i = 0; i < perThread; ++i) {
+                    std::lock_guard<std::mutex> lock(mtx);
+                    vec.push_back(w + i);
+                }
+            }));
+        }
+        for (size_t i = 0; i < pool.size(); ++i) pool[i].join();
+    });
+    std::vector<long long> single;
+    double tSingle = timeIt([&]() {
+        for (int w = 0; w < threads; ++w) {
+            for (int i = 0; i < perThread; ++i) single.push_back(w + i);
+        }
+    });
+    long long s1 = 0, s2 = 0;
+    double tRead = timeIt([&]() {
+        for (size_t i = 0; i < cv.size(); ++i) s1 += cv[i];
+    });
+    double tReadVec = timeIt([&]() {
+        for (size_t i = 0; i < vec.size(); ++i) s2 += vec[i];
+    });
+    std::cout << "  并发追加 " << threads << "x" << perThread << ": ConcurrentVector " << tConcurrent
+              << " ms，mutex+std::vector " << tLocked << " ms（单线程 std::vector " << tSingle << " ms）\n";
+    std::cout << "  顺序下标读取: ConcurrentVector " << tRead << " ms，std::vector " << tReadVec << " ms"
+              << (s1 == s2 ? "" : "（结果不一致！）") << "\n";
+}
+
+int main() {
+#ifdef _WIN32
+    SetConsoleOutputCP(CP_UTF8);
+    SetConsoleCP(CP_UTF8);
+#endif
+    ConcurrentVector<int> cv;
+    std::string cmd;
+    printMenu();
+    while (true) {
+        std::cout << "> ";
+        if (!(std::cin >> cmd)) break;
+        try {
+            if (cmd == "push") {
+                int v;
+                if (!(std::cin >> v)) {
+                    std::cout << "输入有误。用法: push <值>\n";
+                    clearInput();
+                    continue;
+                }
+                size_t index = cv.push_back(v);
+                std::cout << "已追加到下标 " << index << "。\n";
+            } else if (cmd == "grow") {
+                int n, v;
+                if (!(std::cin >> n >> v) || n < 0) {
+                    std::cout << "输入有误。用法: grow <个数> <值>\n";
+                    clearInput();
+                    continue;
+                }
+                size_t first = cv.grow_by(n, v);
+                std::cout << "已追加到下标 [" << first << ", " << first + n << ")。\n";
+            } else if (cmd == "get") {
+                size_t index;
+                if (!(std::cin >> index)) {
+                    std::cout << "输入有误。用法: get <下标>\n";
+                    clearInput();
+                    continue;
+                }
+                int v = cv.at(index);
+                std::cout << "下标 " << index << " 的值为: " << v << "\n";
+            } else if (cmd == "print") {
+                int shown = 0;
+                cv.forEach([&](const int& v) {
+                    if (shown++ < 200) std::cout << v << " ";
+                });
+                std::cout << (cv.size() > 200 ? "...\n" : "\n");
+            } else if (cmd == "size") {
+                std::cout << "元素个数: " << cv.size() << "，预留槽位: " << cv.reservedSize()
+                          << "，容量: " << cv.capacity() << "\n";
+            } else if (cmd == "stable") {
+                if (cv.empty()) cv.push_back(0);
+                const int* first = &cv[0];
+                size_t before = cv.capacity();
+                cv.grow_by(100000, 1);
+                std::cout << "容量 " << before << " -> " << cv.capacity() << "，首元素地址"
+                          << (first == &cv[0] ? "未变化" : "发生变化！") << "\n";
+            } else if (cmd == "clear") {
+                cv.clear();
+                std::cout << "已清空。\n";
+            } else if (cmd == "concurrent" || cmd == "bench") {
+                int threads, perThread;
+                if (!(std::cin >> threads >> perThread) || threads <= 0 || perThread < 0) {
+                    std::cout << "输入有误。用法: " << cmd << " <线程数> <每线程个数>\n";
+                    clearInput();
+                    continue;
+                }
+                if (cmd == "concurrent") concurrentTest(threads, perThread);
+                else bench(threads, perThread);
+            } else if (cmd == "help") {
+                printMenu();
+            } else if (cmd == "exit" || cmd == "0") {
+                std::cout << "程序结束，再见！\n";
+                break;
+            } else {
+                std::cout << "未知命令。输入 help 查看菜单。\n";
+            }
+        } catch (const std::exception& e) {
+            std::cout << "错误: " << e.what() << "\n";
+        }
+        clearInput();
+    }
+    return 0;
+}
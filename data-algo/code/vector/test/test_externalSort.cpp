@@ -0,0 +1,255 @@
+#include "../code/externalSort.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+typedef unsigned long long Key;
+
+void printMenu() {
+    std::cout << "\n====== 外部归并排序交互测试菜单 ======\n";
+    std::cout << "命令列表：\n";
+    std::cout << "  config                     : 查看内存预算、块大小、临时目录与由此得到的段长、归并路数\n";
+    std::cout << "  budget <MB>                : 设置内存预算\n";
+    std::cout << "  block <KB>                 : 设置每次读写的块大小\n";
+    std::cout << "  tmpdir <目录>              : 设置临时文件目录\n";
+    std::cout << "  gen <文件> <个数>          : 生成随机 64 位整数文件\n";
+    std::cout << "  sortfile <输入> <输出>     : 外部排序文件并报告吞吐量\n";
+    std::cout << "  verify <文件>              : 映射文件并检查是否有序\n";
+    std::cout << "  show <文件> <起始> <个数>  : 映射文件并打印一段元素\n";
+    std::cout << "  stress <轮数>              : 小预算下随机规模排序，与 std::sort 对照\n";
+    std::cout << "  bench <MB>                 : 生成随机数据并外部排序，与内存中 std::sort 对比\n";
+    std::cout << "  help                       : 显示菜单\n";
+    std::cout << "  exit / 0                   : 退出程序\n";
+    std::cout << "-----------------------------------\n";
+    std::cout << "请输入命令: ";
+}
+
+void clearInput() {
+    std::cin.clear();
+    std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+}
+
+// 计时工具：执行f并返回耗时（毫秒）
+template<typename F>
+double timeIt(F f) {
+    auto start = std::chrono::steady_clock::now();
+    f();
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+struct Config {
+    size_t budget;
+    size_t block;
+    std::string tmpdir;
+};
+
+void printStats(const ExternalSorter<Key>::Stats& s) {
+    std::cout << "  元素 " << s.elements << " 个（" << s.inputBytes / 1e6 << " MB），有序段 " << s.runs << " 个，多路归并 "
+              << s.merges << " 次\n";
+    std::cout << "  生成阶段 " << s.runMillis << " ms，归并阶段 " << s.mergeMillis << " ms，吞吐量 "
+              << s.throughputMBps() << " MB/s\n";
+    std::cout << "  写入 " << s.bytesWritten / 1e6 << " MB，读回 " << s.bytesRead / 1e6 << " MB\n";
+}
+
+void generate(const std::string& path, unsigned long long n, unsigned seed) {
+    std::FILE* file = std::fopen(path.c_str(), "wb");
+    if (file == nullptr) throw std::runtime_error("无法创建文件 " + path);
+    std::mt19937_64 rng(seed);
+    std::vector<Key> block(1 << 16);
+    while (n > 0) {
+        size_t k = n < block.size() ? static_cast<size_t>(n) : block.size();
+        for (size_t i = 0; i < k; ++i) block[i] = rng();
+        if (std::fwrite(block.data(), sizeof(Key), k, file) != k) {
+            std::fclose(file);
+            throw std::runtime_error("写入失败 " + path);
+        }
+        n -= k;
+    }
+    std::fclose(file);
+}
+
+// 检查是否有序，同时返回元素之和（用于比较内容）
+bool verify(const std::string& path, unsigned long long& count, Key& sum) {
+    MappedVector<Key> data(path);
+    count = data.size();
+    sum = 0;
+    for (size_t i = 0; i < data.size(); ++i) {
+        if (i > 0 && data[i] < data[i - 1]) return false;
+        sum += data[i];
+    }
+    return true;
+}
+
+// 小预算（64 KB，4 KB 块，7 路）下随机规模排序，交替使用文件输出与 sink 输出
+void stress(const Config& cfg, int rounds) {
+    std::mt19937 rng(5);
+    std::string out = cfg.tmpdir + "/stress_out.bin";
+    for (int r = 0; r < rounds; ++r) {
+        int n = static_cast<int>(rng() % 60000);
+        int mod = r % 3 == 0 ? 100 : 1000000;
+        std::vector<Key> data(n);
+        for (int i = 0; i < n; ++i) data[i] = rng() % mod;
+        ExternalSorter<Key> sorter(64 << 10, cfg.tmpdir, 4 << 10);
+        if (r % 2 == 0) {
+            for (int i = 0; i < n; ++i) sorter.push(data[i]);
+        } else if (n > 0) {
+            sorter.push_n(&data[0], n);
+        }
+        std::vector<Key> got;
+        ExternalSorter<Key>::Stats s;
+        if (r % 2 == 0) {
+            s = sorter.finish(out);
+            MappedVector<Key> mapped(out);
+            got.assign(mapped.begin(), mapped.end());
+        } else {
+            s = sorter.finishWith([&](const Key* block, int count) { got.insert(got.end(), block, block + count); });
+        }
+        std::sort(data.begin(), data.end());
+        if (got != data) {
+            std::cout << "  第 " << r << " 轮（" << n << " 个元素，" << s.runs << " 段，" << s.merges
+                      << " 次）结果与 std::sort 不一致！\n";
+            std::remove(out.c_str());
+            return;
+        }
+    }
+    std::remove(out.c_str());
+    std::cout << "  " << rounds << " 轮全部与 std::sort 一致\n";
+}
+
+void bench(const Config& cfg, int mb) {
+    std::string in = cfg.tmpdir + "/bench_in.bin";
+    std::string out = cfg.tmpdir + "/bench_out.bin";
+    unsigned long long n = static_cast<unsigned long long>(mb) * 1000000 / sizeof(Key);
+    double tGen = timeIt([&]() { generate(in, n, 11); });
+    std::cout << "  生成 " << mb << " MB 随机数据 " << tGen << " ms\n";
+
+    ExternalSorter<Key> sorter(cfg.budget, cfg.tmpdir, cfg.block);
+    ExternalSorter<Key>::Stats s = sorter.sortFile(in, out);
+    std::cout << "  外部排序（预算 " << cfg.budget / 1e6 << " MB，段长 " << sorter.runSize() << "，" << sorter.mergeFanIn()
+              << " 路）:\n";
+    printStats(s);
+    unsigned long long count = 0;
+    Key sum = 0;
+    bool sorted = false;
+    double tVerify = timeIt([&]() { sorted = verify(out, count, sum); });
+    std::cout << "  映射检查 " << tVerify << " ms：" << (sorted && count == n ? "有序，个数正确" : "结果错误！") << "\n";
+
+    // 对照：整个读入内存后 std::sort，再写出
+    if (mb <= 1024) {
+        std::vector<Key> all;
+        double tSort = timeIt([&]() {
+            MappedVector<Key> input(in);
+            all.assign(input.begin(), input.end());
+            std::sort(all.begin(), all.end());
+            std::FILE* file = std::fopen(out.c_str(), "wb");
+            if (file == nullptr) throw std::runtime_error("无法创建文件 " + out);
+            std::fwrite(all.data(), sizeof(Key), all.size(), file);
+            std::fclose(file);
+        });
+        std::cout << "  内存中 std::sort（读入、排序、写出）: " << tSort << " ms，"
+                  << (tSort > 0 ? mb / (tSort / 1000.0) : 0) << " MB/s\n";
+    }
+    std::remove(in.c_str());
+    std::remove(out.c_str());
+}
+
+int main() {
+#ifdef _WIN32
+    SetConsoleOutputCP(CP_UTF8);
+    SetConsoleCP(CP_UTF8);
+#endif
+    Config cfg;
+    cfg.budget = size_t(64) << 20;
+    cfg.block = size_t(1) << 20;
+    cfg.tmpdir = ".";
+    std::string cmd;
+    printMenu();
+    while (true) {
+        std::cout << "> ";
+        if (!(std::cin >> cmd)) break;
+        try {
+            if (cmd == "budget" || cmd == "block" || cmd == "stress" || cmd == "bench") {
+                long long v;
+                if (!(std::cin >> v) || v <= 0) {
+                    std::cout << "输入有误。用法: " << cmd << " <正整数>\n";
+                    clearInput();
+                    continue;
+                }
+                if (cmd == "budget") {
+                    ExternalSorter<Key> probe(static_cast<size_t>(v) << 20, cfg.tmpdir, cfg.block);
+                    cfg.budget = static_cast<size_t>(v) << 20;
+                    std::cout << "内存预算: " << v << " MB，段长 " << probe.runSize() << "，" << probe.mergeFanIn()
+                              << " 路归并\n";
+                } else if (cmd == "block") {
+                    ExternalSorter<Key> probe(cfg.budget, cfg.tmpdir, static_cast<size_t>(v) << 10);
+                    cfg.block = static_cast<size_t>(v) << 10;
+                    std::cout << "块大小: " << v << " KB，" << probe.mergeFanIn() << " 路归并\n";
+                } else if (cmd == "stress") {
+                    stress(cfg, static_cast<int>(v));
+                } else {
+                    bench(cfg, static_cast<int>(v));
+                }
+            } else if (cmd == "config") {
+                ExternalSorter<Key> probe(cfg.budget, cfg.tmpdir, cfg.block);
+                std::cout << "内存预算 " << cfg.budget / (1 << 20) << " MB，块 " << cfg.block / 1024 << " KB，临时目录 "
+                          << cfg.tmpdir << "，段长 " << probe.runSize() << "，" << probe.mergeFanIn() << " 路归并\n";
+            } else if (cmd == "tmpdir") {
+                std::cin >> cfg.tmpdir;
+                std::cout << "临时目录: " << cfg.tmpdir << "\n";
+            } else if (cmd == "gen") {
+                std::string path;
+                unsigned long long n;
+                if (!(std::cin >> path >> n)) {
+                    std::cout << "输入有误。用法: gen <文件> <个数>\n";
+                    clearInput();
+                    continue;
+                }
+                generate(path, n, 1);
+                std::cout << "已生成 " << n << " 个元素。\n";
+            } else if (cmd == "sortfile") {
+                std::string in, out;
+                std::cin >> in >> out;
+                ExternalSorter<Key> sorter(cfg.budget, cfg.tmpdir, cfg.block);
+                printStats(sorter.sortFile(in, out));
+            } else if (cmd == "verify") {
+                std::string path;
+                std::cin >> path;
+                unsigned long long count = 0;
+                Key sum = 0;
+                bool sorted = verify(path, count, sum);
+                std::cout << count << " 个元素，" << (sorted ? "有序" : "无序") << "\n";
+            } else if (cmd == "show") {
+                std::string path;
+                size_t start, count;
+                if (!(std::cin >> path >> start >> count)) {
+                    std::cout << "输入有误。用法: show <文件> <起始> <个数>\n";
+                    clearInput();
+                    continue;
+                }
+                MappedVector<Key> data(path);
+                for (size_t i = start; i < start + count && i < data.size(); ++i) std::cout << data.at(i) << " ";
+                std::cout << "\n共 " << data.size() << " 个元素\n";
+            } else if (cmd == "help") {
+                printMenu();
+            } else if (cmd == "exit" || cmd == "0") {
+                std::cout << "程序结束，再见！\n";
+                break;
+            } else {
+                std::cout << "未知命令。输入 help 查看菜单。\n";
+            }
+        } catch (const std::exception& e) {
+            std::cout << "错误: " << e.what() << "\n";
+        }
+        clearInput();
+    }
+    return 0;
+}
@@ -0,0 +1,183 @@
+#include "../code/soaVector.hpp"
+#include <array>
+#include <chrono>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <vector>
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+void printMenu() {
+    std::cout << "\n====== 列式动态数组交互测试菜单 ======\n";
+    std::cout << "记录字段：编号(int)、价格(double)、名称(string)\n";
+    std::cout << "命令列表：\n";
+    std::cout << "  push <编号> <价格> <名称> : 尾部追加一行\n";
+    std::cout << "  pop                       : 删除尾部一行\n";
+    std::cout << "  erase <下标>              : 删除指定行\n";
+    std::cout << "  get <下标>                : 查看指定行\n";
+    std::cout << "  price <下标> <价格>       : 通过行引用修改价格\n";
+    std::cout << "  sum                       : 扫描价格列求和\n";
+    std::cout << "  size                      : 行数与容量\n";
+    std::cout << "  clear                     : 清空\n";
+    std::cout << "  save / load               : 保存副本 / 恢复副本（拷贝赋值）\n";
+    std::cout << "  print                     : 按行打印\n";
+    std::cout << "  bench <行数>              : 与结构体数组对比单列扫描耗时\n";
+    std::cout << "  help                      : 显示菜单\n";
+    std::cout << "  exit / 0                  : 退出程序\n";
+    std::cout << "-----------------------------------\n";
+    std::cout << "请输入命令: ";
+}
+
+void clearInput() {
+    std::cin.clear();
+    std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+}
+
+typedef SoaVector<int, double, std::string> Table;
+
+void printRow(const Table& table, int i) {
+    auto [id, price, name] = table[i];
+    std::cout << "  [" << i << "] 编号=" << id << " 价格=" << price << " 名称=" << name << "\n";
+}
+
+// 宽记录：一次只扫描 price 时，结构体数组每条缓存行只用到 8 字节
+struct WideRecord {
+    int id;
+    double price;
+    std::array<char, 48> payload;
+};
+
+// 计时工具：执行f并返回耗时（毫秒）
+template<typename F>
+double timeIt(F f) {
+    auto start = std::chrono::steady_clock::now();
+    f();
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+void bench(int n) {
+    std::vector<WideRecord> aos;
+    SoaVector<int, double, std::array<char, 48>> soa;
+    std::array<char, 48> payload = {};
+    aos.reserve(n);
+    soa.reserve(n);
+    for (int i = 0; i < n; ++i) {
+        WideRecord r = {i, i * 0.5, payload};
+        aos.push_back(r);
+        soa.push_back(i, i * 0.5, payload);
+    }
+    const int rounds = 10;
+    double sumAos = 0, sumSoa = 0;
+    double tAos = timeIt([&]() {
+        for (int r = 0; r < rounds; ++r)
+            for (int i = 0; i < n; ++i) sumAos += aos[i].price;
+    });
+    const auto& view = soa;
+    double tSoa = timeIt([&]() {
+        for (int r = 0; r < rounds; ++r) {
+            ColumnSpan<const double> prices = view.column<1>();
+            for (int i = 0; i < prices.size(); ++i) sumSoa += prices[i];
+        }
+    });
+    std::cout << "  结构体数组 : " << tAos << " ms\n";
+    std::cout << "  SoaVector  : " << tSoa << " ms" << (sumAos == sumSoa ? "" : "（结果不一致！）") << "\n";
+}
+
+int main() {
+#ifdef _WIN32
+    SetConsoleOutputCP(CP_UTF8);
+    SetConsoleCP(CP_UTF8);
+#endif
+    Table table, saved;
+    std::string cmd;
+    printMenu();
+    while (true) {
+        std::cout << "> ";
+        if (!(std::cin >> cmd)) break;
+        try {
+            if (cmd == "push") {
+                int id;
+                double price;
+                std::string name;
+                if (!(std::cin >> id >> price >> name)) {
+                    std::cout << "输入有误。用法: push <编号> <价格> <名称>\n";
+                    clearInput();
+                    continue;
+                }
+                table.push_back(id, price, name);
+                std::cout << "已追加第 " << table.size() - 1 << " 行。\n";
+            } else if (cmd == "pop") {
+                table.pop_back();
+                std::cout << "已删除尾部一行。\n";
+            } else if (cmd == "erase" || cmd == "get") {
+                int idx;
+                if (!(std::cin >> idx)) {
+                    std::cout << "输入有误。用法: " << cmd << " <下标>\n";
+                    clearInput();
+                    continue;
+                }
+                if (cmd == "erase") {
+                    table.erase(idx);
+                    std::cout << "已删除第 " << idx << " 行。\n";
+                } else {
+                    table.at(idx);
+                    printRow(table, idx);
+                }
+            } else if (cmd == "price") {
+                int idx;
+                double price;
+                if (!(std::cin >> idx >> price)) {
+                    std::cout << "输入有误。用法: price <下标> <价格>\n";
+                    clearInput();
+                    continue;
+                }
+                std::get<1>(table.at(idx)) = price;
+                std::cout << "已修改。\n";
+            } else if (cmd == "sum") {
+                double sum = 0;
+                for (double p : table.column<1>()) sum += p;
+                std::cout << "价格列合计: " << sum << "（列首地址按 "
+                          << Table::COLUMN_ALIGNMENT << " 字节对齐: "
+                          << (reinterpret_cast<std::size_t>(table.column<1>().data()) %
+                                      Table::COLUMN_ALIGNMENT == 0 ? "是" : "否")
+                          << "）\n";
+            } else if (cmd == "size") {
+                std::cout << "行数: " << table.size() << "，容量: " << table.capacity() << "\n";
+            } else if (cmd == "clear") {
+                table.clear();
+                std::cout << "已清空。\n";
+            } else if (cmd == "save") {
+                saved = table;
+                std::cout << "已保存 " << saved.size() << " 行。\n";
+            } else if (cmd == "load") {
+                table = saved;
+                std::cout << "已恢复 " << table.size() << " 行。\n";
+            } else if (cmd == "print") {
+                if (table.empty()) std::cout << "（空）\n";
+                for (int i = 0; i < table.size(); ++i) printRow(table, i);
+            } else if (cmd == "bench") {
+                int n;
+                if (!(std::cin >> n) || n <= 0) {
+                    std::cout << "输入有误。用法: bench <行数>\n";
+                    clearInput();
+                    continue;
+                }
+                bench(n);
+            } else if (cmd == "help") {
+                printMenu();
+            } else if (cmd == "exit" || cmd == "0") {
+                std::cout << "程序结束，再见！\n";
+                break;
+            } else {
+                std::cout << "未知命令。输入 help 查看菜单。\n";
+            }
+        } catch (const std::exception& e) {
+            std::cout << "错误: " << e.what() << "\n";
+        }
+        clearInput();
+    }
+    return 0;
+}
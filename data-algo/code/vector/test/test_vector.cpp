@@ -0,0 +1,208 @@
+#include "../code/vector.hpp"
+#include <chrono>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <vector>
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+void printMenu() {
+    std::cout << "\n====== 动态数组交互测试菜单 ======\n";
+    std::cout << "命令列表：\n";
+    std::cout << "  push <值>             : 尾部插入值\n";
+    std::cout << "  pop                   : 删除尾部元素\n";
+    std::cout << "  insert <下标> <值>    : 在下标插入值\n";
+    std::cout << "  erase <下标>          : 删除指定下标的元素\n";
+    std::cout << "  get <下标>            : 获取指定下标的值\n";
+    std::cout << "  tryget <下标>         : 不抛异常的读取（try_get）\n";
+    std::cout << "  find <值>             : 查找值，返回下标\n";
+    std::cout << "  size                  : 当前元素个数\n";
+    std::cout << "  capacity              : 当前容量与扩容策略\n";
+    std::cout << "  empty                 : 判断数组是否为空\n";
+    std::cout << "  resize <个数> <值>    : 调整元素个数，新增元素取该值\n";
+    std::cout << "  reserve <容量>        : 预留容量\n";
+    std::cout << "  shrink                : 收缩容量到元素个数（shrink_to_fit）\n";
+    std::cout << "  policy <策略> [参数]  : 扩容策略：exact、fixed <步长>、geometric <倍数>\n";
+    std::cout << "  clear                 : 清空（保留容量）\n";
+    std::cout << "  print                 : 打印数组内容\n";
+    std::cout << "  bench <元素数>        : 各扩容策略下 push_back 与 std::vector 对比\n";
+    std::cout << "  help                  : 显示菜单\n";
+    std::cout << "  exit / 0              : 退出程序\n";
+    std::cout << "-----------------------------------\n";
+    std::cout << "请输入命令: ";
+}
+
+void clearInput() {
+    std::cin.clear();
+    std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+}
+
+// 计时工具：执行f并返回耗时（毫秒）
+template<typename F>
+double timeIt(F f) {
+    auto start = std::chrono::steady_clock::now();
+    f();
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+void printInt(const int& x) { std::cout << x << " "; }
+
+void printCapacity(const Vector<int>& v) {
+    const GrowthPolicy& p = v.growth_policy();
+    std::cout << "容量: " << v.capacity() << "，元素个数: " << v.size() << "，策略: ";
+    if (p.getKind() == GrowthPolicy::GEOMETRIC) std::cout << "geometric x" << p.getFactor();
+    else if (p.getKind() == GrowthPolicy::FIXED) std::cout << "fixed +" << p.getStep();
+    else if (p.getKind() == GrowthPolicy::EXACT) std::cout << "exact";
+    else std::cout << "none（满时报错）";
+    std::cout << "\n";
+}
+
+// 逐个追加n个 std::string，统计扩容次数；元素带堆内存，扩容时按移动搬迁
+void benchOnce(const char* name, const GrowthPolicy& policy, int n) {
+    Vector<std::string> v;
+    v.set_growth_policy(policy);
+    int reallocs = 0;
+    double t = timeIt([&]() {
+        for (int i = 0; i < n; ++i) {
+            int before = v.capacity();
+            v.push_back(std::string(24, static_cast<char>('a' + i % 26)));
+            if (v.capacity() != before) ++reallocs;
+        }
+    });
+    std::cout << "  " << name << ": " << t << " ms，扩容 " << reallocs << " 次，最终容量 " << v.capacity();
+    v.shrink_to_fit();
+    std::cout << "，shrink_to_fit 后 " << v.capacity() << "\n";
+}
+
+void bench(int n) {
+    std::cout << "  追加 " << n << " 个长度 24 的 std::string：\n";
+    if (n <= 20000) benchOnce("exact", GrowthPolicy::exact(), n);
+    else std::cout << "  exact: 元素数超过 20000 时为 O(n²)，跳过\n";
+    benchOnce("fixed +1024", GrowthPolicy::fixed(1024), n);
+    benchOnce("geometric x1.5", GrowthPolicy::geometric(1.5), n);
+    benchOnce("geometric x2", GrowthPolicy::geometric(2.0), n);
+    std::vector<std::string> ref;
+    double t = timeIt([&]() {
+        for (int i = 0; i < n; ++i) ref.push_back(std::string(24, static_cast<char>('a' + i % 26)));
+    });
+    std::cout << "  std::vector: " << t << " ms\n";
+}
+
+int main() {
+#ifdef _WIN32
+    SetConsoleOutputCP(CP_UTF8);
+    SetConsoleCP(CP_UTF8);
+#endif
+    Vector<int> v;
+    std::string cmd;
+    printMenu();
+    while (true) {
+        std::cout << "> ";
+        if (!(std::cin >> cmd)) break;
+        try {
+            if (cmd == "push" || cmd == "erase" || cmd == "get" || cmd == "tryget" || cmd == "find" || cmd == "reserve" ||
+                cmd == "bench") {
+                int n;
+                if (!(std::cin >> n)) {
+                    std::cout << "输入有误。用法: " << cmd << " <数值>\n";
+                    clearInput();
+                    continue;
+                }
+                if (cmd == "push") {
+                    v.push_back(n);
+                    std::cout << "已在尾部插入 " << n << "。\n";
+                } else if (cmd == "erase") {
+                    v.erase(n);
+                    std::cout << "已删除下标 " << n << " 的元素。\n";
+                } else if (cmd == "get") {
+                    int val = v.at(n);
+                    std::cout << "下标 " << n << " 的值为: " << val << "\n";
+                } else if (cmd == "tryget") {
+                    int val = 0;
+                    if (v.try_get(n, val))
+                        std::cout << "下标 " << n << " 的值为: " << val << "\n";
+                    else
+                        std::cout << "下标 " << n << " 越界，try_get 返回 false。\n";
+                } else if (cmd == "find") {
+                    int idx = v.find(n);
+                    if (idx < 0) std::cout << "未找到值 " << n << "。\n";
+                    else std::cout << "值 " << n << " 首次出现下标为 " << idx << "。\n";
+                } else if (cmd == "reserve") {
+                    v.reserve(n);
+                    printCapacity(v);
+                } else if (n > 0) {
+                    bench(n);
+                } else {
+                    std::cout << "元素数须为正整数。\n";
+                }
+            } else if (cmd == "insert" || cmd == "resize") {
+                int a, b;
+                if (!(std::cin >> a >> b)) {
+                    std::cout << "输入有误。用法: " << cmd << (cmd == "insert" ? " <下标> <值>\n" : " <个数> <值>\n");
+                    clearInput();
+                    continue;
+                }
+                if (cmd == "insert") {
+                    v.insert(a, b);
+                    std::cout << "已在下标 " << a << " 插入 " << b << "。\n";
+                } else {
+                    v.resize(a, b);
+                    printCapacity(v);
+                }
+            } else if (cmd == "pop") {
+                v.pop_back();
+                std::cout << "已删除尾部元素。\n";
+            } else if (cmd == "size") {
+                std::cout << "当前元素个数: " << v.size() << "\n";
+            } else if (cmd == "capacity") {
+                printCapacity(v);
+            } else if (cmd == "empty") {
+                std::cout << (v.empty() ? "数组为空。" : "数组非空。") << "\n";
+            } else if (cmd == "shrink") {
+                v.shrink_to_fit();
+                printCapacity(v);
+            } else if (cmd == "policy") {
+                std::string kind;
+                std::cin >> kind;
+                if (kind == "exact") {
+                    v.set_growth_policy(GrowthPolicy::exact());
+                } else if (kind == "fixed" || kind == "geometric") {
+                    double param;
+                    if (!(std::cin >> param)) {
+                        std::cout << "输入有误。用法: policy fixed <步长> 或 policy geometric <倍数>\n";
+                        clearInput();
+                        continue;
+                    }
+                    v.set_growth_policy(kind == "fixed" ? GrowthPolicy::fixed(static_cast<int>(param))
+                                                        : GrowthPolicy::geometric(param));
+                } else {
+                    std::cout << "输入有误。策略为 exact、fixed <步长> 或 geometric <倍数>\n";
+                    clearInput();
+                    continue;
+                }
+                printCapacity(v);
+            } else if (cmd == "clear") {
+                v.clear();
+                std::cout << "已清空。\n";
+            } else if (cmd == "print") {
+                std::cout << "数组内容: ";
+                v.traverse(printInt);
+                std::cout << "\n";
+            } else if (cmd == "help") {
+                printMenu();
+            } else if (cmd == "exit" || cmd == "0") {
+                std::cout << "程序结束，再见！\n";
+                break;
+            } else {
+                std::cout << "未知命令。输入 help 查看菜单。\n";
+            }
+        } catch (const std::exception& e) {
+            std::cout << "错误: " << e.what() << "\n";
+        }
+        clearInput();
+    }
+    return 0;
+}